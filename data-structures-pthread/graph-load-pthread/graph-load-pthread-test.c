@@ -0,0 +1,450 @@
+/**
+   graph-load-pthread-test.c
+
+   Tests of loading a graph with generic weights from a text edge list file
+   and a DIMACS shortest path (.gr) file with multiple threads.
+
+   The following command line arguments can be used to customize tests:
+   graph-load-pthread-test
+      [0, # bits in size_t / 2] : i s.t. # vertices = 2**i
+      [0, # bits in size_t - 1) : j s.t. # edges = 2**j
+      > 0 : k s.t. # threads = 1, 2, 4, ... <= k
+      [0, 1] : on/off edge list test
+      [0, 1] : on/off DIMACS test
+      [0, 1] : on/off corner cases test
+
+   usage examples:
+   ./graph-load-pthread-test
+   ./graph-load-pthread-test 20 24 16
+   ./graph-load-pthread-test 20 24 16 0 1 0
+
+   graph-load-pthread-test can be run with any subset of command line
+   arguments in the above-defined order. If the (i + 1)th argument is
+   specified then the ith argument must be specified for i >= 0. Default
+   values are used for the unspecified arguments according to the
+   C_ARGS_DEF array.
+
+   The tests write and remove a file C_FNAME in the current directory.
+
+   The implementation of tests does not use stdint.h and is portable under
+   C89/C90 and C99. The requirements are: i) CHAR_BIT * sizeof(size_t) is
+   greater or equal to 16 and is even, ii) pthreads API is available, and
+   iii) POSIX mmap is available.
+*/
+
+#define _XOPEN_SOURCE 600
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include <sys/time.h>
+#include "graph-load-pthread.h"
+#include "graph.h"
+#include "utilities-mem.h"
+#include "utilities-mod.h"
+
+/**
+   Generate random numbers in a portable way for test purposes only; rand()
+   in the Linux C Library uses the same generator as random(), which may not
+   be the case on older rand() implementations, and on current
+   implementations on different systems.
+*/
+#define RGENS_SEED() do{srand(time(NULL));}while (0)
+#define RANDOM() (rand()) /* [0, RAND_MAX] */
+
+#define TOLU(i) ((unsigned long int)(i)) /* printing size_t under C89/C90 */
+
+/* input handling */
+const char *C_USAGE =
+  "graph-load-pthread-test\n"
+  "[0, # bits in size_t / 2] : i s.t. # vertices = 2**i\n"
+  "[0, # bits in size_t - 1) : j s.t. # edges = 2**j\n"
+  "> 0 : k s.t. # threads = 1, 2, 4, ... <= k\n"
+  "[0, 1] : on/off edge list test\n"
+  "[0, 1] : on/off DIMACS test\n"
+  "[0, 1] : on/off corner cases test\n";
+const int C_ARGC_MAX = 7;
+const size_t C_ARGS_DEF[6] = {14, 18, 8, 1, 1, 1};
+const size_t C_FULL_BIT = CHAR_BIT * sizeof(size_t);
+
+const char *C_FNAME = "graph-load-pthread-test.txt";
+
+/* weight types */
+enum{WT_NONE, WT_UINT, WT_DOUBLE, WT_NUM};
+const char *C_WT_NAMES[3] = {"none", "size_t", "double"};
+
+/* corner cases test */
+const size_t C_CORNER_NUM_THREADS_MAX = 9;
+
+void write_str(const char *s);
+int cmp_graph(const graph_t *a, const graph_t *b);
+size_t random_ix(size_t n);
+void print_test_result(int res);
+double timer();
+
+/**
+   Initializes a random graph with n vertices and m edges with weights of
+   a type in the above enum. Every other double weight has two decimal
+   places, and the other double weights are in [0, 1].
+*/
+void rand_graph_init(graph_t *g, size_t n, size_t m, int wt_type){
+  size_t i;
+  size_t wt_sizes[3];
+  wt_sizes[WT_NONE] = 0;
+  wt_sizes[WT_UINT] = sizeof(size_t);
+  wt_sizes[WT_DOUBLE] = sizeof(double);
+  graph_base_init(g, n, wt_sizes[wt_type]);
+  g->num_es = m;
+  g->u = malloc_perror(m, sizeof(size_t));
+  g->v = malloc_perror(m, sizeof(size_t));
+  if (wt_type != WT_NONE) g->wts = malloc_perror(m, g->wt_size);
+  for (i = 0; i < m; i++){
+    g->u[i] = random_ix(n);
+    g->v[i] = random_ix(n);
+    if (wt_type == WT_UINT){
+      *((size_t *)g->wts + i) = RANDOM();
+    }else if (wt_type == WT_DOUBLE && i % 2){
+      *((double *)g->wts + i) = (RANDOM() % 1000000) / 100.0;
+    }else if (wt_type == WT_DOUBLE){
+      *((double *)g->wts + i) = RANDOM() / (double)RAND_MAX;
+    }
+  }
+}
+
+/**
+   Writes a graph to C_FNAME as an edge list file, or as a DIMACS file with
+   comment lines if dimacs is nonzero. The double weights are written with
+   17 significant digits or two decimal places to be loaded exactly.
+*/
+void write_graph(const graph_t *g, int wt_type, int dimacs){
+  size_t i, b = (dimacs) ? 1 : 0;
+  double wt;
+  FILE *file = fopen(C_FNAME, "w");
+  if (file == NULL){
+    perror("fopen failed");
+    exit(EXIT_FAILURE);
+  }
+  if (dimacs){
+    fprintf(file, "c random graph\nc\np sp %lu %lu\n",
+	    TOLU(g->num_vts), TOLU(g->num_es));
+  }else{
+    fprintf(file, "# random graph\n");
+  }
+  for (i = 0; i < g->num_es; i++){
+    if (dimacs) fprintf(file, "a ");
+    fprintf(file, "%lu %lu", TOLU(g->u[i] + b), TOLU(g->v[i] + b));
+    if (wt_type == WT_UINT){
+      fprintf(file, " %lu", TOLU(*((size_t *)g->wts + i)));
+    }else if (wt_type == WT_DOUBLE){
+      wt = *((double *)g->wts + i);
+      fprintf(file, (i % 2) ? " %.2f" : " %.17g", wt);
+    }else if (dimacs){
+      fprintf(file, " 1");
+    }
+    fprintf(file, "\n");
+    if (dimacs && i % 1024 == 0) fprintf(file, "c comment\n");
+  }
+  fclose(file);
+}
+
+/**
+   Loads an edge list file with fscanf to provide a baseline time.
+*/
+void fscanf_load(graph_t *g, int wt_type){
+  size_t count = 1024;
+  unsigned long int u, v, wt_ul;
+  double wt_d;
+  char c;
+  FILE *file = fopen(C_FNAME, "r");
+  if (file == NULL){
+    perror("fopen failed");
+    exit(EXIT_FAILURE);
+  }
+  graph_base_init(g, 0, (wt_type == WT_UINT) ? sizeof(size_t) :
+		  ((wt_type == WT_DOUBLE) ? sizeof(double) : 0));
+  g->u = malloc_perror(count, sizeof(size_t));
+  g->v = malloc_perror(count, sizeof(size_t));
+  if (g->wt_size > 0) g->wts = malloc_perror(count, g->wt_size);
+  while (fscanf(file, " %c", &c) == 1){
+    if (c == '#'){
+      while ((c = fgetc(file)) != EOF && c != '\n');
+      continue;
+    }
+    ungetc(c, file);
+    if (fscanf(file, "%lu %lu", &u, &v) != 2) break;
+    if (g->num_es == count){
+      count *= 2;
+      g->u = realloc_perror(g->u, count, sizeof(size_t));
+      g->v = realloc_perror(g->v, count, sizeof(size_t));
+      if (g->wt_size > 0) g->wts = realloc_perror(g->wts, count, g->wt_size);
+    }
+    g->u[g->num_es] = u;
+    g->v[g->num_es] = v;
+    if (wt_type == WT_UINT && fscanf(file, "%lu", &wt_ul) == 1){
+      *((size_t *)g->wts + g->num_es) = wt_ul;
+    }else if (wt_type == WT_DOUBLE && fscanf(file, "%lf", &wt_d) == 1){
+      *((double *)g->wts + g->num_es) = wt_d;
+    }
+    g->num_es++;
+    if (u >= g->num_vts) g->num_vts = u + 1;
+    if (v >= g->num_vts) g->num_vts = v + 1;
+  }
+  fclose(file);
+}
+
+/**
+   Runs a test of loading an edge list file of a random graph with 2**log_n
+   vertices and 2**log_m edges, for each weight type, and compares the
+   loaded graphs with the graph. The number of vertices of the graph is set
+   to the maximal vertex plus 1.
+*/
+void run_edge_lst_test(size_t log_n, size_t log_m, size_t num_threads_max){
+  int res = 1;
+  int wt_type;
+  size_t i, j;
+  const char *(*parse_wts[3])(void *, const char *, const char *);
+  double t;
+  graph_t g, g_load;
+  parse_wts[WT_NONE] = NULL;
+  parse_wts[WT_UINT] = graph_load_parse_uint;
+  parse_wts[WT_DOUBLE] = graph_load_parse_double;
+  printf("Test graph_edge_lst_load_pthread on random graphs\n");
+  for (wt_type = 0; wt_type < WT_NUM; wt_type++){
+    rand_graph_init(&g, pow_two_perror(log_n), pow_two_perror(log_m),
+		    wt_type);
+    g.num_vts = 0;
+    for (i = 0; i < g.num_es; i++){
+      if (g.u[i] >= g.num_vts) g.num_vts = g.u[i] + 1;
+      if (g.v[i] >= g.num_vts) g.num_vts = g.v[i] + 1;
+    }
+    write_graph(&g, wt_type, 0);
+    printf("\tvertices: %lu, edges: %lu, weight type: %s\n",
+	   TOLU(g.num_vts), TOLU(g.num_es), C_WT_NAMES[wt_type]);
+    t = timer();
+    fscanf_load(&g_load, wt_type);
+    t = timer() - t;
+    printf("\t\tfscanf load:                    %.4f seconds\n", t);
+    res *= cmp_graph(&g, &g_load);
+    graph_free(&g_load);
+    for (j = 1; j <= num_threads_max; j *= 2){
+      t = timer();
+      graph_edge_lst_load_pthread(&g_load, C_FNAME, g.wt_size,
+				  parse_wts[wt_type], j);
+      t = timer() - t;
+      printf("\t\tload with %3lu threads:          %.4f seconds\n",
+	     TOLU(j), t);
+      res *= cmp_graph(&g, &g_load);
+      graph_free(&g_load);
+    }
+    graph_free(&g);
+  }
+  remove(C_FNAME);
+  printf("\tcorrectness across all loads --> ");
+  print_test_result(res);
+}
+
+/**
+   Runs a test of loading a DIMACS file of a random graph with 2**log_n
+   vertices and 2**log_m edges with size_t weights, with and without
+   loading the weights.
+*/
+void run_dimacs_test(size_t log_n, size_t log_m, size_t num_threads_max){
+  int res = 1;
+  size_t j;
+  double t;
+  graph_t g, g_load;
+  printf("Test graph_dimacs_load_pthread on random graphs\n");
+  rand_graph_init(&g, pow_two_perror(log_n), pow_two_perror(log_m),
+		  WT_UINT);
+  write_graph(&g, WT_UINT, 1);
+  printf("\tvertices: %lu, edges: %lu, weight type: %s\n",
+	 TOLU(g.num_vts), TOLU(g.num_es), C_WT_NAMES[WT_UINT]);
+  for (j = 1; j <= num_threads_max; j *= 2){
+    t = timer();
+    graph_dimacs_load_pthread(&g_load, C_FNAME, sizeof(size_t),
+			      graph_load_parse_uint, j);
+    t = timer() - t;
+    printf("\t\tload with %3lu threads:          %.4f seconds\n",
+	   TOLU(j), t);
+    res *= cmp_graph(&g, &g_load);
+    graph_free(&g_load);
+    graph_dimacs_load_pthread(&g_load, C_FNAME, 0, NULL, j);
+    res *= (g_load.wt_size == 0 && g_load.wts == NULL);
+    g_load.wt_size = sizeof(size_t);
+    g_load.wts = g.wts;
+    res *= cmp_graph(&g, &g_load);
+    g_load.wts = NULL;
+    graph_free(&g_load);
+  }
+  graph_free(&g);
+  remove(C_FNAME);
+  printf("\tcorrectness across all loads --> ");
+  print_test_result(res);
+}
+
+/**
+   Runs a test of loading small files with empty and comment lines, "\r\n"
+   line endings, without a trailing newline, and with more threads than
+   bytes, and a test of parsing double weights.
+*/
+void run_corner_cases_test(){
+  int res = 1;
+  size_t i, j;
+  size_t u[3] = {0, 2, 1}, v[3] = {1, 0, 2}, wts[3] = {7, 0, 18446};
+  size_t u_d[2] = {0, 1}, v_d[2] = {1, 1}, wts_d[2] = {3, 5};
+  const char *edge_lst_strs[4] = {"0 1 7\n2 0 0\n1 2 18446\n",
+				  "\n# c\n0\t1  7\n%\n  2 0 0 \n\n1 2 18446",
+				  "0 1 7\r\n2 0 0\r\n1 2 18446\r\n",
+				  "0 1 7\n\r\n2 0 0\n1 2 18446\r\n\n"};
+  const char *dimacs_strs[2] = {"c x\np sp 3 2\na 1 2 3\nc\na 2 2 5\n",
+				"p sp 3 2\r\na 1 2 3\r\na 2 2 5"};
+  const char *dbl_strs[10] = {"0.1", "1e-5", "-2.5E+3", "007.50",
+			      "123456789012345678", "1.7976931348623157e308",
+			      "4.9e-324", "0.000000000000000000000001",
+			      "-3.14159265358979323846",
+			      "2.2250738585072011e-308"};
+  const char *invalid_strs[3] = {"1.5x", ".", "12a"};
+  char buf[64];
+  double wt;
+  graph_t g, g_load;
+  graph_base_init(&g, 3, sizeof(size_t));
+  g.num_es = 3;
+  g.u = u;
+  g.v = v;
+  g.wts = wts;
+  for (i = 0; i < 4; i++){
+    write_str(edge_lst_strs[i]);
+    for (j = 1; j <= C_CORNER_NUM_THREADS_MAX; j++){
+      graph_edge_lst_load_pthread(&g_load, C_FNAME, sizeof(size_t),
+				  graph_load_parse_uint, j);
+      res *= cmp_graph(&g, &g_load);
+      graph_free(&g_load);
+    }
+  }
+  g.num_es = 2;
+  g.u = u_d;
+  g.v = v_d;
+  g.wts = wts_d;
+  for (i = 0; i < 2; i++){
+    write_str(dimacs_strs[i]);
+    for (j = 1; j <= C_CORNER_NUM_THREADS_MAX; j++){
+      graph_dimacs_load_pthread(&g_load, C_FNAME, sizeof(size_t),
+				graph_load_parse_uint, j);
+      res *= cmp_graph(&g, &g_load);
+      graph_free(&g_load);
+    }
+  }
+  write_str("");
+  for (j = 1; j <= C_CORNER_NUM_THREADS_MAX; j++){
+    graph_edge_lst_load_pthread(&g_load, C_FNAME, 0, NULL, j);
+    res *= (g_load.num_vts == 0 && g_load.num_es == 0 && g_load.u == NULL);
+    graph_free(&g_load);
+  }
+  remove(C_FNAME);
+  for (i = 0; i < 10; i++){
+    strcpy(buf, dbl_strs[i]);
+    res *= (graph_load_parse_double(&wt, buf, buf + strlen(buf)) ==
+	    buf + strlen(buf));
+    res *= (wt == strtod(buf, NULL));
+  }
+  for (i = 0; i < 3; i++){
+    strcpy(buf, invalid_strs[i]);
+    res *= (graph_load_parse_double(&wt, buf, buf + strlen(buf)) == NULL);
+    res *= (graph_load_parse_uint(&j, buf, buf + strlen(buf)) == NULL);
+  }
+  printf("Test graph_{edge_lst, dimacs}_load_pthread on corner cases --> ");
+  print_test_result(res);
+}
+
+/**
+   Auxiliary functions.
+*/
+
+/**
+   Writes a string to C_FNAME.
+*/
+void write_str(const char *s){
+  FILE *file = fopen(C_FNAME, "w");
+  if (file == NULL){
+    perror("fopen failed");
+    exit(EXIT_FAILURE);
+  }
+  fputs(s, file);
+  fclose(file);
+}
+
+/**
+   Compares two graphs, including the order of edges.
+*/
+int cmp_graph(const graph_t *a, const graph_t *b){
+  int res = 1;
+  res *= (a->num_vts == b->num_vts);
+  res *= (a->num_es == b->num_es);
+  res *= (a->wt_size == b->wt_size);
+  if (!res || a->num_es == 0) return res;
+  res *= (memcmp(a->u, b->u, a->num_es * sizeof(size_t)) == 0);
+  res *= (memcmp(a->v, b->v, a->num_es * sizeof(size_t)) == 0);
+  if (a->wt_size > 0){
+    res *= (memcmp(a->wts, b->wts, a->num_es * a->wt_size) == 0);
+  }
+  return res;
+}
+
+/**
+   Returns a random index in [0, n), where n > 0.
+*/
+size_t random_ix(size_t n){
+  size_t ret = 0;
+  size_t rem = n - 1;
+  while (rem > 0){
+    ret = (ret << (CHAR_BIT - 1)) ^ (size_t)RANDOM();
+    rem >>= CHAR_BIT - 1;
+  }
+  return ret % n;
+}
+
+void print_test_result(int res){
+  if (res){
+    printf("SUCCESS\n");
+  }else{
+    printf("FAILURE\n");
+  }
+}
+
+double timer(){
+  struct timeval tm;
+  gettimeofday(&tm, NULL);
+  return tm.tv_sec + tm.tv_usec / 1e6;
+}
+
+int main(int argc, char *argv[]){
+  int i;
+  size_t *args = NULL;
+  RGENS_SEED();
+  if (argc > C_ARGC_MAX){
+    fprintf(stderr, "USAGE:\n%s", C_USAGE);
+    exit(EXIT_FAILURE);
+  }
+  args = malloc_perror(C_ARGC_MAX - 1, sizeof(size_t));
+  memcpy(args, C_ARGS_DEF, (C_ARGC_MAX - 1) * sizeof(size_t));
+  for (i = 1; i < argc; i++){
+    args[i - 1] = atoi(argv[i]);
+  }
+  if (args[0] > C_FULL_BIT / 2 ||
+      args[1] > C_FULL_BIT - 2 ||
+      args[2] < 1 ||
+      args[3] > 1 ||
+      args[4] > 1 ||
+      args[5] > 1){
+    fprintf(stderr, "USAGE:\n%s", C_USAGE);
+    exit(EXIT_FAILURE);
+  }
+  if (args[3]) run_edge_lst_test(args[0], args[1], args[2]);
+  if (args[4]) run_dimacs_test(args[0], args[1], args[2]);
+  if (args[5]) run_corner_cases_test();
+  free(args);
+  args = NULL;
+  return 0;
+}
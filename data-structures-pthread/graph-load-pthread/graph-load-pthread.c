@@ -0,0 +1,530 @@
+/**
+   graph-load-pthread.c
+
+   Functions for loading a graph with generic weights from a text edge
+   list file or a DIMACS shortest path (.gr) file into a graph_t with
+   multiple threads.
+
+   A file is mapped read-only and split into num_threads chunks of about
+   equal size, where the start of each chunk, except the first, is moved
+   forward to the character after the next newline. Each thread parses the
+   lines of its chunk into its own dynamically growing u, v, and weight
+   arrays without locks, and records its maximal vertex and, for a DIMACS
+   file, the problem line if it is in the chunk. After the parsing phase,
+   an exclusive prefix sum of the per-thread numbers of edges determines
+   the position of each thread in the merged arrays, and the threads copy
+   their arrays in parallel.
+
+   The integer and floating point parsers do not depend on the locale and
+   do not require a null-terminated string, because a mapped file is not
+   null-terminated. A double with at most 15 significant digits and a
+   decimal exponent in [-22, 22] is computed as a product or quotient of
+   two doubles that are exact, which results in a correctly rounded value
+   with one rounding. For other doubles, the digits without the decimal
+   point are copied into a buffer, followed by an adjusted exponent, and
+   parsed by strtod. Because the buffer contains no radix character, the
+   result of strtod does not depend on LC_NUMERIC.
+
+   The implementation does not use stdint.h and is portable under C89/C90
+   and C99. The requirements are: i) pthreads API is available, and ii)
+   POSIX mmap is available.
+*/
+
+#define _XOPEN_SOURCE 600
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "graph-load-pthread.h"
+#include "graph.h"
+#include "utilities-mem.h"
+#include "utilities-pthread.h"
+
+typedef struct{
+  const char *start; /* chunk */
+  const char *end;
+  const char *data; /* file */
+  const char *fname;
+  int dimacs;
+  size_t wt_size;
+  const char *(*parse_wt)(void *, const char *, const char *);
+  size_t count; /* count of the arrays */
+  size_t num_es;
+  size_t *u;
+  size_t *v;
+  void *wts;
+  size_t max_vt; /* maximal vertex + 1, 0 if no edges */
+  int p_found; /* DIMACS problem line */
+  size_t p_n;
+  size_t p_m;
+  size_t pos; /* position in the merged arrays */
+  graph_t *g;
+} load_arg_t;
+
+static const size_t C_SIZE_MAX = (size_t)-1;
+static const size_t C_INIT_COUNT = 1024;
+static const int C_DBL_DIGITS_EXACT = 15;
+static const int C_DBL_EXP_EXACT = 22;
+
+static void load_pthread(graph_t *g,
+			 const char *fname,
+			 int dimacs,
+			 size_t wt_size,
+			 const char *(*parse_wt)(void *,
+						 const char *,
+						 const char *),
+			 size_t num_threads);
+static void run_phase(load_arg_t *las,
+		      size_t num_threads,
+		      void *(*phase)(void *));
+static void *parse_thread(void *arg);
+static void *copy_thread(void *arg);
+static void parse_edge_lst_line(load_arg_t *la,
+				const char *s,
+				const char *end);
+static void parse_dimacs_line(load_arg_t *la,
+			      const char *s,
+			      const char *end);
+static void *next_wt(load_arg_t *la);
+static void push_edge(load_arg_t *la, size_t u, size_t v);
+static const char *parse_size(size_t *n, const char *s, const char *end);
+static const char *skip_space(const char *s, const char *end);
+static const char *skip_token(const char *s, const char *end);
+static int is_space(char c);
+static int is_end(const char *s, const char *end);
+static void parse_error_exit(const load_arg_t *la, const char *s);
+static void file_error_exit(const char *fname, const char *s);
+
+/**
+   Loads a graph from a text edge list file.
+   g           : pointer to a preallocated block of size sizeof(graph_t)
+   fname       : path of the file
+   wt_size     : 0 if the lines of the file are of the form "u v", > 0 if
+                 the lines are of the form "u v w", where w is parsed into
+                 a block of size wt_size
+   parse_wt    : NULL if wt_size is 0, otherwise a weight parsing function
+   num_threads : > 0 number of threads, including the calling thread
+*/
+void graph_edge_lst_load_pthread(graph_t *g,
+				 const char *fname,
+				 size_t wt_size,
+				 const char *(*parse_wt)(void *,
+							 const char *,
+							 const char *),
+				 size_t num_threads){
+  load_pthread(g, fname, 0, wt_size, parse_wt, num_threads);
+}
+
+/**
+   Loads a graph from a DIMACS shortest path (.gr) file. Please see the
+   parameter specification in graph_edge_lst_load_pthread; if wt_size is
+   0, then the weights in the file are skipped.
+*/
+void graph_dimacs_load_pthread(graph_t *g,
+			       const char *fname,
+			       size_t wt_size,
+			       const char *(*parse_wt)(void *,
+						       const char *,
+						       const char *),
+			       size_t num_threads){
+  load_pthread(g, fname, 1, wt_size, parse_wt, num_threads);
+}
+
+/**
+   Parse a decimal size_t weight, or a double weight with an optional
+   sign, fraction, and exponent. A double weight with at most 15 significant
+   digits and a decimal exponent in [-22, 22] is computed exactly with one
+   rounding; other double weights are parsed by strtod from their digits
+   and an adjusted exponent without a radix character, independently of
+   the locale.
+*/
+const char *graph_load_parse_uint(void *wt, const char *s, const char *end){
+  size_t n;
+  s = parse_size(&n, s, end);
+  if (s == NULL) return NULL;
+  memcpy(wt, &n, sizeof(size_t));
+  return s;
+}
+
+const char *graph_load_parse_double(void *wt, const char *s, const char *end){
+  static const double pows[23] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+				  1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14,
+				  1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21,
+				  1e22};
+  char buf[128];
+  char *buf_end = NULL;
+  size_t n = 0;
+  int neg = 0, exp_neg = 0, num_digits = 0, any_digit = 0;
+  long exp = 0, exp_val = 0;
+  double m = 0.0;
+  const char *t = s, *digits_end = NULL;
+  if (t != end && (*t == '-' || *t == '+')) neg = (*t++ == '-');
+  s = t;
+  while (t != end && *t == '0'){
+    any_digit = 1;
+    t++;
+  }
+  while (t != end && *t >= '0' && *t <= '9'){
+    if (num_digits < C_DBL_DIGITS_EXACT) m = m * 10.0 + (*t - '0');
+    num_digits++;
+    any_digit = 1;
+    t++;
+  }
+  if (t != end && *t == '.'){
+    t++;
+    while (t != end && *t >= '0' && *t <= '9'){
+      if (num_digits > 0 || *t != '0'){
+	if (num_digits < C_DBL_DIGITS_EXACT) m = m * 10.0 + (*t - '0');
+	num_digits++;
+      }
+      exp--;
+      any_digit = 1;
+      t++;
+    }
+  }
+  if (!any_digit) return NULL;
+  digits_end = t;
+  if (t != end && (*t == 'e' || *t == 'E')){
+    t++;
+    if (t != end && (*t == '-' || *t == '+')) exp_neg = (*t++ == '-');
+    if (t == end || *t < '0' || *t > '9') return NULL;
+    while (t != end && *t >= '0' && *t <= '9'){
+      if (exp_val < 10000) exp_val = exp_val * 10 + (*t - '0');
+      t++;
+    }
+    exp += (exp_neg) ? -exp_val : exp_val;
+  }
+  if (!is_end(t, end) && !is_space(*t)) return NULL;
+  if (num_digits <= C_DBL_DIGITS_EXACT &&
+      exp >= -C_DBL_EXP_EXACT &&
+      exp <= C_DBL_EXP_EXACT){
+    m = (exp < 0) ? m / pows[-exp] : m * pows[exp];
+  }else{
+    /* digits, 'e', at most 21 characters of exp, and '\0' */
+    if ((size_t)(digits_end - s) + 23 > sizeof(buf)) return NULL;
+    for (; s != digits_end; s++){
+      if (*s != '.') buf[n++] = *s;
+    }
+    n += sprintf(buf + n, "e%ld", exp);
+    m = strtod(buf, &buf_end);
+    if (buf_end != buf + n) return NULL;
+  }
+  if (neg) m = -m;
+  memcpy(wt, &m, sizeof(double));
+  return t;
+}
+
+/** Helper functions */
+
+/**
+   Maps a file, parses its chunks in parallel, and merges the per-thread
+   arrays into a graph.
+*/
+static void load_pthread(graph_t *g,
+			 const char *fname,
+			 int dimacs,
+			 size_t wt_size,
+			 const char *(*parse_wt)(void *,
+						 const char *,
+						 const char *),
+			 size_t num_threads){
+  int fd;
+  int p_found = 0;
+  size_t i, size, b, num_es = 0, max_vt = 0, p_n = 0, p_m = 0;
+  void *ret = MAP_FAILED;
+  const char *data = NULL;
+  load_arg_t *las = NULL;
+  struct stat st;
+  fd = open(fname, O_RDONLY);
+  if (fd == -1){
+    perror("graph load open failed");
+    exit(EXIT_FAILURE);
+  }
+  if (fstat(fd, &st) == -1){
+    perror("graph load fstat failed");
+    exit(EXIT_FAILURE);
+  }
+  size = st.st_size;
+  if (st.st_size < 0 || (off_t)size != st.st_size){
+    file_error_exit(fname, "file size is not supported");
+  }
+  if (size > 0){
+    ret = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (ret == MAP_FAILED){
+      perror("graph load mmap failed");
+      exit(EXIT_FAILURE);
+    }
+    data = ret;
+  }
+  close(fd);
+  las = malloc_perror(num_threads, sizeof(load_arg_t));
+  for (i = 0; i < num_threads; i++){
+    /* chunk boundary moved forward to a line start */
+    b = (size / num_threads) * i +
+      ((i < size % num_threads) ? i : size % num_threads);
+    while (i > 0 && b < size && data[b - 1] != '\n') b++;
+    las[i].start = data + b;
+    if (i > 0) las[i - 1].end = las[i].start;
+    las[i].data = data;
+    las[i].fname = fname;
+    las[i].dimacs = dimacs;
+    las[i].wt_size = wt_size;
+    las[i].parse_wt = parse_wt;
+    las[i].count = 0;
+    las[i].num_es = 0;
+    las[i].u = NULL;
+    las[i].v = NULL;
+    las[i].wts = NULL;
+    las[i].max_vt = 0;
+    las[i].p_found = 0;
+    las[i].p_n = 0;
+    las[i].p_m = 0;
+    las[i].pos = 0;
+    las[i].g = g;
+  }
+  las[num_threads - 1].end = data + size;
+  run_phase(las, num_threads, parse_thread);
+  for (i = 0; i < num_threads; i++){
+    las[i].pos = num_es;
+    num_es = add_sz_perror(num_es, las[i].num_es);
+    if (las[i].max_vt > max_vt) max_vt = las[i].max_vt;
+    if (las[i].p_found){
+      if (p_found) file_error_exit(fname, "more than one problem line");
+      p_found = 1;
+      p_n = las[i].p_n;
+      p_m = las[i].p_m;
+    }
+  }
+  if (dimacs){
+    if (!p_found) file_error_exit(fname, "no problem line");
+    if (max_vt > p_n) file_error_exit(fname, "vertex greater than n");
+    if (num_es != p_m) file_error_exit(fname, "number of arcs is not m");
+    max_vt = p_n;
+  }
+  graph_base_init(g, max_vt, wt_size);
+  g->num_es = num_es;
+  if (num_es > 0){
+    g->u = malloc_perror(num_es, sizeof(size_t));
+    g->v = malloc_perror(num_es, sizeof(size_t));
+    if (wt_size > 0) g->wts = malloc_perror(num_es, wt_size);
+  }
+  run_phase(las, num_threads, copy_thread);
+  if (size > 0) munmap(ret, size);
+  free(las);
+}
+
+/**
+   Runs a phase with num_threads threads, using the calling thread as the
+   first thread, and returns after all threads completed the phase.
+*/
+static void run_phase(load_arg_t *las,
+		      size_t num_threads,
+		      void *(*phase)(void *)){
+  size_t i;
+  pthread_t *ids = NULL;
+  ids = malloc_perror(num_threads, sizeof(pthread_t));
+  for (i = 1; i < num_threads; i++){
+    thread_create_perror(&ids[i], phase, &las[i]);
+  }
+  phase(&las[0]);
+  for (i = 1; i < num_threads; i++){
+    thread_join_perror(ids[i], NULL);
+  }
+  free(ids);
+}
+
+/**
+   Parses the lines of the chunk of a thread.
+*/
+static void *parse_thread(void *arg){
+  load_arg_t *la = arg;
+  const char *s = la->start;
+  const char *line_end = NULL;
+  while (s < la->end){
+    line_end = memchr(s, '\n', la->end - s);
+    if (line_end == NULL) line_end = la->end;
+    if (la->dimacs){
+      parse_dimacs_line(la, s, line_end);
+    }else{
+      parse_edge_lst_line(la, s, line_end);
+    }
+    s = line_end + 1;
+  }
+  return NULL;
+}
+
+/**
+   Copies the arrays of a thread into the arrays of a graph and frees the
+   arrays of the thread.
+*/
+static void *copy_thread(void *arg){
+  load_arg_t *la = arg;
+  graph_t *g = la->g;
+  if (la->num_es > 0){
+    memcpy(g->u + la->pos, la->u, la->num_es * sizeof(size_t));
+    memcpy(g->v + la->pos, la->v, la->num_es * sizeof(size_t));
+    if (la->wt_size > 0){
+      memcpy((char *)g->wts + la->pos * la->wt_size,
+	     la->wts,
+	     la->num_es * la->wt_size);
+    }
+  }
+  free(la->u);
+  free(la->v);
+  free(la->wts);
+  la->u = NULL;
+  la->v = NULL;
+  la->wts = NULL;
+  return NULL;
+}
+
+/**
+   Parses a line of an edge list file.
+*/
+static void parse_edge_lst_line(load_arg_t *la,
+				const char *s,
+				const char *end){
+  size_t u, v;
+  const char *t = s;
+  s = skip_space(s, end);
+  if (is_end(s, end) || *s == '#' || *s == '%') return;
+  s = parse_size(&u, s, end);
+  if (s != NULL) s = parse_size(&v, skip_space(s, end), end);
+  if (s != NULL && la->wt_size > 0){
+    s = la->parse_wt(next_wt(la), skip_space(s, end), end);
+  }
+  if (s == NULL || !is_end(skip_space(s, end), end)){
+    parse_error_exit(la, t);
+  }
+  push_edge(la, u, v);
+}
+
+/**
+   Parses a line of a DIMACS shortest path file.
+*/
+static void parse_dimacs_line(load_arg_t *la,
+			      const char *s,
+			      const char *end){
+  size_t u, v;
+  const char *t = s;
+  s = skip_space(s, end);
+  if (is_end(s, end) || *s == 'c') return;
+  if (*s == 'p'){
+    s = skip_token(skip_space(s + 1, end), end); /* format, e.g. sp */
+    s = parse_size(&la->p_n, skip_space(s, end), end);
+    if (s != NULL) s = parse_size(&la->p_m, skip_space(s, end), end);
+    if (s == NULL || !is_end(skip_space(s, end), end) || la->p_found){
+      parse_error_exit(la, t);
+    }
+    la->p_found = 1;
+    return;
+  }
+  if (*s != 'a') parse_error_exit(la, t);
+  s = parse_size(&u, skip_space(s + 1, end), end);
+  if (s != NULL) s = parse_size(&v, skip_space(s, end), end);
+  if (s != NULL && la->wt_size > 0){
+    s = la->parse_wt(next_wt(la), skip_space(s, end), end);
+  }else if (s != NULL){
+    s = skip_token(skip_space(s, end), end);
+  }
+  if (s == NULL || !is_end(skip_space(s, end), end) || u == 0 || v == 0){
+    parse_error_exit(la, t);
+  }
+  push_edge(la, u - 1, v - 1);
+}
+
+/**
+   Returns a pointer to the weight block of the next edge of a thread,
+   growing the arrays of the thread if necessary.
+*/
+static void *next_wt(load_arg_t *la){
+  if (la->count == la->num_es){
+    if (la->count == 0){
+      la->count = C_INIT_COUNT;
+    }else{
+      la->count = mul_sz_perror(la->count, 2);
+    }
+    la->u = realloc_perror(la->u, la->count, sizeof(size_t));
+    la->v = realloc_perror(la->v, la->count, sizeof(size_t));
+    if (la->wt_size > 0){
+      la->wts = realloc_perror(la->wts, la->count, la->wt_size);
+    }
+  }
+  return (char *)la->wts + la->num_es * la->wt_size;
+}
+
+/**
+   Pushes an edge with a weight, if any, that is already in the next weight
+   block of a thread.
+*/
+static void push_edge(load_arg_t *la, size_t u, size_t v){
+  next_wt(la);
+  la->u[la->num_es] = u;
+  la->v[la->num_es] = v;
+  la->num_es++;
+  if (u >= la->max_vt) la->max_vt = add_sz_perror(u, 1);
+  if (v >= la->max_vt) la->max_vt = add_sz_perror(v, 1);
+}
+
+/**
+   Parses a decimal size_t value and returns a pointer past the value, or
+   NULL if there are no digits, the value overflows, or the value is not
+   followed by whitespace or the end of a line.
+*/
+static const char *parse_size(size_t *n, const char *s, const char *end){
+  size_t d;
+  const char *t = s;
+  *n = 0;
+  while (t != end && *t >= '0' && *t <= '9'){
+    d = *t - '0';
+    if (*n > (C_SIZE_MAX - d) / 10) return NULL;
+    *n = *n * 10 + d;
+    t++;
+  }
+  if (t == s || (!is_end(t, end) && !is_space(*t))) return NULL;
+  return t;
+}
+
+/**
+   Skip whitespace or a token that does not contain whitespace, without
+   passing the end of a line.
+*/
+static const char *skip_space(const char *s, const char *end){
+  while (s != end && is_space(*s)) s++;
+  return s;
+}
+
+static const char *skip_token(const char *s, const char *end){
+  while (s != end && !is_space(*s)) s++;
+  return s;
+}
+
+/**
+   Determine if a character is whitespace within a line, and if a
+   pointer is at the end of a line ('\r' before '\n' is accepted).
+*/
+static int is_space(char c){
+  return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+static int is_end(const char *s, const char *end){
+  return s == end || (*s == '\r' && s + 1 == end);
+}
+
+/**
+   Print an error message and exit.
+*/
+static void parse_error_exit(const load_arg_t *la, const char *s){
+  fprintf(stderr, "%s: parse error at byte %lu\n",
+	  la->fname, (unsigned long int)(s - la->data));
+  exit(EXIT_FAILURE);
+}
+
+static void file_error_exit(const char *fname, const char *s){
+  fprintf(stderr, "%s: %s\n", fname, s);
+  exit(EXIT_FAILURE);
+}
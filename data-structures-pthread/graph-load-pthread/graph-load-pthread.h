@@ -0,0 +1,92 @@
+/**
+   graph-load-pthread.h
+
+   Declarations of accessible functions for loading a graph with generic
+   weights from a text edge list file or a DIMACS shortest path (.gr) file
+   into a graph_t with multiple threads.
+
+   An edge list file consists of lines of the form "u v" or "u v w", where
+   u and v are vertices (size_t indices starting from 0) and w is a weight,
+   separated by spaces or tabs. Empty lines and lines starting with '#' or
+   '%' are skipped. The number of vertices of a loaded graph is the maximal
+   vertex in the file plus 1, or 0 if the file contains no edges.
+
+   A DIMACS file consists of a problem line "p sp n m", arc lines "a u v w"
+   with vertices starting from 1, and comment lines starting with 'c'. A
+   vertex u in a file is loaded as the vertex u - 1, and the number of
+   vertices of a loaded graph is n. The weights of a DIMACS file are not
+   loaded if wt_size is 0.
+
+   A file is mapped read-only and split into num_threads chunks at newline
+   boundaries. Each thread parses the lines of its chunk with a
+   hand-written parser into its own arrays, and the arrays are merged in
+   the order of chunks. The edges of a loaded graph are in the order of
+   lines in the file. Lines ending with "\r\n" are accepted.
+
+   A weight is parsed by a parse_wt function that takes a pointer to a
+   block of size wt_size, and a pointer to the first and a pointer past the
+   last character of a line remainder without leading spaces or tabs. The
+   function parses a weight token at the beginning of the remainder into
+   the block, and returns a pointer past the token or NULL if the token is
+   not a valid weight. graph_load_parse_uint and graph_load_parse_double
+   parse size_t and double weights. A user can provide a parse_wt for
+   another weight type.
+
+   The functions exit with an error message if a file cannot be mapped or
+   a line cannot be parsed.
+
+   The implementation does not use stdint.h and is portable under C89/C90
+   and C99. The requirements are: i) pthreads API is available, and ii)
+   POSIX mmap is available.
+*/
+
+#ifndef GRAPH_LOAD_PTHREAD_H
+#define GRAPH_LOAD_PTHREAD_H
+
+#include <stddef.h>
+#include "graph.h"
+
+/**
+   Loads a graph from a text edge list file.
+   g           : pointer to a preallocated block of size sizeof(graph_t)
+   fname       : path of the file
+   wt_size     : 0 if the lines of the file are of the form "u v", > 0 if
+                 the lines are of the form "u v w", where w is parsed into
+                 a block of size wt_size
+   parse_wt    : NULL if wt_size is 0, otherwise a weight parsing function
+   num_threads : > 0 number of threads, including the calling thread
+*/
+void graph_edge_lst_load_pthread(graph_t *g,
+				 const char *fname,
+				 size_t wt_size,
+				 const char *(*parse_wt)(void *,
+							 const char *,
+							 const char *),
+				 size_t num_threads);
+
+/**
+   Loads a graph from a DIMACS shortest path (.gr) file. Please see the
+   parameter specification in graph_edge_lst_load_pthread; if wt_size is
+   0, then the weights in the file are skipped.
+*/
+void graph_dimacs_load_pthread(graph_t *g,
+			       const char *fname,
+			       size_t wt_size,
+			       const char *(*parse_wt)(void *,
+						       const char *,
+						       const char *),
+			       size_t num_threads);
+
+/**
+   Parse a decimal size_t weight, or a double weight with an optional
+   sign, fraction, and exponent. A double weight with at most 15 significant
+   digits and a decimal exponent in [-22, 22] is computed exactly with one
+   rounding; other double weights are parsed by strtod from their digits
+   and an adjusted exponent without a radix character, independently of
+   the locale.
+*/
+const char *graph_load_parse_uint(void *wt, const char *s, const char *end);
+
+const char *graph_load_parse_double(void *wt, const char *s, const char *end);
+
+#endif
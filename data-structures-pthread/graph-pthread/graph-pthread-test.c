@@ -0,0 +1,856 @@
+/**
+   graph-pthread-test.c
+
+   Tests of building the adjacency list of a graph with generic weights in
+   CSR format with multiple threads, and of batched edge updates and
+   sorting of an adjacency list with multiple threads.
+
+   The following command line arguments can be used to customize tests:
+   graph-pthread-test
+      [0, # bits in size_t / 2] : i s.t. # vertices = 2**i
+      [0, # bits in size_t - 1) : j s.t. # edges = 2**j
+      > 0 : k s.t. # threads = 1, 2, 4, ... <= k
+      [0, 1] : on/off directed graph test
+      [0, 1] : on/off undirected graph test
+      [0, 1] : on/off corner cases test
+      [0, 1] : on/off random graph test
+      [0, 1] : on/off R-MAT and Chung-Lu graph test
+      [0, 1] : on/off batch update test
+      [0, 1] : on/off sort test
+
+   usage examples:
+   ./graph-pthread-test
+   ./graph-pthread-test 20 24 16
+   ./graph-pthread-test 20 24 16 0 1 0
+   ./graph-pthread-test 20 24 16 0 0 0 1
+   ./graph-pthread-test 20 24 16 0 0 0 0 1
+   ./graph-pthread-test 20 24 16 0 0 0 0 0 1
+   ./graph-pthread-test 20 24 16 0 0 0 0 0 0 1
+
+   graph-pthread-test can be run with any subset of command line arguments
+   in the above-defined order. If the (i + 1)th argument is specified then
+   the ith argument must be specified for i >= 0. Default values are used
+   for the unspecified arguments according to the C_ARGS_DEF array.
+
+   The implementation of tests does not use stdint.h and is portable under
+   C89/C90 and C99. The requirements are: i) CHAR_BIT * sizeof(size_t) is
+   greater or equal to 16 and is even, and ii) pthreads API is available.
+*/
+
+#define _XOPEN_SOURCE 600
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include <math.h>
+#include <sys/time.h>
+#include "graph-pthread.h"
+#include "graph.h"
+#include "utilities-mem.h"
+#include "utilities-mod.h"
+
+/**
+   Generate random numbers in a portable way for test purposes only; rand()
+   in the Linux C Library uses the same generator as random(), which may not
+   be the case on older rand() implementations, and on current
+   implementations on different systems.
+*/
+#define RGENS_SEED() do{srand(time(NULL));}while (0)
+#define RANDOM() (rand()) /* [0, RAND_MAX] */
+
+#define TOLU(i) ((unsigned long int)(i)) /* printing size_t under C89/C90 */
+
+/* input handling */
+const char *C_USAGE =
+  "graph-pthread-test\n"
+  "[0, # bits in size_t / 2] : i s.t. # vertices = 2**i\n"
+  "[0, # bits in size_t - 1) : j s.t. # edges = 2**j\n"
+  "> 0 : k s.t. # threads = 1, 2, 4, ... <= k\n"
+  "[0, 1] : on/off directed graph test\n"
+  "[0, 1] : on/off undirected graph test\n"
+  "[0, 1] : on/off corner cases test\n"
+  "[0, 1] : on/off random graph test\n"
+  "[0, 1] : on/off R-MAT and Chung-Lu graph test\n"
+  "[0, 1] : on/off batch update test\n"
+  "[0, 1] : on/off sort test\n";
+const int C_ARGC_MAX = 11;
+const size_t C_ARGS_DEF[10] = {14, 20, 8, 1, 1, 1, 1, 1, 1, 1};
+const size_t C_FULL_BIT = CHAR_BIT * sizeof(size_t);
+const size_t C_SIZE_MAX = (size_t)-1;
+
+/* corner cases test */
+const size_t C_CORNER_NUM_VTS_MAX = 17;
+const size_t C_CORNER_NUM_THREADS_MAX = 9;
+
+/* random graph test */
+const double C_DEG = 16.0;
+const size_t C_SKIPS_COUNT = 8;
+const size_t C_SKIPS[8] = {0, 3, 1, 7, 2, 0, 0, 5};
+
+/* R-MAT and Chung-Lu graph test */
+const size_t C_GEN_DEG = 16;
+const double C_RMAT_PROBS[3] = {0.57, 0.19, 0.19};
+const double C_RMAT_DRANDS[4] = {0.1, 0.3, 0.6, 0.9};
+const double C_POW_EXP = 2.5; /* exponent of a power-law degree sequence */
+
+int cmp_adj_lst(const adj_lst_t *a, const adj_lst_t *b);
+int cmp_stack_lst(const adj_lst_t *a, const adj_lst_t *b);
+int cmp_sorted_vts(const adj_lst_t *a, const adj_lst_t *b);
+int is_valid_rand(const adj_lst_t *a, int undir);
+int cmp_graph(const graph_t *a, const graph_t *b);
+size_t random_ix(size_t n);
+void print_test_result(int res);
+double timer();
+
+/**
+   Initializes a random graph with n vertices, m edges, and size_t weights
+   if wt_size is nonzero.
+*/
+void rand_graph_init(graph_t *g, size_t n, size_t m, size_t wt_size){
+  size_t i;
+  graph_base_init(g, n, wt_size);
+  g->num_es = m;
+  g->u = malloc_perror(m, sizeof(size_t));
+  g->v = malloc_perror(m, sizeof(size_t));
+  if (wt_size > 0) g->wts = malloc_perror(m, wt_size);
+  for (i = 0; i < m; i++){
+    g->u[i] = random_ix(n);
+    g->v[i] = random_ix(n);
+    if (wt_size > 0) *((size_t *)g->wts + i) = RANDOM();
+  }
+}
+
+/**
+   Runs a test of a multithreaded build on a random graph with 2**log_n
+   vertices and 2**log_m edges, with and without weights, and compares the
+   lists with the lists of a single-threaded build.
+*/
+void build_helper(size_t log_n,
+		  size_t log_m,
+		  size_t num_threads_max,
+		  void (*build)(adj_lst_t *, const graph_t *),
+		  void (*build_pthread)(adj_lst_t *, const graph_t *, size_t)){
+  int res = 1;
+  size_t i, j;
+  size_t wt_sizes[2];
+  double t;
+  graph_t g;
+  adj_lst_t a, a_pthd;
+  wt_sizes[0] = 0;
+  wt_sizes[1] = sizeof(size_t);
+  for (i = 0; i < 2; i++){
+    rand_graph_init(&g, pow_two_perror(log_n), pow_two_perror(log_m),
+		    wt_sizes[i]);
+    printf("\tvertices: %lu, edges: %lu, weight size: %lu\n",
+	   TOLU(g.num_vts), TOLU(g.num_es), TOLU(g.wt_size));
+    t = timer();
+    build(&a, &g);
+    t = timer() - t;
+    printf("\t\tsingle-threaded build:          %.4f seconds\n", t);
+    for (j = 1; j <= num_threads_max; j *= 2){
+      t = timer();
+      build_pthread(&a_pthd, &g, j);
+      t = timer() - t;
+      printf("\t\tbuild with %3lu threads:         %.4f seconds\n",
+	     TOLU(j), t);
+      res *= cmp_adj_lst(&a, &a_pthd);
+      adj_lst_free(&a_pthd);
+    }
+    adj_lst_free(&a);
+    graph_free(&g);
+  }
+  printf("\tcorrectness across all builds --> ");
+  print_test_result(res);
+}
+
+void run_dir_build_test(size_t log_n, size_t log_m, size_t num_threads_max){
+  printf("Test adj_lst_csr_dir_build_pthread on random graphs\n");
+  build_helper(log_n,
+	       log_m,
+	       num_threads_max,
+	       adj_lst_csr_dir_build,
+	       adj_lst_csr_dir_build_pthread);
+}
+
+void run_undir_build_test(size_t log_n,
+			  size_t log_m,
+			  size_t num_threads_max){
+  printf("Test adj_lst_csr_undir_build_pthread on random graphs\n");
+  build_helper(log_n,
+	       log_m,
+	       num_threads_max,
+	       adj_lst_csr_undir_build,
+	       adj_lst_csr_undir_build_pthread);
+}
+
+/**
+   Runs a test of multithreaded builds on graphs with a small number of
+   vertices and edges, including graphs with no vertices or edges, and with
+   more threads than vertices or edges.
+*/
+void run_corner_cases_test(){
+  int res = 1;
+  size_t i, j;
+  graph_t g;
+  adj_lst_t a, a_pthd;
+  for (i = 0; i < C_CORNER_NUM_VTS_MAX; i++){
+    if (i > 0){
+      rand_graph_init(&g, i, i / 2, sizeof(size_t));
+    }else{
+      graph_base_init(&g, 0, sizeof(size_t));
+    }
+    for (j = 1; j <= C_CORNER_NUM_THREADS_MAX; j++){
+      adj_lst_csr_dir_build(&a, &g);
+      adj_lst_csr_dir_build_pthread(&a_pthd, &g, j);
+      res *= cmp_adj_lst(&a, &a_pthd);
+      adj_lst_free(&a);
+      adj_lst_free(&a_pthd);
+      adj_lst_csr_undir_build(&a, &g);
+      adj_lst_csr_undir_build_pthread(&a_pthd, &g, j);
+      res *= cmp_adj_lst(&a, &a_pthd);
+      adj_lst_free(&a);
+      adj_lst_free(&a_pthd);
+    }
+    graph_free(&g);
+  }
+  printf("Test adj_lst_csr_{dir, undir}_build_pthread on corner cases --> ");
+  print_test_result(res);
+}
+
+/**
+   Test adj_lst_rand_{dir, undir}_skip_pthread.
+*/
+
+typedef struct{
+  size_t i;
+} skip_seq_arg_t;
+
+/**
+   Returns the skips in C_SKIPS cyclically.
+*/
+size_t skip_seq(void *arg){
+  skip_seq_arg_t *s = arg;
+  return C_SKIPS[s->i++ % C_SKIPS_COUNT];
+}
+
+/**
+   Returns a constant skip.
+*/
+size_t skip_const(void *arg){
+  return *(size_t *)arg;
+}
+
+typedef struct{
+  double log_q; /* log(1 - p), where 0 < p < 1 */
+  unsigned int seed;
+} geom_arg_t;
+
+/**
+   Returns a geometric random variate as the number of failures before
+   the first success of Bernoulli trials with parameter p, with the
+   generator state of a thread.
+*/
+size_t geom(void *arg){
+  double x;
+  geom_arg_t *g = arg;
+  x = floor(log((rand_r(&g->seed) + 1.0) / (RAND_MAX + 1.0)) / g->log_q);
+  if (x >= (double)C_SIZE_MAX) return C_SIZE_MAX;
+  return x;
+}
+
+/**
+   Runs a test of multithreaded random graph generation on corner cases,
+   and compares the lists with the lists of a single-threaded generation
+   i) with a cyclic sequence of skips and one thread, and ii) with the
+   constant skips of complete graphs and graphs with no edges and upto
+   C_CORNER_NUM_THREADS_MAX threads.
+*/
+void run_rand_corner_cases_test(){
+  int res = 1;
+  size_t i, j, k, undir;
+  size_t *skips = NULL;
+  skip_seq_arg_t sa;
+  adj_lst_t a, a_csr, a_pthd;
+  skips = malloc_perror(C_CORNER_NUM_THREADS_MAX, sizeof(size_t));
+  for (i = 0; i < C_CORNER_NUM_VTS_MAX; i++){
+    for (undir = 0; undir < 2; undir++){
+      sa.i = 0;
+      if (undir){
+	adj_lst_rand_undir_skip(&a, i, skip_seq, &sa);
+      }else{
+	adj_lst_rand_dir_skip(&a, i, skip_seq, &sa);
+      }
+      adj_lst_csr_copy(&a_csr, &a);
+      sa.i = 0;
+      if (undir){
+	adj_lst_rand_undir_skip_pthread(&a_pthd, i, skip_seq, &sa,
+					sizeof(skip_seq_arg_t), 1);
+      }else{
+	adj_lst_rand_dir_skip_pthread(&a_pthd, i, skip_seq, &sa,
+				      sizeof(skip_seq_arg_t), 1);
+      }
+      res *= cmp_adj_lst(&a_csr, &a_pthd);
+      adj_lst_free(&a);
+      adj_lst_free(&a_csr);
+      adj_lst_free(&a_pthd);
+      for (k = 0; k < 2; k++){
+	for (j = 0; j < C_CORNER_NUM_THREADS_MAX; j++){
+	  skips[j] = (k == 0) ? 0 : C_SIZE_MAX;
+	}
+	if (undir){
+	  adj_lst_rand_undir_skip(&a, i, skip_const, skips);
+	}else{
+	  adj_lst_rand_dir_skip(&a, i, skip_const, skips);
+	}
+	adj_lst_csr_copy(&a_csr, &a);
+	for (j = 1; j <= C_CORNER_NUM_THREADS_MAX; j++){
+	  if (undir){
+	    adj_lst_rand_undir_skip_pthread(&a_pthd, i, skip_const, skips,
+					    sizeof(size_t), j);
+	  }else{
+	    adj_lst_rand_dir_skip_pthread(&a_pthd, i, skip_const, skips,
+					  sizeof(size_t), j);
+	  }
+	  res *= cmp_adj_lst(&a_csr, &a_pthd);
+	  adj_lst_free(&a_pthd);
+	}
+	adj_lst_free(&a);
+	adj_lst_free(&a_csr);
+      }
+    }
+  }
+  free(skips);
+  skips = NULL;
+  printf("Test adj_lst_rand_{dir, undir}_skip_pthread on corner cases --> ");
+  print_test_result(res);
+}
+
+/**
+   Runs a test of multithreaded random graph generation on graphs with
+   2**log_n vertices and an expected degree of C_DEG, compares the build
+   times with a single-threaded generation followed by a copy in CSR
+   format, and checks that the lists are sorted and contain no self-loops,
+   and that the lists of an undirected graph are symmetric.
+*/
+void run_rand_test(size_t log_n, size_t num_threads_max){
+  int res = 1;
+  size_t i, j, n, undir;
+  double p, t;
+  geom_arg_t *gas = NULL;
+  adj_lst_t a, a_seq;
+  n = pow_two_perror(log_n);
+  p = (n > 1 && C_DEG < n - 1) ? C_DEG / (n - 1) : 0.5;
+  gas = malloc_perror(num_threads_max, sizeof(geom_arg_t));
+  for (undir = 0; undir < 2; undir++){
+    printf("Test adj_lst_rand_%s_skip_pthread on random graphs\n",
+	   (undir) ? "undir" : "dir");
+    printf("\tvertices: %lu, p: %.6f, expected directed edges: %.1f\n",
+	   TOLU(n), p, p * n * (n - 1));
+    gas[0].log_q = log(1.0 - p);
+    gas[0].seed = RANDOM();
+    t = timer();
+    if (undir){
+      adj_lst_rand_undir_skip(&a_seq, n, geom, gas);
+    }else{
+      adj_lst_rand_dir_skip(&a_seq, n, geom, gas);
+    }
+    adj_lst_csr_copy(&a, &a_seq);
+    t = timer() - t;
+    printf("\t\tsingle-threaded build:  %.4f seconds, "
+	   "directed edges: %lu\n", t, TOLU(a.num_es));
+    res *= is_valid_rand(&a, undir);
+    adj_lst_free(&a_seq);
+    adj_lst_free(&a);
+    for (i = 1; i <= num_threads_max; i *= 2){
+      for (j = 0; j < i; j++){
+	gas[j].log_q = log(1.0 - p);
+	gas[j].seed = RANDOM();
+      }
+      t = timer();
+      if (undir){
+	adj_lst_rand_undir_skip_pthread(&a, n, geom, gas,
+					sizeof(geom_arg_t), i);
+      }else{
+	adj_lst_rand_dir_skip_pthread(&a, n, geom, gas,
+				      sizeof(geom_arg_t), i);
+      }
+      t = timer() - t;
+      printf("\t\tbuild with %3lu threads: %.4f seconds, "
+	     "directed edges: %lu\n", TOLU(i), t, TOLU(a.num_es));
+      res *= is_valid_rand(&a, undir);
+      adj_lst_free(&a);
+    }
+    printf("\tcorrectness across all builds --> ");
+    print_test_result(res);
+  }
+  free(gas);
+  gas = NULL;
+}
+
+/**
+   Test graph_rmat_pthread and graph_chung_lu_pthread.
+*/
+
+typedef struct{
+  double r; /* constant drand value if >= 0.0 */
+  unsigned int seed;
+} gen_arg_t;
+
+double gen_drand(void *arg){
+  gen_arg_t *ga = arg;
+  if (ga->r >= 0.0) return ga->r;
+  return rand_r(&ga->seed) / ((double)RAND_MAX + 1.0);
+}
+
+void gen_rand_wt(void *wt, void *arg){
+  gen_arg_t *ga = arg;
+  *(size_t *)wt = rand_r(&ga->seed);
+}
+
+/**
+   Initializes the arguments of num_threads threads with a constant drand
+   value r if r >= 0.0, and with the same seed.
+*/
+void gen_args_init(gen_arg_t *gas, size_t num_threads, double r){
+  size_t i;
+  unsigned int seed = RANDOM();
+  for (i = 0; i < num_threads; i++){
+    gas[i].r = r;
+    gas[i].seed = seed;
+  }
+}
+
+/**
+   Generates a random graph with the R-MAT or Chung-Lu model with
+   num_threads threads.
+*/
+void gen_pthread(graph_t *g,
+		 size_t log_n,
+		 size_t num_es,
+		 const double *degs,
+		 size_t wt_size,
+		 gen_arg_t *gas,
+		 size_t num_threads){
+  if (degs == NULL){
+    graph_rmat_pthread(g, log_n, num_es, C_RMAT_PROBS[0], C_RMAT_PROBS[1],
+		       C_RMAT_PROBS[2], wt_size, gen_drand, gen_rand_wt,
+		       gas, sizeof(gen_arg_t), num_threads);
+  }else{
+    graph_chung_lu_pthread(g, pow_two_perror(log_n), num_es, degs, wt_size,
+			   gen_drand, gen_rand_wt, gas, sizeof(gen_arg_t),
+			   num_threads);
+  }
+}
+
+/**
+   Runs a test of multithreaded R-MAT and Chung-Lu generation on graphs
+   with 2**log_n vertices and C_GEN_DEG * 2**log_n edges. A single-threaded
+   generation is compared with a generation with one thread and the same
+   seed, and generations with constant drand values are compared across
+   upto num_threads_max threads.
+*/
+void run_gen_test(size_t log_n, size_t num_threads_max){
+  int res = 1;
+  size_t i, j, k, n, num_es;
+  double sum = 0.0, t;
+  double *degs = NULL;
+  unsigned int seed;
+  gen_arg_t ga_seq;
+  gen_arg_t *gas = NULL;
+  graph_t g, g_pthd;
+  n = pow_two_perror(log_n);
+  num_es = C_GEN_DEG * n;
+  degs = malloc_perror(n, sizeof(double));
+  for (i = 0; i < n; i++){
+    degs[i] = pow(i + 1.0, -1.0 / (C_POW_EXP - 1.0));
+    sum += degs[i];
+  }
+  for (i = 0; i < n; i++){
+    degs[i] *= 2.0 * num_es / sum;
+  }
+  gas = malloc_perror(num_threads_max, sizeof(gen_arg_t));
+  for (k = 0; k < 2; k++){
+    printf("Test graph_%s_pthread on random graphs\n",
+	   (k == 0) ? "rmat" : "chung_lu");
+    printf("\tvertices: %lu, edges: %lu\n", TOLU(n), TOLU(num_es));
+    gen_args_init(&ga_seq, 1, -1.0);
+    seed = ga_seq.seed;
+    t = timer();
+    if (k == 0){
+      graph_rmat(&g, log_n, num_es, C_RMAT_PROBS[0], C_RMAT_PROBS[1],
+		 C_RMAT_PROBS[2], sizeof(size_t), gen_drand, gen_rand_wt,
+		 &ga_seq);
+    }else{
+      graph_chung_lu(&g, n, num_es, degs, sizeof(size_t), gen_drand,
+		     gen_rand_wt, &ga_seq);
+    }
+    t = timer() - t;
+    printf("\t\tsingle-threaded generation:    %.4f seconds\n", t);
+    for (i = 1; i <= num_threads_max; i *= 2){
+      gen_args_init(gas, i, -1.0);
+      if (i == 1) gas[0].seed = seed;
+      t = timer();
+      gen_pthread(&g_pthd, log_n, num_es, (k == 0) ? NULL : degs,
+		  sizeof(size_t), gas, i);
+      t = timer() - t;
+      printf("\t\tgeneration with %3lu threads:   %.4f seconds\n",
+	     TOLU(i), t);
+      if (i == 1) res *= cmp_graph(&g, &g_pthd);
+      res *= (g_pthd.num_vts == n && g_pthd.num_es == num_es);
+      for (j = 0; j < num_es; j++){
+	res *= (g_pthd.u[j] < n && g_pthd.v[j] < n);
+      }
+      graph_free(&g_pthd);
+    }
+    graph_free(&g);
+    for (j = 0; j < 4; j++){
+      gen_args_init(gas, 1, C_RMAT_DRANDS[j]);
+      gen_pthread(&g, log_n, num_es, (k == 0) ? NULL : degs, 0, gas, 1);
+      for (i = 2; i <= num_threads_max; i++){
+	gen_args_init(gas, i, C_RMAT_DRANDS[j]);
+	gen_pthread(&g_pthd, log_n, num_es, (k == 0) ? NULL : degs, 0,
+		    gas, i);
+	res *= cmp_graph(&g, &g_pthd);
+	graph_free(&g_pthd);
+      }
+      graph_free(&g);
+    }
+    printf("\tcorrectness across all generations --> ");
+    print_test_result(res);
+  }
+  free(degs);
+  free(gas);
+  degs = NULL;
+  gas = NULL;
+}
+
+/**
+   Runs a test of multithreaded batch insertions and deletions on the
+   adjacency lists of random graphs with 2**log_n vertices and 2**log_m
+   edges, with and without weights, with batches of 2**log_m random edges,
+   and compares the lists with the lists after single-threaded batch
+   updates, including the order of pairs.
+*/
+void batch_helper(size_t log_n,
+		  size_t log_m,
+		  size_t num_threads_max,
+		  int undir){
+  int res = 1;
+  size_t i, j;
+  size_t wt_sizes[2];
+  double t;
+  graph_t g, g_batch;
+  adj_lst_t a, a_pthd;
+  wt_sizes[0] = 0;
+  wt_sizes[1] = sizeof(size_t);
+  for (i = 0; i < 2; i++){
+    rand_graph_init(&g, pow_two_perror(log_n), pow_two_perror(log_m),
+		    wt_sizes[i]);
+    rand_graph_init(&g_batch, pow_two_perror(log_n), pow_two_perror(log_m),
+		    wt_sizes[i]);
+    printf("\tvertices: %lu, edges: %lu, batch edges: %lu, "
+	   "weight size: %lu\n", TOLU(g.num_vts), TOLU(g.num_es),
+	   TOLU(g_batch.num_es), TOLU(g.wt_size));
+    adj_lst_init(&a, &g);
+    if (undir){
+      adj_lst_undir_build(&a, &g);
+    }else{
+      adj_lst_dir_build(&a, &g);
+    }
+    t = timer();
+    adj_lst_insert_batch(&a, &g_batch, undir);
+    t = timer() - t;
+    printf("\t\tsingle-threaded insert:         %.4f seconds\n", t);
+    for (j = 1; j <= num_threads_max; j *= 2){
+      adj_lst_init(&a_pthd, &g);
+      if (undir){
+	adj_lst_undir_build(&a_pthd, &g);
+      }else{
+	adj_lst_dir_build(&a_pthd, &g);
+      }
+      t = timer();
+      adj_lst_insert_batch_pthread(&a_pthd, &g_batch, undir, j);
+      t = timer() - t;
+      printf("\t\tinsert with %3lu threads:        %.4f seconds\n",
+	     TOLU(j), t);
+      res *= cmp_stack_lst(&a, &a_pthd);
+      adj_lst_free(&a_pthd);
+    }
+    for (j = 1; j <= num_threads_max; j *= 2){
+      adj_lst_init(&a_pthd, &g);
+      if (undir){
+	adj_lst_undir_build(&a_pthd, &g);
+      }else{
+	adj_lst_dir_build(&a_pthd, &g);
+      }
+      adj_lst_insert_batch(&a_pthd, &g_batch, undir);
+      t = timer();
+      adj_lst_delete_batch_pthread(&a_pthd, &g_batch, undir, j);
+      t = timer() - t;
+      printf("\t\tdelete with %3lu threads:        %.4f seconds\n",
+	     TOLU(j), t);
+      if (j == 1){
+	adj_lst_delete_batch(&a, &g_batch, undir);
+      }
+      res *= cmp_stack_lst(&a, &a_pthd);
+      adj_lst_free(&a_pthd);
+    }
+    adj_lst_free(&a);
+    graph_free(&g);
+    graph_free(&g_batch);
+  }
+  printf("\tcorrectness across all batches --> ");
+  print_test_result(res);
+}
+
+void run_batch_test(size_t log_n, size_t log_m, size_t num_threads_max){
+  printf("Test adj_lst_insert_batch_pthread and "
+	 "adj_lst_delete_batch_pthread on random directed graphs\n");
+  batch_helper(log_n, log_m, num_threads_max, 0);
+  printf("Test adj_lst_insert_batch_pthread and "
+	 "adj_lst_delete_batch_pthread on random undirected graphs\n");
+  batch_helper(log_n, log_m, num_threads_max, 1);
+}
+
+/**
+   Runs a test of multithreaded sorting of the adjacency lists of random
+   graphs with 2**log_n vertices and 2**log_m edges in both formats, with
+   and without weights, and compares the vertices of the lists with the
+   vertices after single-threaded sorting.
+*/
+void sort_helper(size_t log_n,
+		 size_t log_m,
+		 size_t num_threads_max,
+		 int csr){
+  int res = 1;
+  size_t i, j;
+  size_t wt_sizes[2];
+  double t;
+  graph_t g;
+  adj_lst_t a, a_pthd;
+  wt_sizes[0] = 0;
+  wt_sizes[1] = sizeof(size_t);
+  for (i = 0; i < 2; i++){
+    rand_graph_init(&g, pow_two_perror(log_n), pow_two_perror(log_m),
+		    wt_sizes[i]);
+    printf("\tvertices: %lu, edges: %lu, weight size: %lu\n",
+	   TOLU(g.num_vts), TOLU(g.num_es), TOLU(g.wt_size));
+    if (csr){
+      adj_lst_csr_dir_build(&a, &g);
+    }else{
+      adj_lst_init(&a, &g);
+      adj_lst_dir_build(&a, &g);
+    }
+    t = timer();
+    adj_lst_sort(&a);
+    t = timer() - t;
+    printf("\t\tsingle-threaded sort:           %.4f seconds\n", t);
+    for (j = 1; j <= num_threads_max; j *= 2){
+      if (csr){
+	adj_lst_csr_dir_build(&a_pthd, &g);
+      }else{
+	adj_lst_init(&a_pthd, &g);
+	adj_lst_dir_build(&a_pthd, &g);
+      }
+      t = timer();
+      adj_lst_sort_pthread(&a_pthd, j);
+      t = timer() - t;
+      printf("\t\tsort with %3lu threads:          %.4f seconds\n",
+	     TOLU(j), t);
+      res *= cmp_sorted_vts(&a, &a_pthd);
+      adj_lst_free(&a_pthd);
+    }
+    adj_lst_free(&a);
+    graph_free(&g);
+  }
+  printf("\tcorrectness across all sorts --> ");
+  print_test_result(res);
+}
+
+void run_sort_test(size_t log_n, size_t log_m, size_t num_threads_max){
+  printf("Test adj_lst_sort_pthread on random graphs\n");
+  sort_helper(log_n, log_m, num_threads_max, 0);
+  printf("Test adj_lst_sort_pthread on random graphs in CSR format\n");
+  sort_helper(log_n, log_m, num_threads_max, 1);
+}
+
+/**
+   Auxiliary functions.
+*/
+
+/**
+   Compares two adjacency lists in CSR format, including the order of the
+   vertex weight pairs in each list.
+*/
+int cmp_adj_lst(const adj_lst_t *a, const adj_lst_t *b){
+  int res = 1;
+  res *= (a->num_vts == b->num_vts);
+  res *= (a->num_es == b->num_es);
+  res *= (a->pair_size == b->pair_size);
+  res *= (a->offset == b->offset);
+  if (!res) return res;
+  res *= (memcmp(a->offsets,
+		 b->offsets,
+		 (a->num_vts + 1) * sizeof(size_t)) == 0);
+  res *= (memcmp(a->pairs, b->pairs, a->num_es * a->pair_size) == 0);
+  return res;
+}
+
+/**
+   Compares two adjacency lists that are not in CSR format, including the
+   order of the vertex weight pairs in each list.
+*/
+int cmp_stack_lst(const adj_lst_t *a, const adj_lst_t *b){
+  int res = 1;
+  size_t i;
+  res *= (a->num_vts == b->num_vts);
+  res *= (a->num_es == b->num_es);
+  res *= (a->pair_size == b->pair_size);
+  if (!res) return res;
+  for (i = 0; i < a->num_vts; i++){
+    res *= (a->vt_wts[i]->num_elts == b->vt_wts[i]->num_elts);
+    if (!res) return res;
+    res *= (memcmp(a->vt_wts[i]->elts,
+		   b->vt_wts[i]->elts,
+		   a->vt_wts[i]->num_elts * a->pair_size) == 0);
+  }
+  return res;
+}
+
+/**
+   Compares the vertices of the sorted lists of two adjacency lists in
+   either format, and checks that each list of b is sorted. The order of
+   the pairs of multiple edges, and hence of their weights, is unspecified.
+*/
+int cmp_sorted_vts(const adj_lst_t *a, const adj_lst_t *b){
+  int res = 1;
+  size_t i, j, num;
+  const char *p = NULL, *q = NULL;
+  res *= (a->num_vts == b->num_vts);
+  res *= (a->num_es == b->num_es);
+  res *= (a->pair_size == b->pair_size);
+  for (i = 0; res && i < a->num_vts; i++){
+    num = adj_lst_vt_num_pairs(a, i);
+    res *= (adj_lst_vt_num_pairs(b, i) == num);
+    p = adj_lst_vt_pairs(a, i);
+    q = adj_lst_vt_pairs(b, i);
+    for (j = 0; res && j < num; j++){
+      res *= (*(const size_t *)(p + j * a->pair_size) ==
+	      *(const size_t *)(q + j * b->pair_size));
+      res *= (j == 0 ||
+	      *(const size_t *)(q + (j - 1) * b->pair_size) <=
+	      *(const size_t *)(q + j * b->pair_size));
+    }
+  }
+  return res;
+}
+
+/**
+   Returns 1 if each list of a random graph in CSR format is sorted in
+   strictly ascending order and contains no self-loops, and, if the graph
+   is undirected, if v is in the list of u iff u is in the list of v.
+   Otherwise returns 0.
+*/
+int is_valid_rand(const adj_lst_t *a, int undir){
+  size_t u, v, i, j;
+  const size_t *vts = a->pairs;
+  for (u = 0; u < a->num_vts; u++){
+    for (i = a->offsets[u]; i < a->offsets[u + 1]; i++){
+      v = vts[i];
+      if (v >= a->num_vts || v == u) return 0;
+      if (i > a->offsets[u] && vts[i - 1] >= v) return 0;
+      if (undir){
+	for (j = a->offsets[v]; j < a->offsets[v + 1] && vts[j] < u; j++);
+	if (j == a->offsets[v + 1] || vts[j] != u) return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/**
+   Compares two graphs, including the order of edges and the weights.
+*/
+int cmp_graph(const graph_t *a, const graph_t *b){
+  int res = 1;
+  res *= (a->num_vts == b->num_vts);
+  res *= (a->num_es == b->num_es);
+  res *= (a->wt_size == b->wt_size);
+  if (!res || a->num_es == 0) return res;
+  res *= (memcmp(a->u, b->u, a->num_es * sizeof(size_t)) == 0);
+  res *= (memcmp(a->v, b->v, a->num_es * sizeof(size_t)) == 0);
+  if (a->wt_size > 0){
+    res *= (memcmp(a->wts, b->wts, a->num_es * a->wt_size) == 0);
+  }
+  return res;
+}
+
+/**
+   Returns a random index in [0, n), where n > 0.
+*/
+size_t random_ix(size_t n){
+  size_t ret = 0;
+  size_t rem = n - 1;
+  while (rem > 0){
+    ret = (ret << (CHAR_BIT - 1)) ^ (size_t)RANDOM();
+    rem >>= CHAR_BIT - 1;
+  }
+  return ret % n;
+}
+
+void print_test_result(int res){
+  if (res){
+    printf("SUCCESS\n");
+  }else{
+    printf("FAILURE\n");
+  }
+}
+
+double timer(){
+  struct timeval tm;
+  gettimeofday(&tm, NULL);
+  return tm.tv_sec + tm.tv_usec / 1e6;
+}
+
+int main(int argc, char *argv[]){
+  int i;
+  size_t *args = NULL;
+  RGENS_SEED();
+  if (argc > C_ARGC_MAX){
+    fprintf(stderr, "USAGE:\n%s", C_USAGE);
+    exit(EXIT_FAILURE);
+  }
+  args = malloc_perror(C_ARGC_MAX - 1, sizeof(size_t));
+  memcpy(args, C_ARGS_DEF, (C_ARGC_MAX - 1) * sizeof(size_t));
+  for (i = 1; i < argc; i++){
+    args[i - 1] = atoi(argv[i]);
+  }
+  if (args[0] > C_FULL_BIT / 2 ||
+      args[1] > C_FULL_BIT - 2 ||
+      args[2] < 1 ||
+      args[3] > 1 ||
+      args[4] > 1 ||
+      args[5] > 1 ||
+      args[6] > 1 ||
+      args[7] > 1 ||
+      args[8] > 1 ||
+      args[9] > 1){
+    fprintf(stderr, "USAGE:\n%s", C_USAGE);
+    exit(EXIT_FAILURE);
+  }
+  if (args[3]) run_dir_build_test(args[0], args[1], args[2]);
+  if (args[4]) run_undir_build_test(args[0], args[1], args[2]);
+  if (args[5]) run_corner_cases_test();
+  if (args[6]){
+    run_rand_corner_cases_test();
+    run_rand_test(args[0], args[2]);
+  }
+  if (args[7]) run_gen_test(args[0], args[2]);
+  if (args[8]) run_batch_test(args[0], args[1], args[2]);
+  if (args[9]) run_sort_test(args[0], args[1], args[2]);
+  free(args);
+  args = NULL;
+  return 0;
+}
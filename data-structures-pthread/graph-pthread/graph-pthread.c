@@ -0,0 +1,877 @@
+/**
+   graph-pthread.c
+
+   Functions for building the adjacency list of a graph with generic
+   weights in CSR format with multiple threads.
+
+   The edges of a graph_t are partitioned into num_threads contiguous
+   ranges and the vertices into at most num_threads contiguous blocks of
+   a power of two number of vertices. A build consists of three parallel
+   phases: i) each thread counts the vertex weight pairs of each vertex
+   block in its edge range, ii) after an exclusive prefix sum of the counts
+   in the order of blocks and threads, each thread partitions the pair
+   indices of its edge range by the vertex block of the source, and iii)
+   each thread counts the pairs of each vertex in its vertex block in the
+   offsets array, computes the offsets, and scatters the pairs of its block
+   into the pairs block. No locks or atomic operations are used, and the
+   lists are equal to the lists built by adj_lst_csr_dir_build and
+   adj_lst_csr_undir_build in graph.h, including the order of pairs in
+   each list.
+
+   A build uses an additional block of num_pairs size_t pair indices, where
+   num_pairs is num_es for a directed graph and 2 * num_es for an
+   undirected graph, and O(num_threads**2) size_t counts. The additional
+   memory does not depend on num_vts and is at most the size of the pairs
+   block of the built adjacency list.
+
+   A random graph is generated by partitioning the rows of its possible
+   edges into num_threads contiguous vertex ranges with approximately equal
+   numbers of possible edges. Each thread skips over the possible edges of
+   its range as adj_lst_rand_dir_skip and adj_lst_rand_undir_skip in
+   graph.h with its own skip argument, and pushes the added edges into its
+   own growing edge arrays. The arrays are copied in parallel into a
+   graph_t that is built in CSR format as above. Because the skips are
+   memoryless, restarting the skips at the start of each range does not
+   change the distribution of a graph.
+
+   The edge arrays of a random graph_t according to the R-MAT and Chung-Lu
+   models in graph.h are generated by partitioning the edges into
+   num_threads contiguous ranges, where each thread generates the edges of
+   its range with its own drand and rand_wt argument. The prefix sums of
+   the expected degrees of the Chung-Lu model are computed in two
+   parallel phases over num_threads contiguous vertex ranges.
+
+   A batch of edge insertions or deletions is sorted by mergesort_pthread
+   and the sorted elements are partitioned into num_threads contiguous
+   ranges that are aligned to the boundaries of the elements of a source
+   vertex. Each thread applies its range to the lists of its source
+   vertices with adj_lst_insert_batch_range or adj_lst_delete_batch_range
+   in graph.h without locks.
+
+   The lists of an adjacency list are sorted by neighbor by partitioning
+   the vertices into num_threads contiguous ranges, where each thread
+   sorts the lists of its range with adj_lst_sort_range in graph.h.
+
+   The implementation does not use stdint.h and is portable under C89/C90
+   and C99. The requirements are: i) sizeof(size_t) and the size of a
+   generic weight are powers of two, and ii) pthreads API is available.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "graph-pthread.h"
+#include "graph.h"
+#include "mergesort-pthread.h"
+#include "utilities-mem.h"
+#include "utilities-pthread.h"
+
+typedef struct{
+  size_t e_start; /* edge range */
+  size_t e_end;
+  size_t ix;
+  size_t num_threads;
+  size_t num_blks; /* number of vertex blocks */
+  size_t log_blk; /* log base 2 of the number of vertices in a block */
+  size_t *cnts; /* cnts[t * num_blks + k] of thread t and vertex block k */
+  size_t *blk_starts; /* start of each vertex block in ixs and pairs */
+  size_t *ixs; /* i if directed, else 2 * i + (source is v) of edge i */
+  int undir;
+  const graph_t *g;
+  adj_lst_t *a;
+} build_arg_t;
+
+typedef struct{
+  size_t vt_start; /* row range */
+  size_t vt_end;
+  size_t n;
+  size_t count; /* count of the edge arrays */
+  size_t num_es;
+  size_t e_start; /* start in the edge arrays of a graph */
+  size_t *u;
+  size_t *v;
+  size_t (*skip)(void *);
+  void *arg;
+  int undir;
+  graph_t *g;
+} rand_arg_t;
+
+typedef struct{
+  size_t e_start; /* edge range */
+  size_t e_end;
+  size_t vt_start; /* vertex range of the prefix sums */
+  size_t vt_end;
+  double sum; /* sum of the expected degrees of the vertex range */
+  double a;
+  double b;
+  double c;
+  const double *degs;
+  double *cum_degs;
+  double (*drand)(void *);
+  void (*rand_wt)(void *, void *);
+  void *arg;
+  graph_t *g;
+} gen_arg_t;
+
+typedef struct{
+  size_t start; /* element range aligned to source vertices */
+  size_t end;
+  size_t num; /* number of inserted or deleted pairs */
+  const adj_batch_t *bt;
+  adj_lst_t *a;
+} batch_arg_t;
+
+typedef struct{
+  size_t vt_start; /* vertex range */
+  size_t vt_end;
+  adj_lst_t *a;
+} sort_arg_t;
+
+static const size_t C_FULL_BIT = CHAR_BIT * sizeof(size_t);
+static const size_t C_RAND_INIT_COUNT = 1024;
+static const size_t C_SORT_SBASE_COUNT = 32768;
+static const size_t C_SORT_MBASE_COUNT = 32768;
+
+static void build_pthread(adj_lst_t *a,
+			  const graph_t *g,
+			  size_t num_threads,
+			  int undir);
+static void rand_skip_pthread(adj_lst_t *a,
+			      size_t n,
+			      size_t (*skip)(void *),
+			      void *args,
+			      size_t arg_size,
+			      size_t num_threads,
+			      int undir);
+static gen_arg_t *gen_args_init(graph_t *g,
+				 double (*drand)(void *),
+				 void (*rand_wt)(void *, void *),
+				 void *args,
+				 size_t arg_size,
+				 size_t num_threads);
+static void batch_pthread(adj_lst_t *a,
+			  const graph_t *g,
+			  int undir,
+			  size_t num_threads,
+			  void *(*phase)(void *));
+static void batch_sort(void *elts,
+		       size_t count,
+		       size_t elt_size,
+		       int (*cmp)(const void *, const void *));
+static void run_phase(void *args,
+		      size_t arg_size,
+		      size_t num_threads,
+		      void *(*phase)(void *));
+static void *count_thread(void *arg);
+static void *partition_thread(void *arg);
+static void *block_thread(void *arg);
+static void *rand_thread(void *arg);
+static void *rand_copy_thread(void *arg);
+static void rand_push_edge(rand_arg_t *ra, size_t u, size_t v);
+static void *rmat_thread(void *arg);
+static void *deg_sum_thread(void *arg);
+static void *deg_cum_thread(void *arg);
+static void *chung_lu_thread(void *arg);
+static void *insert_batch_thread(void *arg);
+static void *delete_batch_thread(void *arg);
+static void *sort_thread(void *arg);
+static size_t range_start(size_t n, size_t k, size_t i);
+static size_t tri_range_start(size_t n, size_t k, size_t i);
+
+/**
+   Initializes and builds the immutable adjacency list of a directed graph
+   in CSR format with num_threads threads, including the calling thread.
+   a           : pointer to a preallocated block of size sizeof(adj_lst_t)
+   g           : pointer to a graph previously constructed with at least
+                 graph_base_init
+   num_threads : > 0 number of threads
+*/
+void adj_lst_csr_dir_build_pthread(adj_lst_t *a,
+				   const graph_t *g,
+				   size_t num_threads){
+  build_pthread(a, g, num_threads, 0);
+}
+
+/**
+   Initializes and builds the immutable adjacency list of an undirected
+   graph in CSR format with num_threads threads, including the calling
+   thread.
+*/
+void adj_lst_csr_undir_build_pthread(adj_lst_t *a,
+				     const graph_t *g,
+				     size_t num_threads){
+  build_pthread(a, g, num_threads, 1);
+}
+
+/**
+   Builds the immutable adjacency list of a directed unweighted random
+   graph with n vertices in CSR format with num_threads threads, including
+   the calling thread, in O(n + m) work, where m is the number of added
+   edges. The list of each vertex is sorted in ascending order.
+   a           : pointer to a preallocated block of size sizeof(adj_lst_t)
+   n           : number of vertices
+   skip        : returns the number of consecutive possible edges that are
+                 not added before the next added edge, as specified in
+                 adj_lst_rand_dir_skip; called concurrently with different
+                 arguments
+   args        : pointer to a block of num_threads skip arguments of size
+                 arg_size each, where the ith thread calls skip with
+                 (char *)args + i * arg_size (e.g. a generator state of the
+                 thread)
+   arg_size    : size of a skip argument in bytes
+   num_threads : > 0 number of threads
+*/
+void adj_lst_rand_dir_skip_pthread(adj_lst_t *a,
+				   size_t n,
+				   size_t (*skip)(void *),
+				   void *args,
+				   size_t arg_size,
+				   size_t num_threads){
+  rand_skip_pthread(a, n, skip, args, arg_size, num_threads, 0);
+}
+
+/**
+   Builds the immutable adjacency list of an undirected unweighted random
+   graph with n vertices in CSR format with num_threads threads, including
+   the calling thread, in O(n + m) work. Please see the parameter
+   specification in adj_lst_rand_dir_skip_pthread.
+*/
+void adj_lst_rand_undir_skip_pthread(adj_lst_t *a,
+				     size_t n,
+				     size_t (*skip)(void *),
+				     void *args,
+				     size_t arg_size,
+				     size_t num_threads){
+  rand_skip_pthread(a, n, skip, args, arg_size, num_threads, 1);
+}
+
+/**
+   Initializes a random graph with 2**log_n vertices and num_es edges
+   according to the R-MAT model with num_threads threads, including the
+   calling thread. Please see the parameter specification in graph_rmat in
+   graph.h.
+   args        : pointer to a block of num_threads arguments of drand and
+                 rand_wt of size arg_size each, where the ith thread calls
+                 drand and rand_wt with (char *)args + i * arg_size (e.g. a
+                 generator state of the thread)
+   arg_size    : size of an argument in bytes
+   num_threads : > 0 number of threads
+*/
+void graph_rmat_pthread(graph_t *g,
+			size_t log_n,
+			size_t num_es,
+			double a,
+			double b,
+			double c,
+			size_t wt_size,
+			double (*drand)(void *),
+			void (*rand_wt)(void *, void *),
+			void *args,
+			size_t arg_size,
+			size_t num_threads){
+  size_t i;
+  gen_arg_t *gas = NULL;
+  if (log_n >= CHAR_BIT * sizeof(size_t)){
+    fprintf(stderr, "graph_rmat_pthread: log_n >= # bits in size_t\n");
+    exit(EXIT_FAILURE);
+  }
+  graph_base_init(g, (size_t)1 << log_n, wt_size);
+  graph_es_init(g, num_es);
+  gas = gen_args_init(g, drand, rand_wt, args, arg_size, num_threads);
+  for (i = 0; i < num_threads; i++){
+    gas[i].a = a;
+    gas[i].b = b;
+    gas[i].c = c;
+  }
+  run_phase(gas, sizeof(gen_arg_t), num_threads, rmat_thread);
+  free(gas);
+}
+
+/**
+   Initializes a random graph with n vertices and num_es edges according
+   to the Chung-Lu model with num_threads threads, including the calling
+   thread. Please see the parameter specification in graph_chung_lu in
+   graph.h and in graph_rmat_pthread.
+*/
+void graph_chung_lu_pthread(graph_t *g,
+			    size_t n,
+			    size_t num_es,
+			    const double *degs,
+			    size_t wt_size,
+			    double (*drand)(void *),
+			    void (*rand_wt)(void *, void *),
+			    void *args,
+			    size_t arg_size,
+			    size_t num_threads){
+  size_t i;
+  double c, sum = 0.0;
+  double *cum_degs = NULL;
+  gen_arg_t *gas = NULL;
+  graph_base_init(g, n, wt_size);
+  graph_es_init(g, num_es);
+  if (num_es == 0) return;
+  cum_degs = malloc_perror(n, sizeof(double));
+  gas = gen_args_init(g, drand, rand_wt, args, arg_size, num_threads);
+  for (i = 0; i < num_threads; i++){
+    gas[i].degs = degs;
+    gas[i].cum_degs = cum_degs;
+  }
+  run_phase(gas, sizeof(gen_arg_t), num_threads, deg_sum_thread);
+  for (i = 0; i < num_threads; i++){
+    c = gas[i].sum;
+    gas[i].sum = sum;
+    sum += c;
+  }
+  run_phase(gas, sizeof(gen_arg_t), num_threads, deg_cum_thread);
+  run_phase(gas, sizeof(gen_arg_t), num_threads, chung_lu_thread);
+  free(cum_degs);
+  free(gas);
+}
+
+/**
+   Inserts the edges of a batch graph into an adjacency list that is not
+   in CSR format with num_threads threads, including the calling thread,
+   without rebuilding the adjacency list. The lists are equal to the lists
+   after adj_lst_insert_batch in graph.h, including the order of pairs.
+   a           : pointer to an adjacency list initialized with
+                 adj_lst_init and not in CSR format
+   g           : pointer to a batch graph with the vertices of the
+                 adjacency list; if the adjacency list is weighted, the
+                 batch graph has weights of the same size
+   undir       : nonzero if the edges are undirected, 0 otherwise
+   num_threads : > 0 number of threads
+*/
+void adj_lst_insert_batch_pthread(adj_lst_t *a,
+				  const graph_t *g,
+				  int undir,
+				  size_t num_threads){
+  batch_pthread(a, g, undir, num_threads, insert_batch_thread);
+}
+
+/**
+   Deletes the edges of a batch graph from an adjacency list that is not
+   in CSR format with num_threads threads, including the calling thread,
+   without rebuilding the adjacency list. The lists are equal to the lists
+   after adj_lst_delete_batch in graph.h. Please see
+   adj_lst_insert_batch_pthread for the parameters.
+*/
+void adj_lst_delete_batch_pthread(adj_lst_t *a,
+				  const graph_t *g,
+				  int undir,
+				  size_t num_threads){
+  batch_pthread(a, g, undir, num_threads, delete_batch_thread);
+}
+
+/**
+   Sorts the list of each vertex of an adjacency list in either format by
+   neighbor in ascending order with num_threads threads, including the
+   calling thread, as adj_lst_sort in graph.h.
+   a           : pointer to an adjacency list in either format
+   num_threads : > 0 number of threads
+*/
+void adj_lst_sort_pthread(adj_lst_t *a, size_t num_threads){
+  size_t i;
+  sort_arg_t *sas = NULL;
+  sas = malloc_perror(num_threads, sizeof(sort_arg_t));
+  for (i = 0; i < num_threads; i++){
+    sas[i].vt_start = range_start(a->num_vts, num_threads, i);
+    sas[i].vt_end = range_start(a->num_vts, num_threads, i + 1);
+    sas[i].a = a;
+  }
+  run_phase(sas, sizeof(sort_arg_t), num_threads, sort_thread);
+  free(sas);
+}
+
+/** Helper functions */
+
+/**
+   Builds an adjacency list in CSR format in three parallel phases and a
+   sequential exclusive prefix sum of the num_threads * num_blks counts.
+   The size of a vertex block is the smallest power of two such that the
+   number of blocks is at most num_threads, if representable.
+*/
+static void build_pthread(adj_lst_t *a,
+			  const graph_t *g,
+			  size_t num_threads,
+			  int undir){
+  size_t i, j, c, pos = 0, num_pairs;
+  size_t log_blk = 0, num_blks = 0;
+  size_t *cnts = NULL, *blk_starts = NULL, *ixs = NULL;
+  build_arg_t *bas = NULL;
+  num_pairs = (undir) ? mul_sz_perror(g->num_es, 2) : g->num_es;
+  adj_lst_csr_init(a, g, num_pairs);
+  if (g->num_vts > 0){
+    while (log_blk < C_FULL_BIT - 1 &&
+	   ((g->num_vts - 1) >> log_blk) >= num_threads){
+      log_blk++;
+    }
+    num_blks = ((g->num_vts - 1) >> log_blk) + 1;
+  }
+  cnts = malloc_perror(mul_sz_perror(num_blks, num_threads) + 1,
+		       sizeof(size_t));
+  blk_starts = malloc_perror(num_blks + 1, sizeof(size_t));
+  ixs = malloc_perror(num_pairs + (num_pairs == 0), sizeof(size_t));
+  bas = malloc_perror(num_threads, sizeof(build_arg_t));
+  for (i = 0; i < num_threads; i++){
+    bas[i].e_start = range_start(g->num_es, num_threads, i);
+    bas[i].e_end = range_start(g->num_es, num_threads, i + 1);
+    bas[i].ix = i;
+    bas[i].num_threads = num_threads;
+    bas[i].num_blks = num_blks;
+    bas[i].log_blk = log_blk;
+    bas[i].cnts = cnts;
+    bas[i].blk_starts = blk_starts;
+    bas[i].ixs = ixs;
+    bas[i].undir = undir;
+    bas[i].g = g;
+    bas[i].a = a;
+  }
+  run_phase(bas, sizeof(build_arg_t), num_threads, count_thread);
+  for (j = 0; j < num_blks; j++){
+    blk_starts[j] = pos;
+    for (i = 0; i < num_threads; i++){
+      c = cnts[i * num_blks + j];
+      cnts[i * num_blks + j] = pos;
+      pos += c;
+    }
+  }
+  blk_starts[num_blks] = pos;
+  run_phase(bas, sizeof(build_arg_t), num_threads, partition_thread);
+  run_phase(bas, sizeof(build_arg_t), num_threads, block_thread);
+  a->offsets[a->num_vts] = num_pairs;
+  free(cnts);
+  free(blk_starts);
+  free(ixs);
+  free(bas);
+}
+
+/**
+   Generates the edges of a random graph in a parallel phase, copies the
+   edges into a graph in a parallel phase after a sequential exclusive
+   prefix sum of the num_threads edge counts, and builds the adjacency list
+   of the graph in CSR format.
+*/
+static void rand_skip_pthread(adj_lst_t *a,
+			      size_t n,
+			      size_t (*skip)(void *),
+			      void *args,
+			      size_t arg_size,
+			      size_t num_threads,
+			      int undir){
+  size_t i, num_es = 0;
+  rand_arg_t *ras = NULL;
+  graph_t g;
+  graph_base_init(&g, n, 0);
+  ras = malloc_perror(num_threads, sizeof(rand_arg_t));
+  for (i = 0; i < num_threads; i++){
+    if (undir){
+      ras[i].vt_start = tri_range_start(n, num_threads, i);
+      ras[i].vt_end = tri_range_start(n, num_threads, i + 1);
+    }else{
+      ras[i].vt_start = range_start(n, num_threads, i);
+      ras[i].vt_end = range_start(n, num_threads, i + 1);
+    }
+    ras[i].n = n;
+    ras[i].count = C_RAND_INIT_COUNT;
+    ras[i].num_es = 0;
+    ras[i].e_start = 0;
+    ras[i].u = malloc_perror(ras[i].count, sizeof(size_t));
+    ras[i].v = malloc_perror(ras[i].count, sizeof(size_t));
+    ras[i].skip = skip;
+    ras[i].arg = (char *)args + i * arg_size;
+    ras[i].undir = undir;
+    ras[i].g = &g;
+  }
+  run_phase(ras, sizeof(rand_arg_t), num_threads, rand_thread);
+  for (i = 0; i < num_threads; i++){
+    ras[i].e_start = num_es;
+    num_es = add_sz_perror(num_es, ras[i].num_es);
+  }
+  g.num_es = num_es;
+  g.u = malloc_perror(num_es + 1, sizeof(size_t));
+  g.v = malloc_perror(num_es + 1, sizeof(size_t));
+  run_phase(ras, sizeof(rand_arg_t), num_threads, rand_copy_thread);
+  build_pthread(a, &g, num_threads, undir);
+  graph_free(&g);
+  free(ras);
+}
+
+/**
+   Allocates and initializes the arguments of num_threads threads that
+   generate the edges of num_threads contiguous edge ranges of a graph.
+*/
+static gen_arg_t *gen_args_init(graph_t *g,
+				 double (*drand)(void *),
+				 void (*rand_wt)(void *, void *),
+				 void *args,
+				 size_t arg_size,
+				 size_t num_threads){
+  size_t i;
+  gen_arg_t *gas = NULL;
+  gas = malloc_perror(num_threads, sizeof(gen_arg_t));
+  for (i = 0; i < num_threads; i++){
+    gas[i].e_start = range_start(g->num_es, num_threads, i);
+    gas[i].e_end = range_start(g->num_es, num_threads, i + 1);
+    gas[i].vt_start = range_start(g->num_vts, num_threads, i);
+    gas[i].vt_end = range_start(g->num_vts, num_threads, i + 1);
+    gas[i].sum = 0.0;
+    gas[i].a = 0.0;
+    gas[i].b = 0.0;
+    gas[i].c = 0.0;
+    gas[i].degs = NULL;
+    gas[i].cum_degs = NULL;
+    gas[i].drand = drand;
+    gas[i].rand_wt = rand_wt;
+    gas[i].arg = (char *)args + i * arg_size;
+    gas[i].g = g;
+  }
+  return gas;
+}
+
+/**
+   Sorts a batch in parallel, partitions the sorted elements into
+   num_threads ranges aligned to the boundaries of source vertices, and
+   applies the ranges in a parallel phase.
+*/
+static void batch_pthread(adj_lst_t *a,
+			  const graph_t *g,
+			  int undir,
+			  size_t num_threads,
+			  void *(*phase)(void *)){
+  size_t i, start;
+  adj_batch_t bt;
+  batch_arg_t *bas = NULL;
+  if (g->num_es == 0) return;
+  adj_batch_init(&bt, g, undir, batch_sort);
+  bas = malloc_perror(num_threads, sizeof(batch_arg_t));
+  for (i = 0; i < num_threads; i++){
+    start = range_start(bt.num_elts, num_threads, i);
+    while (start > 0 && start < bt.num_elts &&
+	   bt.elts[start].u == bt.elts[start - 1].u){
+      start++;
+    }
+    bas[i].start = start;
+    if (i > 0) bas[i - 1].end = start;
+    bas[i].num = 0;
+    bas[i].bt = &bt;
+    bas[i].a = a;
+  }
+  bas[num_threads - 1].end = bt.num_elts;
+  run_phase(bas, sizeof(batch_arg_t), num_threads, phase);
+  for (i = 0; i < num_threads; i++){
+    if (phase == insert_batch_thread){
+      a->num_es += bas[i].num;
+    }else{
+      a->num_es -= bas[i].num;
+    }
+  }
+  adj_batch_free(&bt);
+  free(bas);
+}
+
+/**
+   Sorts the elements of a batch with mergesort_pthread, as a sort function
+   with the parameters of qsort.
+*/
+static void batch_sort(void *elts,
+		       size_t count,
+		       size_t elt_size,
+		       int (*cmp)(const void *, const void *)){
+  if (count == 0) return;
+  mergesort_pthread(elts,
+		    count,
+		    elt_size,
+		    C_SORT_SBASE_COUNT,
+		    C_SORT_MBASE_COUNT,
+		    cmp);
+}
+
+/**
+   Runs a phase with num_threads threads, using the calling thread as the
+   first thread, and returns after all threads completed the phase.
+*/
+static void run_phase(void *args,
+		      size_t arg_size,
+		      size_t num_threads,
+		      void *(*phase)(void *)){
+  size_t i;
+  pthread_t *ids = NULL;
+  ids = malloc_perror(num_threads, sizeof(pthread_t));
+  for (i = 1; i < num_threads; i++){
+    thread_create_perror(&ids[i], phase, (char *)args + i * arg_size);
+  }
+  phase(args);
+  for (i = 1; i < num_threads; i++){
+    thread_join_perror(ids[i], NULL);
+  }
+  free(ids);
+}
+
+/**
+   Counts the pairs of each vertex block in the edge range of a thread.
+*/
+static void *count_thread(void *arg){
+  size_t i;
+  build_arg_t *b = arg;
+  size_t *cnts = b->cnts + b->ix * b->num_blks;
+  if (b->num_blks > 0) memset(cnts, 0, b->num_blks * sizeof(size_t));
+  for (i = b->e_start; i < b->e_end; i++){
+    cnts[b->g->u[i] >> b->log_blk]++;
+    if (b->undir) cnts[b->g->v[i] >> b->log_blk]++;
+  }
+  return NULL;
+}
+
+/**
+   Copies the pair indices of the edge range of a thread into the vertex
+   blocks of their sources in ixs, starting at the start positions of the
+   thread in cnts. Within a block, the indices are in the order of edges.
+*/
+static void *partition_thread(void *arg){
+  size_t i;
+  build_arg_t *b = arg;
+  const graph_t *g = b->g;
+  size_t *pos = b->cnts + b->ix * b->num_blks;
+  for (i = b->e_start; i < b->e_end; i++){
+    if (b->undir){
+      b->ixs[pos[g->u[i] >> b->log_blk]++] = 2 * i;
+      b->ixs[pos[g->v[i] >> b->log_blk]++] = 2 * i + 1;
+    }else{
+      b->ixs[pos[g->u[i] >> b->log_blk]++] = i;
+    }
+  }
+  return NULL;
+}
+
+/**
+   Builds the lists of the vertex blocks ix, ix + num_threads, ... of a
+   thread. The pairs of each vertex are counted in the offsets array, the
+   offsets are set to the start positions of the lists, and the pairs are
+   scattered by incrementing the offsets, which are then shifted back to
+   the start positions.
+*/
+static void *block_thread(void *arg){
+  size_t i, j, k, c, pos, src, dst;
+  size_t vt_start, vt_end, blk_size;
+  char *p = NULL;
+  build_arg_t *b = arg;
+  const graph_t *g = b->g;
+  adj_lst_t *a = b->a;
+  size_t *offsets = a->offsets;
+  blk_size = (size_t)1 << b->log_blk;
+  for (k = b->ix; k < b->num_blks; k += b->num_threads){
+    vt_start = k << b->log_blk;
+    vt_end = (g->num_vts - vt_start > blk_size) ?
+      vt_start + blk_size : g->num_vts;
+    for (j = vt_start; j < vt_end; j++){
+      offsets[j] = 0;
+    }
+    for (j = b->blk_starts[k]; j < b->blk_starts[k + 1]; j++){
+      i = (b->undir) ? b->ixs[j] >> 1 : b->ixs[j];
+      offsets[(b->undir && (b->ixs[j] & 1)) ? g->v[i] : g->u[i]]++;
+    }
+    pos = b->blk_starts[k];
+    for (j = vt_start; j < vt_end; j++){
+      c = offsets[j];
+      offsets[j] = pos;
+      pos += c;
+    }
+    for (j = b->blk_starts[k]; j < b->blk_starts[k + 1]; j++){
+      if (b->undir && (b->ixs[j] & 1)){
+	i = b->ixs[j] >> 1;
+	src = g->v[i];
+	dst = g->u[i];
+      }else{
+	i = (b->undir) ? b->ixs[j] >> 1 : b->ixs[j];
+	src = g->u[i];
+	dst = g->v[i];
+      }
+      p = (char *)a->pairs + offsets[src]++ * a->pair_size;
+      memcpy(p, &dst, sizeof(size_t));
+      if (a->wt_size > 0){
+	memcpy(p + a->offset, (char *)g->wts + i * g->wt_size, a->wt_size);
+      }
+    }
+    for (j = vt_end - 1; j > vt_start; j--){
+      offsets[j] = offsets[j - 1];
+    }
+    offsets[vt_start] = b->blk_starts[k];
+  }
+  return NULL;
+}
+
+/**
+   Skips over the possible edges of the row range of a thread and pushes
+   the added edges into the edge arrays of the thread. The remaining skip
+   is carried across rows without overflow.
+*/
+static void *rand_thread(void *arg){
+  size_t u, v, k = 0, len, s;
+  rand_arg_t *r = arg;
+  size_t n = r->n;
+  u = r->vt_start;
+  if (u == r->vt_end) return NULL;
+  s = r->skip(r->arg);
+  while (1){
+    len = (r->undir) ? n - 1 - u : n - 1;
+    while (s >= len - k){
+      s -= len - k;
+      k = 0;
+      u++;
+      if (u == r->vt_end) return NULL;
+      len = (r->undir) ? n - 1 - u : n - 1;
+    }
+    k += s;
+    if (r->undir){
+      v = u + 1 + k;
+    }else{
+      v = (k < u) ? k : k + 1;
+    }
+    rand_push_edge(r, u, v);
+    k++;
+    s = r->skip(r->arg);
+  }
+  return NULL;
+}
+
+/**
+   Copies the edge arrays of a thread into the edge arrays of a graph and
+   frees the edge arrays of the thread.
+*/
+static void *rand_copy_thread(void *arg){
+  rand_arg_t *r = arg;
+  if (r->num_es > 0){
+    memcpy(r->g->u + r->e_start, r->u, r->num_es * sizeof(size_t));
+    memcpy(r->g->v + r->e_start, r->v, r->num_es * sizeof(size_t));
+  }
+  free(r->u);
+  free(r->v);
+  r->u = NULL;
+  r->v = NULL;
+  return NULL;
+}
+
+/**
+   Pushes an edge into the edge arrays of a thread, doubling the count of
+   the arrays if necessary.
+*/
+static void rand_push_edge(rand_arg_t *r, size_t u, size_t v){
+  if (r->num_es == r->count){
+    r->count = mul_sz_perror(r->count, 2);
+    r->u = realloc_perror(r->u, r->count, sizeof(size_t));
+    r->v = realloc_perror(r->v, r->count, sizeof(size_t));
+  }
+  r->u[r->num_es] = u;
+  r->v[r->num_es] = v;
+  r->num_es++;
+}
+
+/**
+   Generates the R-MAT edges of the edge range of a thread.
+*/
+static void *rmat_thread(void *arg){
+  gen_arg_t *ga = arg;
+  graph_rmat_range(ga->g, ga->e_start, ga->e_end, ga->a, ga->b, ga->c,
+		   ga->drand, ga->rand_wt, ga->arg);
+  return NULL;
+}
+
+/**
+   Sums the expected degrees of the vertex range of a thread.
+*/
+static void *deg_sum_thread(void *arg){
+  size_t i;
+  gen_arg_t *ga = arg;
+  for (i = ga->vt_start; i < ga->vt_end; i++){
+    ga->sum += ga->degs[i];
+  }
+  return NULL;
+}
+
+/**
+   Sets the inclusive prefix sums of the expected degrees of the vertex
+   range of a thread, starting at the exclusive prefix sum in ga->sum.
+*/
+static void *deg_cum_thread(void *arg){
+  size_t i;
+  double sum;
+  gen_arg_t *ga = arg;
+  sum = ga->sum;
+  for (i = ga->vt_start; i < ga->vt_end; i++){
+    sum += ga->degs[i];
+    ga->cum_degs[i] = sum;
+  }
+  return NULL;
+}
+
+/**
+   Generates the Chung-Lu edges of the edge range of a thread.
+*/
+static void *chung_lu_thread(void *arg){
+  gen_arg_t *ga = arg;
+  graph_chung_lu_range(ga->g, ga->e_start, ga->e_end, ga->cum_degs,
+		       ga->drand, ga->rand_wt, ga->arg);
+  return NULL;
+}
+
+/**
+   Inserts the edges of the batch range of a thread.
+*/
+static void *insert_batch_thread(void *arg){
+  batch_arg_t *b = arg;
+  b->num = adj_lst_insert_batch_range(b->a, b->bt, b->start, b->end);
+  return NULL;
+}
+
+/**
+   Deletes the edges of the batch range of a thread.
+*/
+static void *delete_batch_thread(void *arg){
+  batch_arg_t *b = arg;
+  b->num = adj_lst_delete_batch_range(b->a, b->bt, b->start, b->end);
+  return NULL;
+}
+
+/**
+   Sorts the lists of the vertex range of a thread.
+*/
+static void *sort_thread(void *arg){
+  sort_arg_t *sa = arg;
+  adj_lst_sort_range(sa->a, sa->vt_start, sa->vt_end);
+  return NULL;
+}
+
+/**
+   Returns the start of the ith of k contiguous ranges that partition
+   [0, n), where the first n % k ranges have an additional element.
+*/
+static size_t range_start(size_t n, size_t k, size_t i){
+  size_t q = n / k, r = n % k;
+  return i * q + ((i < r) ? i : r);
+}
+
+/**
+   Returns the start of the ith of k contiguous ranges that partition the
+   rows [0, n - 1) of the possible edges (u, v), where u < v, of an
+   undirected graph, such that the ranges have approximately equal numbers
+   of possible edges. The row of u has n - 1 - u possible edges.
+*/
+static size_t tri_range_start(size_t n, size_t k, size_t i){
+  size_t lo = 0, hi, mid;
+  double target;
+  if (n < 2) return 0;
+  hi = n - 1;
+  if (i >= k) return hi;
+  target = (double)n * (n - 1) / 2.0 * i / k;
+  while (lo < hi){
+    mid = lo + (hi - lo) / 2;
+    /* number of possible edges in the rows [0, mid) */
+    if ((double)mid * (n - 1) - (double)mid * (mid - 1.0) / 2.0 < target){
+      lo = mid + 1;
+    }else{
+      hi = mid;
+    }
+  }
+  return lo;
+}
@@ -0,0 +1,206 @@
+/**
+   graph-pthread.h
+
+   Declarations of accessible functions for building the adjacency list of
+   a graph with generic weights in CSR format with multiple threads.
+
+   The edges of a graph_t are partitioned into num_threads contiguous
+   ranges and the vertices into at most num_threads contiguous blocks of
+   a power of two number of vertices. A build consists of three parallel
+   phases: i) each thread counts the vertex weight pairs of each vertex
+   block in its edge range, ii) after an exclusive prefix sum of the counts
+   in the order of blocks and threads, each thread partitions the pair
+   indices of its edge range by the vertex block of the source, and iii)
+   each thread counts the pairs of each vertex in its vertex block in the
+   offsets array, computes the offsets, and scatters the pairs of its block
+   into the pairs block. No locks or atomic operations are used, and the
+   lists are equal to the lists built by adj_lst_csr_dir_build and
+   adj_lst_csr_undir_build in graph.h, including the order of pairs in
+   each list.
+
+   A build uses an additional block of num_pairs size_t pair indices, where
+   num_pairs is num_es for a directed graph and 2 * num_es for an
+   undirected graph, and O(num_threads**2) size_t counts. The additional
+   memory does not depend on num_vts and is at most the size of the pairs
+   block of the built adjacency list.
+
+   A random graph is generated by partitioning the rows of its possible
+   edges into num_threads contiguous vertex ranges with approximately equal
+   numbers of possible edges. Each thread skips over the possible edges of
+   its range as adj_lst_rand_dir_skip and adj_lst_rand_undir_skip in
+   graph.h with its own skip argument, and pushes the added edges into its
+   own growing edge arrays. The arrays are copied in parallel into a
+   graph_t that is built in CSR format as above. Because the skips are
+   memoryless, restarting the skips at the start of each range does not
+   change the distribution of a graph.
+
+   The edge arrays of a random graph_t according to the R-MAT and Chung-Lu
+   models in graph.h are generated by partitioning the edges into
+   num_threads contiguous ranges, where each thread generates the edges of
+   its range with its own drand and rand_wt argument. The prefix sums of
+   the expected degrees of the Chung-Lu model are computed in two
+   parallel phases over num_threads contiguous vertex ranges.
+
+   A batch of edge insertions or deletions is sorted by mergesort_pthread
+   and the sorted elements are partitioned into num_threads contiguous
+   ranges that are aligned to the boundaries of the elements of a source
+   vertex. Each thread applies its range to the lists of its source
+   vertices with adj_lst_insert_batch_range or adj_lst_delete_batch_range
+   in graph.h without locks.
+
+   The lists of an adjacency list are sorted by neighbor by partitioning
+   the vertices into num_threads contiguous ranges, where each thread
+   sorts the lists of its range with adj_lst_sort_range in graph.h.
+
+   The implementation does not use stdint.h and is portable under C89/C90
+   and C99. The requirements are: i) sizeof(size_t) and the size of a
+   generic weight are powers of two, and ii) pthreads API is available.
+*/
+
+#ifndef GRAPH_PTHREAD_H
+#define GRAPH_PTHREAD_H
+
+#include <stddef.h>
+#include "graph.h"
+
+/**
+   Initializes and builds the immutable adjacency list of a directed graph
+   in CSR format with num_threads threads, including the calling thread.
+   a           : pointer to a preallocated block of size sizeof(adj_lst_t)
+   g           : pointer to a graph previously constructed with at least
+                 graph_base_init
+   num_threads : > 0 number of threads
+*/
+void adj_lst_csr_dir_build_pthread(adj_lst_t *a,
+				   const graph_t *g,
+				   size_t num_threads);
+
+/**
+   Initializes and builds the immutable adjacency list of an undirected
+   graph in CSR format with num_threads threads, including the calling
+   thread.
+*/
+void adj_lst_csr_undir_build_pthread(adj_lst_t *a,
+				     const graph_t *g,
+				     size_t num_threads);
+
+/**
+   Builds the immutable adjacency list of a directed unweighted random
+   graph with n vertices in CSR format with num_threads threads, including
+   the calling thread, in O(n + m) work, where m is the number of added
+   edges. The list of each vertex is sorted in ascending order.
+   a           : pointer to a preallocated block of size sizeof(adj_lst_t)
+   n           : number of vertices
+   skip        : returns the number of consecutive possible edges that are
+                 not added before the next added edge, as specified in
+                 adj_lst_rand_dir_skip; called concurrently with different
+                 arguments
+   args        : pointer to a block of num_threads skip arguments of size
+                 arg_size each, where the ith thread calls skip with
+                 (char *)args + i * arg_size (e.g. a generator state of the
+                 thread)
+   arg_size    : size of a skip argument in bytes
+   num_threads : > 0 number of threads
+*/
+void adj_lst_rand_dir_skip_pthread(adj_lst_t *a,
+				   size_t n,
+				   size_t (*skip)(void *),
+				   void *args,
+				   size_t arg_size,
+				   size_t num_threads);
+
+/**
+   Builds the immutable adjacency list of an undirected unweighted random
+   graph with n vertices in CSR format with num_threads threads, including
+   the calling thread, in O(n + m) work. Please see the parameter
+   specification in adj_lst_rand_dir_skip_pthread.
+*/
+void adj_lst_rand_undir_skip_pthread(adj_lst_t *a,
+				     size_t n,
+				     size_t (*skip)(void *),
+				     void *args,
+				     size_t arg_size,
+				     size_t num_threads);
+
+/**
+   Initializes a random graph with 2**log_n vertices and num_es edges
+   according to the R-MAT model with num_threads threads, including the
+   calling thread. Please see the parameter specification in graph_rmat in
+   graph.h.
+   args        : pointer to a block of num_threads arguments of drand and
+                 rand_wt of size arg_size each, where the ith thread calls
+                 drand and rand_wt with (char *)args + i * arg_size (e.g. a
+                 generator state of the thread)
+   arg_size    : size of an argument in bytes
+   num_threads : > 0 number of threads
+*/
+void graph_rmat_pthread(graph_t *g,
+			size_t log_n,
+			size_t num_es,
+			double a,
+			double b,
+			double c,
+			size_t wt_size,
+			double (*drand)(void *),
+			void (*rand_wt)(void *, void *),
+			void *args,
+			size_t arg_size,
+			size_t num_threads);
+
+/**
+   Initializes a random graph with n vertices and num_es edges according
+   to the Chung-Lu model with num_threads threads, including the calling
+   thread. Please see the parameter specification in graph_chung_lu in
+   graph.h and in graph_rmat_pthread.
+*/
+void graph_chung_lu_pthread(graph_t *g,
+			    size_t n,
+			    size_t num_es,
+			    const double *degs,
+			    size_t wt_size,
+			    double (*drand)(void *),
+			    void (*rand_wt)(void *, void *),
+			    void *args,
+			    size_t arg_size,
+			    size_t num_threads);
+
+/**
+   Inserts the edges of a batch graph into an adjacency list that is not
+   in CSR format with num_threads threads, including the calling thread,
+   without rebuilding the adjacency list. The lists are equal to the lists
+   after adj_lst_insert_batch in graph.h, including the order of pairs.
+   a           : pointer to an adjacency list initialized with
+                 adj_lst_init and not in CSR format
+   g           : pointer to a batch graph with the vertices of the
+                 adjacency list; if the adjacency list is weighted, the
+                 batch graph has weights of the same size
+   undir       : nonzero if the edges are undirected, 0 otherwise
+   num_threads : > 0 number of threads
+*/
+void adj_lst_insert_batch_pthread(adj_lst_t *a,
+				  const graph_t *g,
+				  int undir,
+				  size_t num_threads);
+
+/**
+   Deletes the edges of a batch graph from an adjacency list that is not
+   in CSR format with num_threads threads, including the calling thread,
+   without rebuilding the adjacency list. The lists are equal to the lists
+   after adj_lst_delete_batch in graph.h. Please see
+   adj_lst_insert_batch_pthread for the parameters.
+*/
+void adj_lst_delete_batch_pthread(adj_lst_t *a,
+				  const graph_t *g,
+				  int undir,
+				  size_t num_threads);
+
+/**
+   Sorts the list of each vertex of an adjacency list in either format by
+   neighbor in ascending order with num_threads threads, including the
+   calling thread, as adj_lst_sort in graph.h.
+   a           : pointer to an adjacency list in either format
+   num_threads : > 0 number of threads
+*/
+void adj_lst_sort_pthread(adj_lst_t *a, size_t num_threads);
+
+#endif
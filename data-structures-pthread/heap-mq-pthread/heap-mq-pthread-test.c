@@ -0,0 +1,447 @@
+/**
+   heap-mq-pthread-test.c
+
+   Tests of a relaxed (min) priority queue with generic priorities and
+   generic elements that is concurrently accessible and modifiable.
+
+   The following command line arguments can be used to customize tests:
+   heap-mq-pthread-test
+      [0, # bits in size_t - 1) : i s.t. # inserts = 2**i
+      > 0 : # threads
+      > 0 : # heaps
+      [0, 1] : on/off push pop uint test
+      [0, 1] : on/off lazy decrease uint test
+      [0, 1] : on/off single heap order uint test
+
+   usage examples:
+   ./heap-mq-pthread-test
+   ./heap-mq-pthread-test 20
+   ./heap-mq-pthread-test 20 8 32
+   ./heap-mq-pthread-test 20 8 32 0 1 0
+
+   heap-mq-pthread-test can be run with any subset of command line
+   arguments in the above-defined order. If the (i + 1)th argument is
+   specified then the ith argument must be specified for i >= 0. Default
+   values are used for the unspecified arguments according to the
+   C_ARGS_DEF array.
+
+   The implementation of tests does not use stdint.h and is portable under
+   C89/C90 and C99. The requirements are: i) CHAR_BIT * sizeof(size_t) is
+   greater or equal to 16 and is even, and ii) pthreads API is available.
+*/
+
+#define _XOPEN_SOURCE 600
+
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <sys/time.h>
+#include "heap-mq-pthread.h"
+#include "utilities-mem.h"
+#include "utilities-mod.h"
+#include "utilities-pthread.h"
+
+/**
+   Generate random numbers in a portable way for test purposes only; rand()
+   in the Linux C Library uses the same generator as random(), which may not
+   be the case on older rand() implementations, and on current
+   implementations on different systems.
+*/
+#define RGENS_SEED() do{srand(time(NULL));}while (0)
+#define RANDOM() (rand()) /* [0, RAND_MAX] */
+
+#define TOLU(i) ((unsigned long int)(i)) /* printing size_t under C89/C90 */
+
+/* input handling */
+const char *C_USAGE =
+  "heap-mq-pthread-test\n"
+  "[0, # bits in size_t - 1) : i s.t. # inserts = 2**i\n"
+  "> 0 : # threads\n"
+  "> 0 : # heaps\n"
+  "[0, 1] : on/off push pop uint test\n"
+  "[0, 1] : on/off lazy decrease uint test\n"
+  "[0, 1] : on/off single heap order uint test\n";
+const int C_ARGC_MAX = 7;
+const size_t C_ARGS_DEF[6] = {14, 4, 16, 1, 1, 1};
+const size_t C_FULL_BIT = CHAR_BIT * sizeof(size_t);
+
+/* tests */
+const size_t C_INIT_COUNT = 1;
+const size_t C_PTY_HIGH = (size_t)-1 >> 1;
+
+int cmp_uint(const void *a, const void *b);
+size_t random_range(size_t high);
+void print_test_result(int res);
+double timer();
+
+/**
+   Concurrent push and pop operations. Each thread pushes a contiguous
+   segment of elements, and pops elements until the queue is found empty.
+   The popped priority values and elements are appended to arrays of a
+   thread.
+*/
+
+typedef struct{
+  size_t start;
+  size_t count;
+  unsigned int seed;
+  size_t num_popped;
+  size_t popped_count;
+  size_t *popped_ptys;
+  size_t *popped_elts;
+  const size_t *ptys;
+  heap_mq_pthread_t *mq;
+} mq_arg_t;
+
+void *push_thread(void *arg){
+  size_t i;
+  mq_arg_t *ma = arg;
+  for (i = ma->start; i < ma->start + ma->count; i++){
+    heap_mq_pthread_push(ma->mq, &ma->ptys[i], &i, &ma->seed);
+  }
+  return NULL;
+}
+
+void *pop_thread(void *arg){
+  size_t pty, elt;
+  mq_arg_t *ma = arg;
+  while (heap_mq_pthread_pop(ma->mq, &pty, &elt, &ma->seed)){
+    if (ma->num_popped == ma->popped_count){
+      ma->popped_count = mul_sz_perror(2, ma->popped_count);
+      ma->popped_ptys = realloc_perror(ma->popped_ptys,
+				       ma->popped_count,
+				       sizeof(size_t));
+      ma->popped_elts = realloc_perror(ma->popped_elts,
+				       ma->popped_count,
+				       sizeof(size_t));
+    }
+    ma->popped_ptys[ma->num_popped] = pty;
+    ma->popped_elts[ma->num_popped] = elt;
+    ma->num_popped++;
+  }
+  return NULL;
+}
+
+/**
+   Runs a thread routine in num_threads threads, including the parent
+   thread, and returns the elapsed time.
+*/
+double run_threads(void *(*routine)(void *),
+		   mq_arg_t *mas,
+		   size_t num_threads){
+  size_t i;
+  double t;
+  pthread_t *ids = NULL;
+  ids = malloc_perror(num_threads, sizeof(pthread_t));
+  t = timer();
+  for (i = 1; i < num_threads; i++){
+    thread_create_perror(&ids[i], routine, &mas[i]);
+  }
+  /* use the parent thread as well */
+  routine(&mas[0]);
+  for (i = 1; i < num_threads; i++){
+    thread_join_perror(ids[i], NULL);
+  }
+  t = timer() - t;
+  free(ids);
+  ids = NULL;
+  return t;
+}
+
+/**
+   Initializes the thread arguments with contiguous segments of count
+   elements distributed among num_threads threads.
+*/
+mq_arg_t *init_args(heap_mq_pthread_t *mq,
+		    const size_t *ptys,
+		    size_t count,
+		    size_t num_threads){
+  size_t i, seg_count, rem_count, start = 0;
+  mq_arg_t *mas = NULL;
+  mas = malloc_perror(num_threads, sizeof(mq_arg_t));
+  seg_count = count / num_threads;
+  rem_count = count % num_threads; /* distribute among threads */
+  for (i = 0; i < num_threads; i++){
+    mas[i].start = start;
+    mas[i].count = seg_count;
+    if (rem_count > 0){
+      mas[i].count++;
+      rem_count--;
+    }
+    mas[i].seed = RANDOM();
+    mas[i].num_popped = 0;
+    mas[i].popped_count = 1;
+    mas[i].popped_ptys = malloc_perror(1, sizeof(size_t));
+    mas[i].popped_elts = malloc_perror(1, sizeof(size_t));
+    mas[i].ptys = ptys;
+    mas[i].mq = mq;
+    start += mas[i].count;
+  }
+  return mas;
+}
+
+void free_args(mq_arg_t *mas, size_t num_threads){
+  size_t i;
+  for (i = 0; i < num_threads; i++){
+    free(mas[i].popped_ptys);
+    free(mas[i].popped_elts);
+    mas[i].popped_ptys = NULL;
+    mas[i].popped_elts = NULL;
+  }
+  free(mas);
+}
+
+/**
+   Run heap_mq_pthread_{push, pop} test on size_t elements and random
+   size_t priority values. Each element is pushed once and is tested to
+   be popped exactly once with its priority value.
+*/
+void run_push_pop_uint_test(size_t log_ins,
+			    size_t num_threads,
+			    size_t num_qs){
+  int res = 1;
+  size_t i, j, n, num_popped = 0;
+  size_t *ptys = NULL;
+  char *popped = NULL;
+  double t_push, t_pop;
+  mq_arg_t *mas = NULL;
+  heap_mq_pthread_t mq;
+  n = pow_two_perror(log_ins);
+  ptys = malloc_perror(n, sizeof(size_t));
+  popped = calloc_perror(n, sizeof(char));
+  for (i = 0; i < n; i++){
+    ptys[i] = random_range(C_PTY_HIGH);
+  }
+  printf("Run heap_mq_pthread_{push, pop} test on size_t elements\n"
+	 "\tnumber of elements: %lu, threads: %lu, heaps: %lu\n",
+	 TOLU(n), TOLU(num_threads), TOLU(num_qs));
+  heap_mq_pthread_init(&mq,
+		       num_qs,
+		       C_INIT_COUNT,
+		       sizeof(size_t),
+		       sizeof(size_t),
+		       cmp_uint,
+		       NULL);
+  mas = init_args(&mq, ptys, n, num_threads);
+  t_push = run_threads(push_thread, mas, num_threads);
+  t_pop = run_threads(pop_thread, mas, num_threads);
+  for (i = 0; i < num_threads; i++){
+    for (j = 0; j < mas[i].num_popped; j++){
+      res *= (!popped[mas[i].popped_elts[j]] &&
+	      mas[i].popped_ptys[j] == ptys[mas[i].popped_elts[j]]);
+      popped[mas[i].popped_elts[j]] = 1;
+    }
+    num_popped += mas[i].num_popped;
+  }
+  res *= (num_popped == n);
+  heap_mq_pthread_free(&mq);
+  printf("\t\tpush time:                                   "
+	 "%.4f seconds\n", t_push);
+  printf("\t\tpop time:                                    "
+	 "%.4f seconds\n", t_pop);
+  printf("\t\tcorrectness:                                 ");
+  print_test_result(res);
+  free_args(mas, num_threads);
+  free(ptys);
+  free(popped);
+  mas = NULL;
+  ptys = NULL;
+  popped = NULL;
+}
+
+/**
+   Run a test of decrease-key operations by pushing each size_t element
+   twice, with a random priority value and with a lesser priority value,
+   and by discarding stale elements after popping (lazy deletion). Each
+   element is tested to be popped exactly once with its current priority
+   value.
+*/
+void run_lazy_decrease_uint_test(size_t log_ins,
+				 size_t num_threads,
+				 size_t num_qs){
+  int res = 1;
+  size_t i, j, n, elt, num_popped = 0, num_stale = 0;
+  size_t *ptys = NULL;
+  char *popped = NULL;
+  double t_push, t_pop;
+  mq_arg_t *mas = NULL;
+  heap_mq_pthread_t mq;
+  n = pow_two_perror(log_ins);
+  ptys = malloc_perror(n, sizeof(size_t));
+  popped = calloc_perror(n, sizeof(char));
+  for (i = 0; i < n; i++){
+    ptys[i] = 1 + random_range(C_PTY_HIGH - 1);
+  }
+  printf("Run heap_mq_pthread_{push, pop} test with lazy decrease\n"
+	 "\tnumber of elements: %lu, threads: %lu, heaps: %lu\n",
+	 TOLU(n), TOLU(num_threads), TOLU(num_qs));
+  heap_mq_pthread_init(&mq,
+		       num_qs,
+		       C_INIT_COUNT,
+		       sizeof(size_t),
+		       sizeof(size_t),
+		       cmp_uint,
+		       NULL);
+  mas = init_args(&mq, ptys, n, num_threads);
+  t_push = run_threads(push_thread, mas, num_threads);
+  for (i = 0; i < n; i++){
+    ptys[i] = random_range(ptys[i] - 1);
+  }
+  t_push += run_threads(push_thread, mas, num_threads);
+  t_pop = run_threads(pop_thread, mas, num_threads);
+  for (i = 0; i < num_threads; i++){
+    for (j = 0; j < mas[i].num_popped; j++){
+      elt = mas[i].popped_elts[j];
+      if (mas[i].popped_ptys[j] == ptys[elt]){
+	res *= !popped[elt];
+	popped[elt] = 1;
+	num_popped++;
+      }else{
+	res *= (mas[i].popped_ptys[j] > ptys[elt]);
+	num_stale++;
+      }
+    }
+  }
+  res *= (num_popped == n && num_stale == n);
+  heap_mq_pthread_free(&mq);
+  printf("\t\tpush decrease time:                          "
+	 "%.4f seconds\n", t_push);
+  printf("\t\tpop time:                                    "
+	 "%.4f seconds\n", t_pop);
+  printf("\t\tcorrectness:                                 ");
+  print_test_result(res);
+  free_args(mas, num_threads);
+  free(ptys);
+  free(popped);
+  mas = NULL;
+  ptys = NULL;
+  popped = NULL;
+}
+
+/**
+   Run a test of concurrent push operations followed by pop operations in
+   a single thread on a queue with a single heap. The popped priority
+   values are tested to be in a nondecreasing order.
+*/
+void run_single_heap_order_uint_test(size_t log_ins, size_t num_threads){
+  int res = 1;
+  size_t i, n;
+  size_t *ptys = NULL;
+  double t_push, t_pop;
+  mq_arg_t *mas = NULL;
+  heap_mq_pthread_t mq;
+  n = pow_two_perror(log_ins);
+  ptys = malloc_perror(n, sizeof(size_t));
+  for (i = 0; i < n; i++){
+    ptys[i] = random_range(C_PTY_HIGH);
+  }
+  printf("Run heap_mq_pthread_{push, pop} test on a single heap\n"
+	 "\tnumber of elements: %lu, threads: %lu, heaps: 1\n",
+	 TOLU(n), TOLU(num_threads));
+  heap_mq_pthread_init(&mq,
+		       1,
+		       C_INIT_COUNT,
+		       sizeof(size_t),
+		       sizeof(size_t),
+		       cmp_uint,
+		       NULL);
+  mas = init_args(&mq, ptys, n, num_threads);
+  t_push = run_threads(push_thread, mas, num_threads);
+  t_pop = run_threads(pop_thread, mas, 1);
+  res *= (mas[0].num_popped == n);
+  for (i = 0; i < mas[0].num_popped; i++){
+    res *= (mas[0].popped_ptys[i] == ptys[mas[0].popped_elts[i]]);
+    if (i > 0) res *= (mas[0].popped_ptys[i - 1] <= mas[0].popped_ptys[i]);
+  }
+  heap_mq_pthread_free(&mq);
+  printf("\t\tpush time:                                   "
+	 "%.4f seconds\n", t_push);
+  printf("\t\tpop time:                                    "
+	 "%.4f seconds\n", t_pop);
+  printf("\t\torder correctness:                           ");
+  print_test_result(res);
+  free_args(mas, num_threads);
+  free(ptys);
+  mas = NULL;
+  ptys = NULL;
+}
+
+/**
+   Compares two size_t priority values.
+*/
+int cmp_uint(const void *a, const void *b){
+  if (*(const size_t *)a > *(const size_t *)b){
+    return 1;
+  }else if (*(const size_t *)a < *(const size_t *)b){
+    return -1;
+  }else{
+    return 0;
+  }
+}
+
+/**
+   Returns a generator-uniform random size_t value in [0, high]. Random
+   bits are combined across calls to rand to cover high.
+*/
+size_t random_range(size_t high){
+  size_t ret = 0;
+  size_t rem = high;
+  while (rem > 0){
+    ret = (ret << (CHAR_BIT - 1)) ^ (size_t)RANDOM();
+    rem >>= CHAR_BIT - 1;
+  }
+  if (high == (size_t)-1) return ret;
+  return ret % (high + 1);
+}
+
+/**
+   Prints a test result.
+*/
+void print_test_result(int res){
+  if (res){
+    printf("SUCCESS\n");
+  }else{
+    printf("FAILURE\n");
+  }
+}
+
+/**
+   Times execution.
+*/
+double timer(){
+  struct timeval tm;
+  gettimeofday(&tm, NULL);
+  return tm.tv_sec + tm.tv_usec / 1e6;
+}
+
+int main(int argc, char *argv[]){
+  int i;
+  size_t *args = NULL;
+  RGENS_SEED();
+  if (argc > C_ARGC_MAX){
+    fprintf(stderr, "USAGE:\n%s", C_USAGE);
+    exit(EXIT_FAILURE);
+  }
+  args = malloc_perror(C_ARGC_MAX - 1, sizeof(size_t));
+  memcpy(args, C_ARGS_DEF, (C_ARGC_MAX - 1) * sizeof(size_t));
+  for (i = 1; i < argc; i++){
+    args[i - 1] = atoi(argv[i]);
+  }
+  if (args[0] > C_FULL_BIT - 2 ||
+      args[1] < 1 ||
+      args[2] < 1 ||
+      args[3] > 1 ||
+      args[4] > 1 ||
+      args[5] > 1){
+    fprintf(stderr, "USAGE:\n%s", C_USAGE);
+    exit(EXIT_FAILURE);
+  }
+  if (args[3]) run_push_pop_uint_test(args[0], args[1], args[2]);
+  if (args[4]) run_lazy_decrease_uint_test(args[0], args[1], args[2]);
+  if (args[5]) run_single_heap_order_uint_test(args[0], args[1]);
+  free(args);
+  args = NULL;
+  return 0;
+}
@@ -0,0 +1,213 @@
+/**
+   heap-mq-pthread.c
+
+   Implementation of a relaxed (min) priority queue with generic priorities
+   and generic elements that is concurrently accessible and modifiable.
+
+   The implementation is based on the MultiQueue design and consists of
+   num_qs independent heaps, each protected by a mutex, where num_qs is
+   typically c * p for a small constant c (e.g. 2 or 4) and p threads. A
+   push operation inserts an element into a randomly selected heap whose
+   mutex was acquired with a try-lock. A pop operation acquires the mutexes
+   of two randomly selected heaps with try-locks and pops from the heap
+   with the lesser top priority value. Because threads rarely contend for
+   the same heap, the throughput of push and pop operations scales with
+   the number of threads, at the cost of relaxing the order of popped
+   elements: a popped priority value is with high probability among the
+   O(num_qs) least priority values in the queue. If num_qs is 1, then
+   elements are popped in the order of their priority values.
+
+   The heaps are used without a hash table. An element may be pushed more
+   than once with different priority values, and a decrease-key operation
+   is performed by pushing an element again with a lesser priority value.
+   The stale copies of the element are discarded by a user after popping
+   (lazy deletion), e.g. by comparing a popped priority value with the
+   current distance of a vertex in parallel Dijkstra's or Prim's algorithm.
+
+   Two mutexes are acquired only with try-locks, and at most one mutex is
+   held during a blocking lock, which prevents deadlocks.
+
+   The implementation does not use stdint.h and is portable under C89/C90
+   and C99. The requirements are: i) CHAR_BIT * sizeof(size_t) is greater
+   or equal to 16 and is even, and ii) pthreads API is available.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "heap-mq-pthread.h"
+#include "heap.h"
+#include "utilities-mem.h"
+#include "utilities-pthread.h"
+
+static size_t random_ix(unsigned int *seed, size_t n);
+
+/**
+   Initializes a relaxed concurrent priority queue.
+   mq          : pointer to a preallocated block of size
+                 sizeof(heap_mq_pthread_t)
+   num_qs      : > 0 number of heaps, e.g. 2 or 4 times the number of
+                 threads
+   init_count  : > 0 initial count of each heap
+   pty_size    : size of a contiguous priority object
+   elt_size    : - size of an element, if the element is within a contiguous
+                 memory block and a copy of the element is pushed,
+                 - size of a pointer to an element, if the element is within
+                 a noncontiguous memory block or a pointer to a contiguous
+                 element is pushed
+   cmp_pty     : comparison function which returns a negative integer value
+                 if the priority value pointed to by the first argument is
+                 less than the priority value pointed to by the second, a
+                 positive integer value if the priority value pointed to by
+                 the first argument is greater than the priority value
+                 pointed to by the second, and zero integer value if the two
+                 priority values are equal
+   free_elt    : - if an element is within a contiguous memory block and
+                 a copy of the element was pushed, then NULL as free_elt
+                 is sufficient to delete the element,
+                 - if an element is within a noncontiguous memory block or
+                 a pointer to a contiguous element was pushed, then an
+                 element-specific free_elt, taking a pointer to a pointer to an
+                 element as its argument and leaving a block of size elt_size
+                 pointed to by the argument, is necessary to delete the element
+*/
+void heap_mq_pthread_init(heap_mq_pthread_t *mq,
+			  size_t num_qs,
+			  size_t init_count,
+			  size_t pty_size,
+			  size_t elt_size,
+			  int (*cmp_pty)(const void *, const void *),
+			  void (*free_elt)(void *)){
+  size_t i;
+  mq->num_qs = num_qs;
+  mq->pty_size = pty_size;
+  mq->elt_size = elt_size;
+  mq->qs = malloc_perror(num_qs, sizeof(heap_t));
+  mq->locks = malloc_perror(num_qs, sizeof(pthread_mutex_t));
+  mq->cmp_pty = cmp_pty;
+  for (i = 0; i < num_qs; i++){
+    heap_init(&mq->qs[i],
+	      init_count,
+	      pty_size,
+	      elt_size,
+	      NULL,
+	      cmp_pty,
+	      free_elt);
+    mutex_init_perror(&mq->locks[i]);
+  }
+}
+
+/**
+   Pushes an element and an associated priority value into a randomly
+   selected heap. The element may already be in the queue, e.g. with a
+   greater priority value if the push is a decrease-key operation.
+   mq          : pointer to an initialized queue
+   pty         : pointer to a block of size pty_size that is an object of
+                 basic type (e.g. char, int, long, double)
+   elt         : pointer to a block of size elt_size that is either a
+                 contiguous element object or a pointer to a contiguous or
+                 non-contiguous element
+   seed        : pointer to the random seed of a calling thread, used with
+                 rand_r; each thread uses its own seed
+*/
+void heap_mq_pthread_push(heap_mq_pthread_t *mq,
+			  const void *pty,
+			  const void *elt,
+			  unsigned int *seed){
+  size_t i;
+  do{
+    i = random_ix(seed, mq->num_qs);
+  }while (mutex_trylock_perror(&mq->locks[i]));
+  heap_push(&mq->qs[i], pty, elt);
+  mutex_unlock_perror(&mq->locks[i]);
+}
+
+/**
+   Pops an element associated with the lesser top priority value of two
+   randomly selected heaps, according to cmp_pty. If both heaps are empty,
+   then all heaps are scanned and an element is popped from the first
+   nonempty heap. Returns 1 if an element was popped. Returns 0 if each
+   heap was found empty during the scan, in which case the blocks pointed
+   to by pty and elt remain unchanged. Please see the parameter
+   specification in heap_mq_pthread_push.
+*/
+int heap_mq_pthread_pop(heap_mq_pthread_t *mq,
+			void *pty,
+			void *elt,
+			unsigned int *seed){
+  size_t i, j, k, start;
+  const void *pty_i = NULL, *pty_j = NULL;
+  if (mq->num_qs > 1){
+    /* acquire two distinct heaps with try-locks */
+    while (1){
+      i = random_ix(seed, mq->num_qs);
+      j = random_ix(seed, mq->num_qs - 1);
+      if (j >= i) j++;
+      if (mutex_trylock_perror(&mq->locks[i])) continue;
+      if (mutex_trylock_perror(&mq->locks[j])){
+	mutex_unlock_perror(&mq->locks[i]);
+	continue;
+      }
+      break;
+    }
+    pty_i = heap_peek(&mq->qs[i]);
+    pty_j = heap_peek(&mq->qs[j]);
+    if (pty_i == NULL ||
+	(pty_j != NULL && mq->cmp_pty(pty_j, pty_i) < 0)){
+      k = i;
+      i = j;
+      j = k;
+      pty_i = pty_j;
+    }
+    if (pty_i != NULL) heap_pop(&mq->qs[i], pty, elt);
+    mutex_unlock_perror(&mq->locks[j]);
+    mutex_unlock_perror(&mq->locks[i]);
+    if (pty_i != NULL) return 1;
+  }
+  /* scan from a random heap to find a nonempty heap */
+  start = random_ix(seed, mq->num_qs);
+  for (k = 0; k < mq->num_qs; k++){
+    i = (start + k < mq->num_qs) ? start + k : start + k - mq->num_qs;
+    mutex_lock_perror(&mq->locks[i]);
+    if (mq->qs[i].num_elts > 0){
+      heap_pop(&mq->qs[i], pty, elt);
+      mutex_unlock_perror(&mq->locks[i]);
+      return 1;
+    }
+    mutex_unlock_perror(&mq->locks[i]);
+  }
+  return 0;
+}
+
+/**
+   Frees a relaxed concurrent priority queue and leaves a block of size
+   sizeof(heap_mq_pthread_t) pointed to by the mq parameter. Called after
+   all threads completed their operations on the queue.
+*/
+void heap_mq_pthread_free(heap_mq_pthread_t *mq){
+  size_t i;
+  for (i = 0; i < mq->num_qs; i++){
+    heap_free(&mq->qs[i]);
+    mutex_destroy_perror(&mq->locks[i]);
+  }
+  free(mq->qs);
+  free(mq->locks);
+  mq->qs = NULL;
+  mq->locks = NULL;
+}
+
+/**
+   Returns a random index in [0, n) according to rand_r with a thread
+   seed. Random bits are combined across calls to rand_r if n is greater
+   than RAND_MAX.
+*/
+static size_t random_ix(unsigned int *seed, size_t n){
+  size_t ret = 0;
+  size_t rem = n - 1;
+  if (n == 1) return 0;
+  while (rem > 0){
+    ret = (ret << (CHAR_BIT - 1)) ^ (size_t)rand_r(seed);
+    rem >>= CHAR_BIT - 1;
+  }
+  return ret % n;
+}
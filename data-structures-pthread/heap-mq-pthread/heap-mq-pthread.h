@@ -0,0 +1,127 @@
+/**
+   heap-mq-pthread.h
+
+   Struct declarations and declarations of accessible functions of a
+   relaxed (min) priority queue with generic priorities and generic
+   elements that is concurrently accessible and modifiable.
+
+   The implementation is based on the MultiQueue design and consists of
+   num_qs independent heaps, each protected by a mutex, where num_qs is
+   typically c * p for a small constant c (e.g. 2 or 4) and p threads. A
+   push operation inserts an element into a randomly selected heap whose
+   mutex was acquired with a try-lock. A pop operation acquires the mutexes
+   of two randomly selected heaps with try-locks and pops from the heap
+   with the lesser top priority value. Because threads rarely contend for
+   the same heap, the throughput of push and pop operations scales with
+   the number of threads, at the cost of relaxing the order of popped
+   elements: a popped priority value is with high probability among the
+   O(num_qs) least priority values in the queue. If num_qs is 1, then
+   elements are popped in the order of their priority values.
+
+   The heaps are used without a hash table. An element may be pushed more
+   than once with different priority values, and a decrease-key operation
+   is performed by pushing an element again with a lesser priority value.
+   The stale copies of the element are discarded by a user after popping
+   (lazy deletion), e.g. by comparing a popped priority value with the
+   current distance of a vertex in parallel Dijkstra's or Prim's algorithm.
+
+   The implementation does not use stdint.h and is portable under C89/C90
+   and C99. The requirements are: i) CHAR_BIT * sizeof(size_t) is greater
+   or equal to 16 and is even, and ii) pthreads API is available.
+*/
+
+#ifndef HEAP_MQ_PTHREAD_H
+#define HEAP_MQ_PTHREAD_H
+
+#define _XOPEN_SOURCE 600
+
+#include <stddef.h>
+#include <pthread.h>
+#include "heap.h"
+
+typedef struct{
+  size_t num_qs;
+  size_t pty_size;
+  size_t elt_size;
+  heap_t *qs;
+  pthread_mutex_t *locks; /* the result of referring to a copy is undefined */
+  int (*cmp_pty)(const void *, const void *);
+} heap_mq_pthread_t;
+
+/**
+   Initializes a relaxed concurrent priority queue.
+   mq          : pointer to a preallocated block of size
+                 sizeof(heap_mq_pthread_t)
+   num_qs      : > 0 number of heaps, e.g. 2 or 4 times the number of
+                 threads
+   init_count  : > 0 initial count of each heap
+   pty_size    : size of a contiguous priority object
+   elt_size    : - size of an element, if the element is within a contiguous
+                 memory block and a copy of the element is pushed,
+                 - size of a pointer to an element, if the element is within
+                 a noncontiguous memory block or a pointer to a contiguous
+                 element is pushed
+   cmp_pty     : comparison function which returns a negative integer value
+                 if the priority value pointed to by the first argument is
+                 less than the priority value pointed to by the second, a
+                 positive integer value if the priority value pointed to by
+                 the first argument is greater than the priority value
+                 pointed to by the second, and zero integer value if the two
+                 priority values are equal
+   free_elt    : - if an element is within a contiguous memory block and
+                 a copy of the element was pushed, then NULL as free_elt
+                 is sufficient to delete the element,
+                 - if an element is within a noncontiguous memory block or
+                 a pointer to a contiguous element was pushed, then an
+                 element-specific free_elt, taking a pointer to a pointer to an
+                 element as its argument and leaving a block of size elt_size
+                 pointed to by the argument, is necessary to delete the element
+*/
+void heap_mq_pthread_init(heap_mq_pthread_t *mq,
+			  size_t num_qs,
+			  size_t init_count,
+			  size_t pty_size,
+			  size_t elt_size,
+			  int (*cmp_pty)(const void *, const void *),
+			  void (*free_elt)(void *));
+
+/**
+   Pushes an element and an associated priority value into a randomly
+   selected heap. The element may already be in the queue, e.g. with a
+   greater priority value if the push is a decrease-key operation.
+   mq          : pointer to an initialized queue
+   pty         : pointer to a block of size pty_size that is an object of
+                 basic type (e.g. char, int, long, double)
+   elt         : pointer to a block of size elt_size that is either a
+                 contiguous element object or a pointer to a contiguous or
+                 non-contiguous element
+   seed        : pointer to the random seed of a calling thread, used with
+                 rand_r; each thread uses its own seed
+*/
+void heap_mq_pthread_push(heap_mq_pthread_t *mq,
+			  const void *pty,
+			  const void *elt,
+			  unsigned int *seed);
+
+/**
+   Pops an element associated with the lesser top priority value of two
+   randomly selected heaps, according to cmp_pty. If both heaps are empty,
+   then all heaps are scanned and an element is popped from the first
+   nonempty heap. Returns 1 if an element was popped. Returns 0 if each
+   heap was found empty during the scan, in which case the blocks pointed
+   to by pty and elt remain unchanged. Please see the parameter
+   specification in heap_mq_pthread_push.
+*/
+int heap_mq_pthread_pop(heap_mq_pthread_t *mq,
+			void *pty,
+			void *elt,
+			unsigned int *seed);
+
+/**
+   Frees a relaxed concurrent priority queue and leaves a block of size
+   sizeof(heap_mq_pthread_t) pointed to by the mq parameter. Called after
+   all threads completed their operations on the queue.
+*/
+void heap_mq_pthread_free(heap_mq_pthread_t *mq);
+
+#endif
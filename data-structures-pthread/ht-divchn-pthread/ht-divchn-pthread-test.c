@@ -51,9 +51,11 @@ const char *C_USAGE =
   "[0, 1] : on/off remove delete uint test\n"
   "[0, 1] : on/off insert search uint_ptr test\n"
   "[0, 1] : on/off remove delete uint_ptr test\n"
-  "[0, 1] : on/off corner cases test\n";
-const int C_ARGC_MAX = 13;
-const size_t C_ARGS_DEF[12] = {14, 0, 2, 1024, 30720u, 11, 10, 1, 1, 1, 1, 1};
+  "[0, 1] : on/off corner cases test\n"
+  "[0, 1] : on/off merge test\n";
+const int C_ARGC_MAX = 14;
+const size_t C_ARGS_DEF[13] = {14, 0, 2, 1024, 30720u, 11, 10, 1, 1, 1, 1, 1,
+			       1};
 const size_t C_SIZE_MAX = (size_t)-1;
 const size_t C_FULL_BIT = CHAR_BIT * sizeof(size_t);
 
@@ -94,6 +96,14 @@ void remove_delete(size_t num_ins,
 		   void (*new_elt)(void *, size_t),
 		   size_t (*val_elt)(const void *),
 		   void (*free_elt)(void *));
+void merge(size_t num_ins,
+	   size_t key_size,
+	   size_t alpha_n,
+	   size_t log_alpha_d,
+	   size_t num_threads,
+	   size_t log_num_locks,
+	   size_t num_grow_threads,
+	   size_t batch_count);
 void *ptr(const void *block, size_t i, size_t size);
 void print_test_result(int res);
 double timer();
@@ -1006,6 +1016,171 @@ void run_corner_cases_test(size_t log_ins){
   key = NULL;
 }
 
+/**
+   Runs a ht_divchn_pthread_merge test on overlapping sets of keys and
+   size_t elements across key sizes >= C_KEY_SIZE_FACTOR and load factor
+   upper bounds.
+*/
+void run_merge_uint_test(size_t log_ins,
+			 size_t log_key_start,
+			 size_t log_key_end,
+			 size_t alpha_n_start,
+			 size_t alpha_n_end,
+			 size_t log_alpha_d,
+			 size_t num_alpha_steps,
+			 size_t num_threads,
+			 size_t log_num_locks,
+			 size_t num_grow_threads,
+			 size_t batch_count){
+  size_t i, j;
+  size_t num_ins;
+  size_t key_size;
+  size_t step, rem;
+  size_t alpha_n;
+  num_ins = pow_two_perror(log_ins);
+  step = (alpha_n_end - alpha_n_start) / num_alpha_steps;
+  for (i = log_key_start; i <= log_key_end; i++){
+    alpha_n = alpha_n_start;
+    rem = alpha_n_end - alpha_n_start - step * num_alpha_steps;
+    key_size = C_KEY_SIZE_FACTOR * pow_two_perror(i);
+    printf("Run a ht_divchn_pthread_merge test on overlapping sets of "
+	   "%lu-byte keys and size_t elements\n", TOLU(key_size));
+    printf("\t# threads (nt):   %lu\n"
+	   "\t# locks:          %lu\n"
+	   "\t# grow threads:   %lu\n"
+	   "\tbatch count:      %lu\n",
+	   TOLU(num_threads),
+	   TOLU(pow_two_perror(log_num_locks)),
+	   TOLU(num_grow_threads),
+	   TOLU(batch_count));
+    for (j = 0; j <= num_alpha_steps; j++){
+      printf("\t# inserts: %lu, load factor upper bound: %.4f\n",
+	     TOLU(num_ins), (float)alpha_n / pow_two_perror(log_alpha_d));
+      merge(num_ins,
+	    key_size,
+	    alpha_n,
+	    log_alpha_d,
+	    num_threads,
+	    log_num_locks,
+	    num_grow_threads,
+	    batch_count);
+      alpha_n += (j < num_alpha_steps) * step + (rem > 0 && rem--);
+    }
+  }
+}
+
+/**
+   Helper functions for the ht_divchn_pthread_merge test. The keys of the
+   destination hash table are keys[0, num_ins) and the keys of the source
+   hash table are keys[num_ins / 2, num_ins / 2 + num_ins), and the element
+   of each key is its index in keys.
+*/
+
+void add_uint(void *a, const void *b, size_t elt_size){
+  size_t sa, sb;
+  memcpy(&sa, a, elt_size);
+  memcpy(&sb, b, elt_size);
+  sa += sb;
+  memcpy(a, &sa, elt_size);
+}
+
+void merge_key_elts(ht_divchn_pthread_t *dst,
+		    ht_divchn_pthread_t *src,
+		    const void *keys,
+		    const void *elts,
+		    size_t num_ins,
+		    size_t num_threads,
+		    size_t batch_count,
+		    int *res){
+  size_t i;
+  size_t half = num_ins / 2;
+  double t;
+  insert_keys_elts(dst, keys, elts, num_ins, num_threads, batch_count, res);
+  insert_keys_elts(src,
+		   ptr(keys, half, src->key_size),
+		   ptr(elts, half, src->elt_size),
+		   num_ins,
+		   num_threads,
+		   batch_count,
+		   res);
+  t = timer();
+  ht_divchn_pthread_merge(dst, src, num_threads);
+  t = timer() - t;
+  printf("\t\tmerge time:                         "
+	 "%.4f seconds\n", t);
+  *res *= (dst->num_elts == half + num_ins &&
+	   src->num_elts == 0 &&
+	   src->key_elts == NULL);
+  for (i = 0; i < half + num_ins; i++){
+    if (i >= half && i < num_ins && dst->rdc_elt != NULL){
+      *res *= (*(size_t *)ht_divchn_pthread_search(dst,
+						   ptr(keys,
+						       i,
+						       dst->key_size)) ==
+	       2 * i);
+    }else{
+      *res *= (*(size_t *)ht_divchn_pthread_search(dst,
+						   ptr(keys,
+						       i,
+						       dst->key_size)) == i);
+    }
+  }
+}
+
+void merge(size_t num_ins,
+	   size_t key_size,
+	   size_t alpha_n,
+	   size_t log_alpha_d,
+	   size_t num_threads,
+	   size_t log_num_locks,
+	   size_t num_grow_threads,
+	   size_t batch_count){
+  int res = 1;
+  size_t i, j;
+  size_t num_keys = num_ins + num_ins / 2;
+  void *key = NULL;
+  void *keys = NULL, *elts = NULL;
+  ht_divchn_pthread_t dst, src;
+  keys = malloc_perror(num_keys, key_size);
+  elts = malloc_perror(num_keys, sizeof(size_t));
+  for (i = 0; i < num_keys; i++){
+    key = ptr(keys, i, key_size);
+    for (j = 0; j < key_size - C_KEY_SIZE_FACTOR; j++){
+      /* set random bytes in a key, each to RANDOM mod 2**CHAR_BIT */
+      *(unsigned char *)ptr(key, j, 1) = RANDOM();
+    }
+    /* set non-random bytes in a key, and create element */
+    *(size_t *)ptr(key, key_size - C_KEY_SIZE_FACTOR, 1) = i;
+    new_uint(ptr(elts, i, sizeof(size_t)), i);
+  }
+  ht_divchn_pthread_init(&dst, key_size, sizeof(size_t), 0, alpha_n,
+			 log_alpha_d, log_num_locks, num_grow_threads,
+			 add_uint, NULL);
+  ht_divchn_pthread_init(&src, key_size, sizeof(size_t), 0, alpha_n,
+			 log_alpha_d, log_num_locks, num_grow_threads,
+			 NULL, NULL);
+  merge_key_elts(&dst, &src, keys, elts, num_ins, num_threads, batch_count,
+		 &res);
+  free_ht(&dst, 0);
+  ht_divchn_pthread_init(&dst, key_size, sizeof(size_t), 0, alpha_n,
+			 log_alpha_d, log_num_locks, num_grow_threads,
+			 NULL, NULL);
+  ht_divchn_pthread_init(&src, key_size, sizeof(size_t), num_ins, alpha_n,
+			 log_alpha_d, log_num_locks, num_grow_threads,
+			 NULL, NULL);
+  ht_divchn_pthread_huge_page(&dst);
+  ht_divchn_pthread_huge_page(&src);
+  merge_key_elts(&dst, &src, keys, elts, num_ins, num_threads, batch_count,
+		 &res);
+  free_ht(&dst, 1);
+  printf("\t\tmerge correctness:                  ");
+  print_test_result(res);
+  free(keys);
+  free(elts);
+  keys = NULL;
+  elts = NULL;
+}
+
 /**
    Helper functions.
 */
@@ -1063,7 +1238,8 @@ int main(int argc, char *argv[]){
       args[8] > 1 ||
       args[9] > 1 ||
       args[10] > 1 ||
-      args[11] > 1){
+      args[11] > 1 ||
+      args[12] > 1){
     fprintf(stderr, "USAGE:\n%s", C_USAGE);
     exit(EXIT_FAILURE);
   }
@@ -1112,6 +1288,17 @@ int main(int argc, char *argv[]){
 						4,
 						1000);
   if (args[11]) run_corner_cases_test(args[0]); 
+  if (args[12]) run_merge_uint_test(args[0],
+				    args[1],
+				    args[2],
+				    args[3],
+				    args[4],
+				    args[5],
+				    args[6],
+				    4,
+				    15,
+				    4,
+				    1000);
   free(args);
   args = NULL;
   return 0;
@@ -62,6 +62,7 @@
 #include "ht-divchn-pthread.h"
 #include "dll.h"
 #include "utilities-mem.h"
+#include "utilities-mem-huge.h"
 #include "utilities-mod.h"
 #include "utilities-pthread.h"
 
@@ -139,6 +140,10 @@ static const size_t C_SIZE_MAX = (size_t)-1;
 static size_t hash(const ht_divchn_pthread_t *ht, const void *key);
 static size_t mul_alpha_sz_max(size_t n, size_t alpha_n, size_t log_alpha_d);
 static void ht_grow(ht_divchn_pthread_t *ht);
+static dll_node_t **key_elts_new(ht_divchn_pthread_t *ht);
+static void key_elts_free(const ht_divchn_pthread_t *ht,
+			  dll_node_t **key_elts);
+static void *merge_thread(void *arg);
 static int incr_count(ht_divchn_pthread_t *ht);
 static int is_overflow(size_t start, size_t count);
 static size_t build_prime(size_t start, size_t count);
@@ -219,10 +224,9 @@ void ht_divchn_pthread_init(ht_divchn_pthread_t *ht,
   ht->num_elts = 0;
   ht->alpha_n = alpha_n;
   ht->log_alpha_d = log_alpha_d;
-  ht->key_elts = malloc_perror(ht->count, sizeof(dll_node_t *));
-  for (i = 0; i < ht->count; i++){
-    dll_init(&ht->key_elts[i]);
-  }
+  ht->huge_page = FALSE;
+  ht->ll = malloc_perror(1, sizeof(dll_t));
+  ht->key_elts = key_elts_new(ht);
   /* thread synchronization */
   ht->num_in_threads = 0;
   ht->num_grow_threads = num_grow_threads;
@@ -242,6 +246,20 @@ void ht_divchn_pthread_init(ht_divchn_pthread_t *ht,
   ht->free_elt = free_elt;
 }
 
+/**
+   Backs the array of slots of a hash table with huge pages if the array is
+   at least as large as a huge page and huge pages are available on a given
+   system, thereby reducing TLB misses when accessing the slots of a large
+   hash table. Otherwise regular pages are used. The operation is
+   optionally called after ht_divchn_pthread_init returned and before any
+   thread calls any other operation.
+*/
+void ht_divchn_pthread_huge_page(ht_divchn_pthread_t *ht){
+  key_elts_free(ht, ht->key_elts);
+  ht->huge_page = TRUE;
+  ht->key_elts = key_elts_new(ht);
+}
+
 /**
    Inserts a batch of keys and associated elements into a hash table.
    The batch_keys and batch_elts parameters are not NULL. The
@@ -269,11 +287,14 @@ void ht_divchn_pthread_insert(ht_divchn_pthread_t *ht,
     head = &ht->key_elts[ix];
     lock_ix = ix & ht->key_locks_mask;
     mutex_lock_perror(&ht->key_locks[lock_ix]);
-    node = dll_search_key(head,
+    node = dll_search_key(ht->ll,
+			  head,
 			  ptr(batch_keys, i, ht->key_size),
-			  ht->key_size);
+			  ht->key_size,
+			  NULL);
     if (node == NULL){
-      dll_prepend_new(head,
+      dll_prepend_new(ht->ll,
+		      head,
 		      ptr(batch_keys, i, ht->key_size),
 		      ptr(batch_elts, i, ht->elt_size),
 		      ht->key_size,
@@ -282,12 +303,12 @@ void ht_divchn_pthread_insert(ht_divchn_pthread_t *ht,
       increased++;
     }else{
       if (ht->rdc_elt != NULL){
-	ht->rdc_elt(dll_ptr(node, ht->key_size),
+	ht->rdc_elt(dll_elt_ptr(ht->ll, node),
 		    ptr(batch_elts, i, ht->elt_size),
 		    ht->elt_size);
       }else{
-	if (ht->free_elt != NULL) ht->free_elt(dll_ptr(node, ht->key_size));
-	memcpy(dll_ptr(node, ht->key_size),
+	if (ht->free_elt != NULL) ht->free_elt(dll_elt_ptr(ht->ll, node));
+	memcpy(dll_elt_ptr(ht->ll, node),
 	       ptr(batch_elts, i, ht->elt_size),
 	       ht->elt_size);
       }
@@ -333,13 +354,15 @@ void ht_divchn_pthread_insert(ht_divchn_pthread_t *ht,
 */
 void *ht_divchn_pthread_search(const ht_divchn_pthread_t *ht,
 			       const void *key){
-  const dll_node_t *node = dll_search_uq_key(&ht->key_elts[hash(ht, key)],
+  const dll_node_t *node = dll_search_uq_key(ht->ll,
+					     &ht->key_elts[hash(ht, key)],
 					     key,
-					     ht->key_size);
+					     ht->key_size,
+					     NULL);
   if (node == NULL){
     return NULL;
   }else{
-    return dll_ptr(node, ht->key_size);
+    return dll_elt_ptr(ht->ll, node);
   }
 }
 
@@ -368,15 +391,17 @@ void ht_divchn_pthread_remove(ht_divchn_pthread_t *ht,
     head = &ht->key_elts[ix];
     lock_ix = ix & ht->key_locks_mask;
     mutex_lock_perror(&ht->key_locks[lock_ix]);
-    node = dll_search_key(head,
+    node = dll_search_key(ht->ll,
+			  head,
 			  ptr(batch_keys, i, ht->key_size),
-			  ht->key_size);
+			  ht->key_size,
+			  NULL);
     if (node != NULL){
       memcpy(ptr(batch_elts, i, ht->elt_size),
-	     dll_ptr(node, ht->key_size),
+	     dll_elt_ptr(ht->ll, node),
 	     ht->elt_size);
       /* if an element is noncontiguous, only the pointer to it is deleted */
-      dll_delete(head, node, ht->key_size, NULL);
+      dll_delete(ht->ll, head, node, NULL);
       mutex_unlock_perror(&ht->key_locks[lock_ix]);
       removed++;
     }else{
@@ -415,11 +440,13 @@ void ht_divchn_pthread_delete(ht_divchn_pthread_t *ht,
     head = &ht->key_elts[ix];
     lock_ix = ix & ht->key_locks_mask;
     mutex_lock_perror(&ht->key_locks[lock_ix]);
-    node = dll_search_key(head,
+    node = dll_search_key(ht->ll,
+			  head,
 			  ptr(batch_keys, i, ht->key_size),
-			  ht->key_size);
+			  ht->key_size,
+			  NULL);
     if (node != NULL){
-      dll_delete(head, node, ht->key_size, ht->free_elt);
+      dll_delete(ht->ll, head, node, ht->free_elt);
       mutex_unlock_perror(&ht->key_locks[lock_ix]);
       deleted++;
     }else{
@@ -434,6 +461,133 @@ void ht_divchn_pthread_delete(ht_divchn_pthread_t *ht,
   mutex_unlock_perror(&ht->gate_lock);
 }
 
+/**
+   Merges the keys and elements in a subset of slots of a source hash table
+   into a destination hash table. Adds the number of keys that were not in
+   the destination hash table to the increased field of the argument.
+*/
+
+typedef struct{
+  size_t start;
+  size_t count;
+  size_t increased;
+  ht_divchn_pthread_t *dst;
+  ht_divchn_pthread_t *src;
+} merge_arg_t;
+
+static void *merge_thread(void *arg){
+  size_t i, ix, lock_ix;
+  dll_node_t **src_head = NULL, **head = NULL;
+  dll_node_t *src_node = NULL, *node = NULL;
+  merge_arg_t *ma = arg;
+  ht_divchn_pthread_t *dst = ma->dst;
+  const ht_divchn_pthread_t *src = ma->src;
+  for (i = 0; i < ma->count; i++){
+    src_head = &src->key_elts[ma->start + i];
+    while (*src_head != NULL){
+      src_node = *src_head;
+      ix = hash(dst, dll_key_ptr(src->ll, src_node));
+      head = &dst->key_elts[ix];
+      lock_ix = ix & dst->key_locks_mask;
+      mutex_lock_perror(&dst->key_locks[lock_ix]);
+      node = dll_search_key(dst->ll,
+			    head,
+			    dll_key_ptr(src->ll, src_node),
+			    dst->key_size,
+			    NULL);
+      if (node == NULL){
+	dll_remove(src_head, src_node);
+	dll_prepend(head, src_node);
+	mutex_unlock_perror(&dst->key_locks[lock_ix]);
+	ma->increased++;
+      }else if (dst->rdc_elt != NULL){
+	dst->rdc_elt(dll_elt_ptr(dst->ll, node),
+		     dll_elt_ptr(src->ll, src_node),
+		     dst->elt_size);
+	mutex_unlock_perror(&dst->key_locks[lock_ix]);
+	dll_delete(src->ll, src_head, src_node, src->free_elt);
+      }else{
+	if (dst->free_elt != NULL) dst->free_elt(dll_elt_ptr(dst->ll, node));
+	memcpy(dll_elt_ptr(dst->ll, node),
+	       dll_elt_ptr(src->ll, src_node),
+	       dst->elt_size);
+	mutex_unlock_perror(&dst->key_locks[lock_ix]);
+	/* the element was copied into dst; only its copy in src is deleted */
+	dll_delete(src->ll, src_head, src_node, NULL);
+      }
+    }
+  }
+  return NULL;
+}
+
+/**
+   Merges a source hash table into a destination hash table with
+   num_threads threads, each merging the keys and elements of a subset of
+   slots of the source hash table. If a key of the source hash table is
+   not in the destination hash table, the node of the key is moved into
+   the destination hash table without reallocation. Otherwise, the
+   key-associated element in the destination hash table is updated or
+   reduced according to rdc_elt of the destination hash table, and the
+   element of the source hash table is deleted according to free_elt of
+   the source hash table if reduced. After the operation, the source hash
+   table is freed. The operation is called after all threads completed
+   insert, remove, delete, and search operations on dst and src.
+   dst         : pointer to an initialized ht_divchn_pthread_t struct
+   src         : pointer to an initialized ht_divchn_pthread_t struct other
+                 than dst with the same key_size and elt_size as dst
+   num_threads : >= 1, number of threads used in merging
+*/
+void ht_divchn_pthread_merge(ht_divchn_pthread_t *dst,
+			     ht_divchn_pthread_t *src,
+			     size_t num_threads){
+  size_t i, start = 0;
+  size_t seg_count, rem_count;
+  pthread_t *mids = NULL;
+  merge_arg_t *mas = NULL;
+  if (dst->key_size != src->key_size || dst->elt_size != src->elt_size){
+    fprintf(stderr, "ht_divchn_pthread_merge: key_size or elt_size mismatch\n");
+    exit(EXIT_FAILURE);
+  }
+  mids = malloc_perror(num_threads, sizeof(pthread_t));
+  mas = malloc_perror(num_threads, sizeof(merge_arg_t));
+  /* multithreaded merge */
+  seg_count = src->count / num_threads;
+  rem_count = src->count - seg_count * num_threads;
+  for (i = 0; i < num_threads; i++){
+    mas[i].start = start;
+    mas[i].count = seg_count;
+    if (rem_count > 0){
+      mas[i].count++;
+      rem_count--;
+    }
+    mas[i].increased = 0;
+    mas[i].dst = dst;
+    mas[i].src = src;
+    if (i > 0) thread_create_perror(&mids[i], merge_thread, &mas[i]);
+    start += mas[i].count;
+  }
+  merge_thread(&mas[0]); /* use the parent threads as well */
+  for (i = 1; i < num_threads; i++){
+    thread_join_perror(mids[i], NULL);
+  }
+  for (i = 0; i < num_threads; i++){
+    dst->num_elts += mas[i].increased;
+  }
+  /* grow dst if needed; single thread */
+  if (dst->count_ix != C_SIZE_MAX &&
+      dst->count_ix != C_PRIME_PARTS_COUNT &&
+      dst->num_elts > dst->max_num_elts){
+    ht_grow(dst);
+  }
+  /* all nodes of src were moved or deleted; free the remaining table */
+  src->num_elts = 0;
+  ht_divchn_pthread_free(src);
+  free(mids);
+  free(mas);
+  mids = NULL;
+  mas = NULL;
+}
+
 /**
    Frees a hash table. The operation is called after all threads completed
    insert, remove, delete, and search operations.
@@ -441,10 +595,18 @@ void ht_divchn_pthread_delete(ht_divchn_pthread_t *ht,
 void ht_divchn_pthread_free(ht_divchn_pthread_t *ht){
   size_t i;
   for (i = 0; i < ht->count; i++){
-    dll_free(&ht->key_elts[i], ht->key_size, ht->free_elt);
+    dll_free(ht->ll, &ht->key_elts[i], ht->free_elt);
+  }
+  key_elts_free(ht, ht->key_elts);
+  for (i = 0; i <= ht->key_locks_mask; i++){
+    mutex_destroy_perror(&ht->key_locks[i]);
   }
-  free(ht->key_elts);
+  mutex_destroy_perror(&ht->gate_lock);
+  cond_destroy_perror(&ht->gate_open_cond);
+  cond_destroy_perror(&ht->grow_cond);
+  free(ht->ll);
   free(ht->key_locks);
+  ht->ll = NULL;
   ht->key_elts = NULL;
   ht->key_locks = NULL;
 }
@@ -500,7 +662,7 @@ static void *reinsert_thread(void *arg){
     while (*head != NULL){
       node = *head;
       dll_remove(head, node);
-      ix = hash(ra->ht, dll_ptr(node, 0));
+      ix = hash(ra->ht, dll_key_ptr(ra->ht->ll, node));
       lock_ix = ix & ra->ht->key_locks_mask;
       mutex_lock_perror(&ra->ht->key_locks[lock_ix]);
       dll_prepend(&ra->ht->key_elts[ix], node);
@@ -522,10 +684,7 @@ static void ht_grow(ht_divchn_pthread_t *ht){
   if (prev_count == ht->count) return; /* load factor not lowered */
   rids = malloc_perror(ht->num_grow_threads, sizeof(pthread_t));
   ras = malloc_perror(ht->num_grow_threads, sizeof(reinsert_arg_t));
-  ht->key_elts = malloc_perror(ht->count, sizeof(dll_node_t *));
-  for (i = 0; i < ht->count; i++){
-    dll_init(&ht->key_elts[i]);
-  }
+  ht->key_elts = key_elts_new(ht);
   /* multithreaded reinsertion */
   seg_count = prev_count / ht->num_grow_threads;
   rem_count = prev_count - seg_count * ht->num_grow_threads;
@@ -545,7 +704,7 @@ static void ht_grow(ht_divchn_pthread_t *ht){
   for (i = 1; i < ht->num_grow_threads; i++){
     thread_join_perror(rids[i], NULL);
   }
-  free(prev_key_elts);
+  key_elts_free(ht, prev_key_elts);
   free(rids);
   free(ras);
   prev_key_elts = NULL;
@@ -553,6 +712,34 @@ static void ht_grow(ht_divchn_pthread_t *ht){
   ras = NULL;
 }
 
+/**
+   Allocates an array of count pointers to nodes, each initialized as an
+   empty list, according to huge_page, and frees such an array.
+*/
+
+static dll_node_t **key_elts_new(ht_divchn_pthread_t *ht){
+  size_t i;
+  dll_node_t **key_elts = NULL;
+  if (ht->huge_page){
+    key_elts = malloc_huge_perror(ht->count, sizeof(dll_node_t *));
+  }else{
+    key_elts = malloc_perror(ht->count, sizeof(dll_node_t *));
+  }
+  for (i = 0; i < ht->count; i++){
+    dll_init(ht->ll, &key_elts[i], ht->key_size);
+  }
+  return key_elts;
+}
+
+static void key_elts_free(const ht_divchn_pthread_t *ht,
+			  dll_node_t **key_elts){
+  if (ht->huge_page){
+    free_huge(key_elts);
+  }else{
+    free(key_elts);
+  }
+}
+
 /**
    Attempts to increase the count of a hash table. Returns 1 if the count
    was increased. Otherwise returns 0. Updates count_ix, group_ix, count,
@@ -75,6 +75,8 @@ typedef struct{
   size_t num_elts;
   size_t alpha_n;
   size_t log_alpha_d; 
+  boolean_t huge_page; /* TRUE if key_elts is backed by huge pages */
+  dll_t *ll;
   dll_node_t **key_elts; /* array of pointers to nodes */
 
   /* thread synchronization */
@@ -153,6 +155,16 @@ void ht_divchn_pthread_init(ht_divchn_pthread_t *ht,
 			    void (*rdc_elt)(void *, const void *, size_t),
 			    void (*free_elt)(void *));
 
+/**
+   Backs the array of slots of a hash table with huge pages if the array is
+   at least as large as a huge page and huge pages are available on a given
+   system, thereby reducing TLB misses when accessing the slots of a large
+   hash table. Otherwise regular pages are used. The operation is
+   optionally called after ht_divchn_pthread_init returned and before any
+   thread calls any other operation.
+*/
+void ht_divchn_pthread_huge_page(ht_divchn_pthread_t *ht);
+
 /**
    Inserts a batch of keys and associated elements into a hash table.
    The batch_keys and batch_elts parameters are not NULL. The
@@ -193,6 +205,27 @@ void ht_divchn_pthread_delete(ht_divchn_pthread_t *ht,
 			      const void *batch_keys,
 			      size_t batch_count);
 
+/**
+   Merges a source hash table into a destination hash table with
+   num_threads threads, each merging the keys and elements of a subset of
+   slots of the source hash table. If a key of the source hash table is
+   not in the destination hash table, the node of the key is moved into
+   the destination hash table without reallocation. Otherwise, the
+   key-associated element in the destination hash table is updated or
+   reduced according to rdc_elt of the destination hash table, and the
+   element of the source hash table is deleted according to free_elt of
+   the source hash table if reduced. After the operation, the source hash
+   table is freed. The operation is called after all threads completed
+   insert, remove, delete, and search operations on dst and src.
+   dst         : pointer to an initialized ht_divchn_pthread_t struct
+   src         : pointer to an initialized ht_divchn_pthread_t struct other
+                 than dst with the same key_size and elt_size as dst
+   num_threads : >= 1, number of threads used in merging
+*/
+void ht_divchn_pthread_merge(ht_divchn_pthread_t *dst,
+			     ht_divchn_pthread_t *src,
+			     size_t num_threads);
+
 /**
    Frees a hash table. The operation is called after all threads completed
    insert, remove, delete, and search operations.
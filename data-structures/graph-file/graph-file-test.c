@@ -0,0 +1,347 @@
+/**
+   graph-file-test.c
+
+   Tests of writing and reading graphs with generic weights in a binary
+   file format, and of mapping adjacency lists in CSR format from files.
+
+   The following command line arguments can be used to customize tests:
+   graph-file-test
+      [0, # bits in size_t / 2] : i s.t. # vertices = 2**i
+      [0, # bits in size_t - 1) : j s.t. # edges = 2**j
+      [0, 1] : on/off graph_t file test
+      [0, 1] : on/off adjacency list file and mapping test
+      [0, 1] : on/off corner cases test
+
+   usage examples:
+   ./graph-file-test
+   ./graph-file-test 20 24
+   ./graph-file-test 20 24 0 1 0
+
+   graph-file-test can be run with any subset of command line arguments in
+   the above-defined order. If the (i + 1)th argument is specified then the
+   ith argument must be specified for i >= 0. Default values are used for
+   the unspecified arguments according to the C_ARGS_DEF array.
+
+   A test file C_FNAME is created in the current directory and removed
+   after the tests.
+
+   The implementation of tests does not use stdint.h and is portable under
+   C89/C90 and C99. The requirements are: i) CHAR_BIT * sizeof(size_t) is
+   greater or equal to 16 and is even, and ii) POSIX mmap is available.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include "graph-file.h"
+#include "graph.h"
+#include "utilities-mem.h"
+#include "utilities-mod.h"
+
+/**
+   Generate random numbers in a portable way for test purposes only; rand()
+   in the Linux C Library uses the same generator as random(), which may not
+   be the case on older rand() implementations, and on current
+   implementations on different systems.
+*/
+#define RGENS_SEED() do{srand(time(NULL));}while (0)
+#define RANDOM() (rand()) /* [0, RAND_MAX] */
+#define DRAND() ((double)rand() / RAND_MAX) /* [0.0, 1.0] */
+
+#define TOLU(i) ((unsigned long int)(i)) /* printing size_t under C89/C90 */
+
+/* input handling */
+const char *C_USAGE =
+  "graph-file-test\n"
+  "[0, # bits in size_t / 2] : i s.t. # vertices = 2**i\n"
+  "[0, # bits in size_t - 1) : j s.t. # edges = 2**j\n"
+  "[0, 1] : on/off graph_t file test\n"
+  "[0, 1] : on/off adjacency list file and mapping test\n"
+  "[0, 1] : on/off corner cases test\n";
+const int C_ARGC_MAX = 6;
+const size_t C_ARGS_DEF[5] = {14, 18, 1, 1, 1};
+const size_t C_FULL_BIT = CHAR_BIT * sizeof(size_t);
+
+const char *C_FNAME = "graph-file-test.bin";
+
+/* corner cases test */
+const size_t C_CORNER_NUM_VTS_MAX = 17;
+
+int cmp_graph(const graph_t *g, const graph_t *h);
+int cmp_adj_lst(const adj_lst_t *a, const adj_lst_t *b);
+size_t sum_vts(const adj_lst_t *a);
+size_t random_ix(size_t n);
+void print_test_result(int res);
+
+/**
+   Initializes a random graph with n vertices and m edges. The weights
+   are random size_t values if wt_size is sizeof(size_t), random double
+   values if wt_size is sizeof(double) and different from sizeof(size_t),
+   and no weights if wt_size is 0.
+*/
+void rand_graph_init(graph_t *g, size_t n, size_t m, size_t wt_size){
+  size_t i;
+  graph_base_init(g, n, wt_size);
+  g->num_es = m;
+  if (m == 0) return;
+  g->u = malloc_perror(m, sizeof(size_t));
+  g->v = malloc_perror(m, sizeof(size_t));
+  if (wt_size > 0) g->wts = malloc_perror(m, wt_size);
+  for (i = 0; i < m; i++){
+    g->u[i] = random_ix(n);
+    g->v[i] = random_ix(n);
+    if (wt_size == sizeof(size_t)){
+      *((size_t *)g->wts + i) = RANDOM();
+    }else if (wt_size == sizeof(double)){
+      *((double *)g->wts + i) = DRAND();
+    }
+  }
+}
+
+/**
+   Runs a graph_file_{write, read} test on random graphs with size_t,
+   double, and no weights.
+*/
+void run_graph_file_test(size_t log_n, size_t log_m){
+  int res = 1;
+  size_t i;
+  size_t wt_sizes[3];
+  clock_t t_write, t_read;
+  graph_t g, h;
+  wt_sizes[0] = 0;
+  wt_sizes[1] = sizeof(size_t);
+  wt_sizes[2] = sizeof(double);
+  printf("Test graph_file_{write, read} on random graphs\n");
+  for (i = 0; i < 3; i++){
+    rand_graph_init(&g, pow_two_perror(log_n), pow_two_perror(log_m),
+		    wt_sizes[i]);
+    t_write = clock();
+    graph_file_write(&g, C_FNAME);
+    t_write = clock() - t_write;
+    t_read = clock();
+    graph_file_read(&h, C_FNAME);
+    t_read = clock() - t_read;
+    res *= cmp_graph(&g, &h);
+    printf("\tvertices: %lu, edges: %lu, weight size: %lu\n"
+	   "\t\twrite time: %.4f seconds\n"
+	   "\t\tread time:  %.4f seconds\n",
+	   TOLU(g.num_vts), TOLU(g.num_es), TOLU(g.wt_size),
+	   (double)t_write / CLOCKS_PER_SEC,
+	   (double)t_read / CLOCKS_PER_SEC);
+    graph_free(&g);
+    graph_free(&h);
+  }
+  printf("\tcorrectness across all graphs --> ");
+  print_test_result(res);
+  remove(C_FNAME);
+}
+
+/**
+   Runs an adj_lst_file_write and adj_lst_mmap_{open, close} test on
+   random undirected graphs with size_t, double, and no weights. Compares
+   the time of building an adjacency list in CSR format from a graph with
+   the time of mapping the adjacency list and summing its vertices.
+*/
+void run_adj_lst_mmap_test(size_t log_n, size_t log_m){
+  int res = 1;
+  size_t i, sum;
+  size_t wt_sizes[3];
+  clock_t t_build, t_map;
+  graph_t g;
+  adj_lst_t a, a_csr, a_map;
+  wt_sizes[0] = 0;
+  wt_sizes[1] = sizeof(size_t);
+  wt_sizes[2] = sizeof(double);
+  printf("Test adj_lst_file_write and adj_lst_mmap_{open, close} on random "
+	 "undirected graphs\n");
+  for (i = 0; i < 3; i++){
+    rand_graph_init(&g, pow_two_perror(log_n), pow_two_perror(log_m),
+		    wt_sizes[i]);
+    t_build = clock();
+    adj_lst_csr_undir_build(&a_csr, &g);
+    sum = sum_vts(&a_csr);
+    t_build = clock() - t_build;
+    adj_lst_file_write(&a_csr, C_FNAME);
+    t_map = clock();
+    adj_lst_mmap_open(&a_map, C_FNAME);
+    res *= (sum == sum_vts(&a_map));
+    t_map = clock() - t_map;
+    res *= cmp_adj_lst(&a_csr, &a_map);
+    adj_lst_mmap_close(&a_map);
+    /* write from the stack format */
+    adj_lst_init(&a, &g);
+    adj_lst_undir_build(&a, &g);
+    adj_lst_file_write(&a, C_FNAME);
+    adj_lst_mmap_open(&a_map, C_FNAME);
+    res *= cmp_adj_lst(&a_csr, &a_map);
+    adj_lst_mmap_close(&a_map);
+    printf("\tvertices: %lu, edges: %lu, weight size: %lu\n"
+	   "\t\tbuild and traversal time: %.4f seconds\n"
+	   "\t\tmap and traversal time:   %.4f seconds\n",
+	   TOLU(g.num_vts), TOLU(g.num_es), TOLU(g.wt_size),
+	   (double)t_build / CLOCKS_PER_SEC,
+	   (double)t_map / CLOCKS_PER_SEC);
+    adj_lst_free(&a);
+    adj_lst_free(&a_csr);
+    graph_free(&g);
+  }
+  printf("\tcorrectness across all graphs --> ");
+  print_test_result(res);
+  remove(C_FNAME);
+}
+
+/**
+   Runs a test on graphs with no vertices or edges and graphs with a small
+   number of vertices and edges.
+*/
+void run_corner_cases_test(){
+  int res = 1;
+  size_t i, j;
+  graph_t g, h;
+  adj_lst_t a, a_map;
+  for (i = 0; i < C_CORNER_NUM_VTS_MAX; i++){
+    for (j = 0; j < 2; j++){
+      if (i == 0){
+	graph_base_init(&g, 0, j * sizeof(size_t));
+      }else{
+	rand_graph_init(&g, i, i / 2, j * sizeof(size_t));
+      }
+      graph_file_write(&g, C_FNAME);
+      graph_file_read(&h, C_FNAME);
+      res *= cmp_graph(&g, &h);
+      adj_lst_csr_dir_build(&a, &g);
+      adj_lst_file_write(&a, C_FNAME);
+      adj_lst_mmap_open(&a_map, C_FNAME);
+      res *= cmp_adj_lst(&a, &a_map);
+      adj_lst_mmap_close(&a_map);
+      res *= (a_map.offsets == NULL && a_map.pairs == NULL);
+      adj_lst_free(&a);
+      graph_free(&g);
+      graph_free(&h);
+    }
+  }
+  printf("Test graph_file_{write, read}, adj_lst_file_write, and "
+	 "adj_lst_mmap_{open, close} on corner cases --> ");
+  print_test_result(res);
+  remove(C_FNAME);
+}
+
+/**
+   Auxiliary functions.
+*/
+
+/**
+   Compares two graphs, including the order of edges.
+*/
+int cmp_graph(const graph_t *g, const graph_t *h){
+  int res = 1;
+  res *= (g->num_vts == h->num_vts);
+  res *= (g->num_es == h->num_es);
+  res *= (g->wt_size == h->wt_size);
+  if (!res || g->num_es == 0) return res;
+  res *= (memcmp(g->u, h->u, g->num_es * sizeof(size_t)) == 0);
+  res *= (memcmp(g->v, h->v, g->num_es * sizeof(size_t)) == 0);
+  if (g->wt_size > 0){
+    res *= (memcmp(g->wts, h->wts, g->num_es * g->wt_size) == 0);
+  }
+  return res;
+}
+
+/**
+   Compares two adjacency lists, including the order of the vertices and
+   weights in each list.
+*/
+int cmp_adj_lst(const adj_lst_t *a, const adj_lst_t *b){
+  int res = 1;
+  size_t i, j, num;
+  const char *p = NULL, *q = NULL;
+  res *= (a->num_vts == b->num_vts);
+  res *= (a->num_es == b->num_es);
+  res *= (a->wt_size == b->wt_size);
+  res *= (a->pair_size == b->pair_size);
+  res *= (a->offset == b->offset);
+  if (!res) return res;
+  for (i = 0; i < a->num_vts; i++){
+    num = adj_lst_vt_num_pairs(a, i);
+    res *= (num == adj_lst_vt_num_pairs(b, i));
+    if (!res) return res;
+    p = adj_lst_vt_pairs(a, i);
+    q = adj_lst_vt_pairs(b, i);
+    for (j = 0; j < num; j++){
+      res *= (*(const size_t *)p == *(const size_t *)q);
+      res *= (memcmp(p + a->offset, q + b->offset, a->wt_size) == 0);
+      p += a->pair_size;
+      q += b->pair_size;
+    }
+  }
+  return res;
+}
+
+/**
+   Sums the vertices in all lists of an adjacency list. Wraps around and
+   does not check for overflow.
+*/
+size_t sum_vts(const adj_lst_t *a){
+  size_t i, ret = 0;
+  const char *p = NULL, *p_start = NULL, *p_end = NULL;
+  for (i = 0; i < a->num_vts; i++){
+    p_start = adj_lst_vt_pairs(a, i);
+    p_end = p_start + adj_lst_vt_num_pairs(a, i) * a->pair_size;
+    for (p = p_start; p != p_end; p += a->pair_size){
+      ret += *(const size_t *)p;
+    }
+  }
+  return ret;
+}
+
+/**
+   Returns a random index in [0, n), where n > 0.
+*/
+size_t random_ix(size_t n){
+  size_t ret = 0;
+  size_t rem = n - 1;
+  while (rem > 0){
+    ret = (ret << (CHAR_BIT - 1)) ^ (size_t)RANDOM();
+    rem >>= CHAR_BIT - 1;
+  }
+  return ret % n;
+}
+
+void print_test_result(int res){
+  if (res){
+    printf("SUCCESS\n");
+  }else{
+    printf("FAILURE\n");
+  }
+}
+
+int main(int argc, char *argv[]){
+  int i;
+  size_t *args = NULL;
+  RGENS_SEED();
+  if (argc > C_ARGC_MAX){
+    printf("USAGE:\n%s", C_USAGE);
+    exit(EXIT_FAILURE);
+  }
+  args = malloc_perror(C_ARGC_MAX - 1, sizeof(size_t));
+  memcpy(args, C_ARGS_DEF, (C_ARGC_MAX - 1) * sizeof(size_t));
+  for (i = 1; i < argc; i++){
+    args[i - 1] = atoi(argv[i]);
+  }
+  if (args[0] > C_FULL_BIT / 2 ||
+      args[1] > C_FULL_BIT - 2 ||
+      args[2] > 1 ||
+      args[3] > 1 ||
+      args[4] > 1){
+    printf("USAGE:\n%s", C_USAGE);
+    exit(EXIT_FAILURE);
+  }
+  if (args[2]) run_graph_file_test(args[0], args[1]);
+  if (args[3]) run_adj_lst_mmap_test(args[0], args[1]);
+  if (args[4]) run_corner_cases_test();
+  free(args);
+  args = NULL;
+  return 0;
+}
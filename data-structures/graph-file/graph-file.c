@@ -0,0 +1,463 @@
+/**
+   graph-file.c
+
+   Functions for writing and reading a graph with generic weights in a
+   binary file format, and for mapping the adjacency list of a graph in
+   CSR format from a file read-only into memory without parsing or
+   copying.
+
+   A file consists of a header, followed by blocks that are aligned in the
+   file according to the alignment recorded in the header. The header
+   consists of an 8-byte tag and a sequence of size_t values:
+
+     tag                 : "GRAPHEDG" for a graph_t, "GRAPHCSR" for an
+                           adjacency list in CSR format
+     size of size_t      : sizeof(size_t) of the writing system
+     byte order          : C_BYTE_ORDER in the byte order of the writing
+                           system
+     num_vts, num_es     : number of vertices and edges (vertex weight pairs
+                           in an adjacency list)
+     wt_size             : 0 if a graph is unweighted, > 0 otherwise
+     pair_size, offset   : vertex weight pair layout of an adjacency list as
+                           in graph.h, 0 for a graph_t
+     alignment           : alignment of a size_t block or weight block
+     block positions     : u, v, wts of a graph_t, or offsets, pairs,
+                           unused of an adjacency list
+     file size           : size of the file in bytes
+
+   The alignment is the greater of sizeof(size_t) and wt_size. Because a
+   mapping starts at a page boundary, the offsets and pairs of a mapped
+   adjacency list are aligned in memory as in a block returned by malloc.
+   Blocks are written and read sequentially with stdio, and padding is
+   written as zero bytes.
+
+   The implementation does not use stdint.h and is portable under C89/C90
+   and C99. The requirements are: i) sizeof(size_t) and the size of a
+   generic weight are powers of two, and ii) POSIX mmap is available.
+*/
+
+#define _XOPEN_SOURCE 600
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "graph-file.h"
+#include "graph.h"
+#include "utilities-mem.h"
+
+/* header values after the tag */
+enum{HDR_SZ_SIZE,
+     HDR_BYTE_ORDER,
+     HDR_NUM_VTS,
+     HDR_NUM_ES,
+     HDR_WT_SIZE,
+     HDR_PAIR_SIZE,
+     HDR_OFFSET,
+     HDR_ALIGNMENT,
+     HDR_POS_A, /* u or offsets */
+     HDR_POS_B, /* v or pairs */
+     HDR_POS_C, /* wts or unused */
+     HDR_FILE_SIZE,
+     HDR_NUM};
+
+static const char C_TAG_EDG[8] = {'G', 'R', 'A', 'P', 'H', 'E', 'D', 'G'};
+static const char C_TAG_CSR[8] = {'G', 'R', 'A', 'P', 'H', 'C', 'S', 'R'};
+static const size_t C_TAG_SIZE = 8;
+static const size_t C_BYTE_ORDER = 0x0102;
+static const size_t C_PAD_SIZE = 64; /* zero bytes per padding write */
+
+static size_t hdr_size(void);
+static size_t alignment(size_t wt_size);
+static size_t align_up(size_t n, size_t align);
+static void pair_layout(size_t wt_size, size_t *pair_size, size_t *offset);
+static FILE *fopen_perror(const char *fname, const char *mode);
+static void fclose_perror(FILE *f);
+static void write_at(FILE *f,
+		     size_t *cur,
+		     size_t pos,
+		     const void *p,
+		     size_t n,
+		     const char *fname);
+static void read_at(FILE *f,
+		    size_t *cur,
+		    size_t pos,
+		    void *p,
+		    size_t n,
+		    const char *fname);
+static void check_hdr(const char *tag,
+		      const char *ftag,
+		      const size_t *hdr,
+		      size_t file_size,
+		      const char *fname);
+static void file_error_exit(const char *fname, const char *s);
+
+/**
+   Writes a graph to a file in the graph_t binary format. Exits with an
+   error message if the file cannot be written.
+   g           : pointer to a graph previously constructed with at least
+                 graph_base_init
+   fname       : path of the file, which is created or truncated
+*/
+void graph_file_write(const graph_t *g, const char *fname){
+  size_t cur = 0;
+  size_t es_size = mul_sz_perror(g->num_es, sizeof(size_t));
+  size_t wts_size = 0;
+  size_t hdr[HDR_NUM];
+  FILE *f = NULL;
+  if (g->wt_size > 0) wts_size = mul_sz_perror(g->num_es, g->wt_size);
+  hdr[HDR_SZ_SIZE] = sizeof(size_t);
+  hdr[HDR_BYTE_ORDER] = C_BYTE_ORDER;
+  hdr[HDR_NUM_VTS] = g->num_vts;
+  hdr[HDR_NUM_ES] = g->num_es;
+  hdr[HDR_WT_SIZE] = g->wt_size;
+  hdr[HDR_PAIR_SIZE] = 0;
+  hdr[HDR_OFFSET] = 0;
+  hdr[HDR_ALIGNMENT] = alignment(g->wt_size);
+  hdr[HDR_POS_A] = align_up(hdr_size(), hdr[HDR_ALIGNMENT]);
+  hdr[HDR_POS_B] = align_up(add_sz_perror(hdr[HDR_POS_A], es_size),
+			    hdr[HDR_ALIGNMENT]);
+  hdr[HDR_POS_C] = align_up(add_sz_perror(hdr[HDR_POS_B], es_size),
+			    hdr[HDR_ALIGNMENT]);
+  hdr[HDR_FILE_SIZE] = add_sz_perror(hdr[HDR_POS_C], wts_size);
+  f = fopen_perror(fname, "wb");
+  write_at(f, &cur, 0, C_TAG_EDG, C_TAG_SIZE, fname);
+  write_at(f, &cur, C_TAG_SIZE, hdr, sizeof(hdr), fname);
+  write_at(f, &cur, hdr[HDR_POS_A], g->u, es_size, fname);
+  write_at(f, &cur, hdr[HDR_POS_B], g->v, es_size, fname);
+  write_at(f, &cur, hdr[HDR_POS_C], g->wts, wts_size, fname);
+  fclose_perror(f);
+}
+
+/**
+   Reads a graph from a file in the graph_t binary format into memory.
+   The graph is freed with graph_free. Exits with an error message if
+   the file cannot be read or is not a valid graph_t file on a given
+   system.
+   g           : pointer to a preallocated block of size sizeof(graph_t)
+   fname       : path of the file
+*/
+void graph_file_read(graph_t *g, const char *fname){
+  size_t cur = 0;
+  size_t es_size, wts_size;
+  size_t hdr[HDR_NUM];
+  char ftag[8];
+  FILE *f = NULL;
+  f = fopen_perror(fname, "rb");
+  read_at(f, &cur, 0, ftag, C_TAG_SIZE, fname);
+  read_at(f, &cur, C_TAG_SIZE, hdr, sizeof(hdr), fname);
+  check_hdr(C_TAG_EDG, ftag, hdr, hdr[HDR_FILE_SIZE], fname);
+  graph_base_init(g, hdr[HDR_NUM_VTS], hdr[HDR_WT_SIZE]);
+  g->num_es = hdr[HDR_NUM_ES];
+  es_size = g->num_es * sizeof(size_t); /* checked by check_hdr */
+  wts_size = g->num_es * g->wt_size;
+  if (g->num_es > 0){
+    g->u = malloc_perror(g->num_es, sizeof(size_t));
+    g->v = malloc_perror(g->num_es, sizeof(size_t));
+    read_at(f, &cur, hdr[HDR_POS_A], g->u, es_size, fname);
+    read_at(f, &cur, hdr[HDR_POS_B], g->v, es_size, fname);
+    if (g->wt_size > 0){
+      g->wts = malloc_perror(g->num_es, g->wt_size);
+      read_at(f, &cur, hdr[HDR_POS_C], g->wts, wts_size, fname);
+    }
+  }
+  fclose_perror(f);
+}
+
+/**
+   Writes an adjacency list in either format to a file in the CSR binary
+   format. Exits with an error message if the file cannot be written.
+   a           : pointer to an adjacency list in either format
+   fname       : path of the file, which is created or truncated
+*/
+void adj_lst_file_write(const adj_lst_t *a, const char *fname){
+  size_t i, cur = 0, num_pairs = 0;
+  size_t offsets_size = mul_sz_perror(add_sz_perror(a->num_vts, 1),
+				      sizeof(size_t));
+  size_t hdr[HDR_NUM];
+  FILE *f = NULL;
+  hdr[HDR_SZ_SIZE] = sizeof(size_t);
+  hdr[HDR_BYTE_ORDER] = C_BYTE_ORDER;
+  hdr[HDR_NUM_VTS] = a->num_vts;
+  hdr[HDR_NUM_ES] = a->num_es;
+  hdr[HDR_WT_SIZE] = a->wt_size;
+  hdr[HDR_PAIR_SIZE] = a->pair_size;
+  hdr[HDR_OFFSET] = a->offset;
+  hdr[HDR_ALIGNMENT] = alignment(a->wt_size);
+  hdr[HDR_POS_A] = align_up(hdr_size(), hdr[HDR_ALIGNMENT]);
+  hdr[HDR_POS_B] = align_up(add_sz_perror(hdr[HDR_POS_A], offsets_size),
+			    hdr[HDR_ALIGNMENT]);
+  hdr[HDR_POS_C] = 0;
+  hdr[HDR_FILE_SIZE] =
+    add_sz_perror(hdr[HDR_POS_B], mul_sz_perror(a->num_es, a->pair_size));
+  f = fopen_perror(fname, "wb");
+  write_at(f, &cur, 0, C_TAG_CSR, C_TAG_SIZE, fname);
+  write_at(f, &cur, C_TAG_SIZE, hdr, sizeof(hdr), fname);
+  write_at(f, &cur, hdr[HDR_POS_A], &num_pairs, sizeof(size_t), fname);
+  for (i = 0; i < a->num_vts; i++){
+    num_pairs += adj_lst_vt_num_pairs(a, i);
+    write_at(f, &cur, cur, &num_pairs, sizeof(size_t), fname);
+  }
+  if (num_pairs != a->num_es){
+    file_error_exit(fname, "number of pairs is not equal to num_es");
+  }
+  for (i = 0; i < a->num_vts; i++){
+    write_at(f,
+	     &cur,
+	     (i == 0) ? hdr[HDR_POS_B] : cur,
+	     adj_lst_vt_pairs(a, i),
+	     adj_lst_vt_num_pairs(a, i) * a->pair_size,
+	     fname);
+  }
+  write_at(f, &cur, hdr[HDR_FILE_SIZE], NULL, 0, fname);
+  fclose_perror(f);
+}
+
+/**
+   Maps an adjacency list in CSR format read-only from a file written by
+   adj_lst_file_write. The offsets and pairs of the adjacency list point
+   into the mapping, and the list can be passed to the graph algorithms
+   that take a const adj_lst_t *. Exits with an error message if the file
+   cannot be mapped or is not a valid adjacency list file on a given
+   system. In addition to the header, the num_vts + 1 offsets are
+   validated to be non-decreasing from 0 to num_es in one O(num_vts)
+   pass. The vertices in the pairs are not validated, because a validation
+   would read the entire pairs block; the file is trusted to contain
+   vertices less than num_vts, otherwise the graph algorithms may read
+   out of bounds.
+   a           : pointer to a preallocated block of size sizeof(adj_lst_t)
+   fname       : path of the file
+*/
+void adj_lst_mmap_open(adj_lst_t *a, const char *fname){
+  int fd;
+  size_t i;
+  size_t file_size;
+  size_t hdr[HDR_NUM];
+  char *m = NULL;
+  void *ret = MAP_FAILED;
+  struct stat st;
+  fd = open(fname, O_RDONLY);
+  if (fd == -1){
+    perror("adj_lst_mmap_open open failed");
+    exit(EXIT_FAILURE);
+  }
+  if (fstat(fd, &st) == -1){
+    perror("adj_lst_mmap_open fstat failed");
+    exit(EXIT_FAILURE);
+  }
+  file_size = st.st_size;
+  if (st.st_size < 0 ||
+      (off_t)file_size != st.st_size ||
+      file_size < hdr_size()){
+    file_error_exit(fname, "not a valid adjacency list file");
+  }
+  ret = mmap(NULL, file_size, PROT_READ, MAP_SHARED, fd, 0);
+  if (ret == MAP_FAILED){
+    perror("adj_lst_mmap_open mmap failed");
+    exit(EXIT_FAILURE);
+  }
+  close(fd);
+  m = ret;
+  memcpy(hdr, m + C_TAG_SIZE, sizeof(hdr));
+  check_hdr(C_TAG_CSR, m, hdr, file_size, fname);
+  a->num_vts = hdr[HDR_NUM_VTS];
+  a->num_es = hdr[HDR_NUM_ES];
+  a->wt_size = hdr[HDR_WT_SIZE];
+  a->pair_size = hdr[HDR_PAIR_SIZE];
+  a->offset = hdr[HDR_OFFSET];
+  a->buf = NULL;
+  a->vt_wts = NULL;
+  a->offsets = (size_t *)(m + hdr[HDR_POS_A]);
+  a->pairs = m + hdr[HDR_POS_B];
+  if (a->offsets[0] != 0 || a->offsets[a->num_vts] != a->num_es){
+    file_error_exit(fname, "not a valid adjacency list file");
+  }
+  for (i = 0; i < a->num_vts; i++){
+    if (a->offsets[i] > a->offsets[i + 1]){
+      file_error_exit(fname, "not a valid adjacency list file");
+    }
+  }
+}
+
+/**
+   Unmaps an adjacency list mapped by adj_lst_mmap_open and leaves a block
+   of size sizeof(adj_lst_t) pointed to by the a parameter. A mapped
+   adjacency list is not freed with adj_lst_free.
+*/
+void adj_lst_mmap_close(adj_lst_t *a){
+  size_t hdr[HDR_NUM];
+  char *m = NULL;
+  m = (char *)a->offsets - align_up(hdr_size(), alignment(a->wt_size));
+  memcpy(hdr, m + C_TAG_SIZE, sizeof(hdr));
+  munmap(m, hdr[HDR_FILE_SIZE]);
+  a->offsets = NULL;
+  a->pairs = NULL;
+}
+
+/** Helper functions */
+
+/**
+   Returns the size of a header, including the tag.
+*/
+static size_t hdr_size(void){
+  return C_TAG_SIZE + HDR_NUM * sizeof(size_t);
+}
+
+/**
+   Returns the alignment of the blocks in a file with a weight size.
+*/
+static size_t alignment(size_t wt_size){
+  return (wt_size > sizeof(size_t)) ? wt_size : sizeof(size_t);
+}
+
+/**
+   Rounds n up to a multiple of align, which is a power of two.
+*/
+static size_t align_up(size_t n, size_t align){
+  return add_sz_perror(n, align - 1) & ~(align - 1);
+}
+
+/**
+   Computes the vertex weight pair layout of adj_lst_init in graph.h.
+*/
+static void pair_layout(size_t wt_size, size_t *pair_size, size_t *offset){
+  if (wt_size == 0){
+    *pair_size = sizeof(size_t);
+    *offset = 0;
+  }else if (wt_size <= sizeof(size_t)){
+    *pair_size = 2 * sizeof(size_t);
+    *offset = sizeof(size_t);
+  }else{
+    *pair_size = 2 * wt_size;
+    *offset = wt_size;
+  }
+}
+
+/**
+   Opens a file with stdio and exits if the file cannot be opened.
+*/
+static FILE *fopen_perror(const char *fname, const char *mode){
+  FILE *f = fopen(fname, mode);
+  if (f == NULL){
+    perror("graph file fopen failed");
+    exit(EXIT_FAILURE);
+  }
+  return f;
+}
+
+static void fclose_perror(FILE *f){
+  if (fclose(f) == EOF){
+    perror("graph file fclose failed");
+    exit(EXIT_FAILURE);
+  }
+}
+
+/**
+   Writes zero padding from the current position *cur upto pos >= *cur,
+   and then n bytes pointed to by p, and updates *cur.
+*/
+static void write_at(FILE *f,
+		     size_t *cur,
+		     size_t pos,
+		     const void *p,
+		     size_t n,
+		     const char *fname){
+  static const char pad[64] = {0};
+  size_t k;
+  while (*cur < pos){
+    k = (pos - *cur < C_PAD_SIZE) ? pos - *cur : C_PAD_SIZE;
+    if (fwrite(pad, 1, k, f) != k){
+      file_error_exit(fname, "write failed");
+    }
+    *cur += k;
+  }
+  if (n > 0 && fwrite(p, 1, n, f) != n){
+    file_error_exit(fname, "write failed");
+  }
+  *cur += n;
+}
+
+/**
+   Skips the padding from the current position *cur upto pos >= *cur,
+   and then reads n bytes into the block pointed to by p, and updates *cur.
+*/
+static void read_at(FILE *f,
+		    size_t *cur,
+		    size_t pos,
+		    void *p,
+		    size_t n,
+		    const char *fname){
+  char pad[64];
+  size_t k;
+  while (*cur < pos){
+    k = (pos - *cur < C_PAD_SIZE) ? pos - *cur : C_PAD_SIZE;
+    if (fread(pad, 1, k, f) != k){
+      file_error_exit(fname, "read failed");
+    }
+    *cur += k;
+  }
+  if (n > 0 && fread(p, 1, n, f) != n){
+    file_error_exit(fname, "read failed");
+  }
+  *cur += n;
+}
+
+/**
+   Checks the tag and the values of a header against the tag of a format,
+   the size of size_t and byte order of a given system, and the size of a
+   file. Exits with an error message if a check fails.
+*/
+static void check_hdr(const char *tag,
+		      const char *ftag,
+		      const size_t *hdr,
+		      size_t file_size,
+		      const char *fname){
+  size_t pair_size, offset, num;
+  const size_t *h = hdr;
+  if (memcmp(tag, ftag, C_TAG_SIZE) != 0){
+    file_error_exit(fname, "tag does not match the format");
+  }
+  if (h[HDR_SZ_SIZE] != sizeof(size_t) ||
+      h[HDR_BYTE_ORDER] != C_BYTE_ORDER){
+    file_error_exit(fname, "size of size_t or byte order does not match");
+  }
+  if (h[HDR_WT_SIZE] & (h[HDR_WT_SIZE] - 1) ||
+      h[HDR_ALIGNMENT] != alignment(h[HDR_WT_SIZE]) ||
+      h[HDR_FILE_SIZE] != file_size ||
+      h[HDR_POS_A] != align_up(hdr_size(), h[HDR_ALIGNMENT]) ||
+      h[HDR_POS_A] > file_size){
+    file_error_exit(fname, "header is not valid");
+  }
+  if (tag == C_TAG_EDG){
+    if (h[HDR_NUM_ES] > (file_size - h[HDR_POS_A]) / sizeof(size_t) ||
+	h[HDR_POS_B] < h[HDR_POS_A] + h[HDR_NUM_ES] * sizeof(size_t) ||
+	h[HDR_POS_C] < h[HDR_POS_B] + h[HDR_NUM_ES] * sizeof(size_t) ||
+	h[HDR_POS_C] > file_size ||
+	(h[HDR_WT_SIZE] > 0 &&
+	 h[HDR_NUM_ES] > (file_size - h[HDR_POS_C]) / h[HDR_WT_SIZE])){
+      file_error_exit(fname, "header is not valid");
+    }
+  }else{
+    pair_layout(h[HDR_WT_SIZE], &pair_size, &offset);
+    num = h[HDR_NUM_VTS];
+    if (h[HDR_PAIR_SIZE] != pair_size ||
+	h[HDR_OFFSET] != offset ||
+	num >= (file_size - h[HDR_POS_A]) / sizeof(size_t) ||
+	h[HDR_POS_B] < h[HDR_POS_A] + (num + 1) * sizeof(size_t) ||
+	h[HDR_POS_B] > file_size ||
+	h[HDR_NUM_ES] > (file_size - h[HDR_POS_B]) / pair_size){
+      file_error_exit(fname, "header is not valid");
+    }
+  }
+}
+
+/**
+   Prints an error message with a file name and exits.
+*/
+static void file_error_exit(const char *fname, const char *s){
+  fprintf(stderr, "%s: %s\n", fname, s);
+  exit(EXIT_FAILURE);
+}
@@ -0,0 +1,101 @@
+/**
+   graph-file.h
+
+   Declarations of accessible functions for writing and reading a graph
+   with generic weights in a binary file format, and for mapping the
+   adjacency list of a graph in CSR format from a file read-only into
+   memory without parsing or copying.
+
+   A file consists of a header, followed by blocks that are aligned in the
+   file according to the alignment recorded in the header. The header
+   consists of an 8-byte tag and a sequence of size_t values:
+
+     tag                 : "GRAPHEDG" for a graph_t, "GRAPHCSR" for an
+                           adjacency list in CSR format
+     size of size_t      : sizeof(size_t) of the writing system
+     byte order          : C_BYTE_ORDER in the byte order of the writing
+                           system
+     num_vts, num_es     : number of vertices and edges (vertex weight pairs
+                           in an adjacency list)
+     wt_size             : 0 if a graph is unweighted, > 0 otherwise
+     pair_size, offset   : vertex weight pair layout of an adjacency list as
+                           in graph.h, 0 for a graph_t
+     alignment           : alignment of a size_t block or weight block
+     block positions     : u, v, wts of a graph_t, or offsets, pairs,
+                           unused of an adjacency list
+     file size           : size of the file in bytes
+
+   An adjacency list file contains num_vts + 1 offsets and num_es pairs in
+   the layout of adj_lst_csr_* in graph.h. A file is read on a system with
+   the same size of size_t, byte order, and weight type representation as
+   the writing system, which is checked with the exception of the weight
+   type representation.
+
+   Mapping enables processes that repeatedly load the same large graph to
+   share the page cache copy of the adjacency list, and to run graph
+   algorithms immediately after the file is mapped. A mapped adjacency
+   list is immutable and is closed with adj_lst_mmap_close.
+
+   The implementation does not use stdint.h and is portable under C89/C90
+   and C99. The requirements are: i) sizeof(size_t) and the size of a
+   generic weight are powers of two, and ii) POSIX mmap is available.
+*/
+
+#ifndef GRAPH_FILE_H
+#define GRAPH_FILE_H
+
+#include <stddef.h>
+#include "graph.h"
+
+/**
+   Writes a graph to a file in the graph_t binary format. Exits with an
+   error message if the file cannot be written.
+   g           : pointer to a graph previously constructed with at least
+                 graph_base_init
+   fname       : path of the file, which is created or truncated
+*/
+void graph_file_write(const graph_t *g, const char *fname);
+
+/**
+   Reads a graph from a file in the graph_t binary format into memory.
+   The graph is freed with graph_free. Exits with an error message if
+   the file cannot be read or is not a valid graph_t file on a given
+   system.
+   g           : pointer to a preallocated block of size sizeof(graph_t)
+   fname       : path of the file
+*/
+void graph_file_read(graph_t *g, const char *fname);
+
+/**
+   Writes an adjacency list in either format to a file in the CSR binary
+   format. Exits with an error message if the file cannot be written.
+   a           : pointer to an adjacency list in either format
+   fname       : path of the file, which is created or truncated
+*/
+void adj_lst_file_write(const adj_lst_t *a, const char *fname);
+
+/**
+   Maps an adjacency list in CSR format read-only from a file written by
+   adj_lst_file_write. The offsets and pairs of the adjacency list point
+   into the mapping, and the list can be passed to the graph algorithms
+   that take a const adj_lst_t *. Exits with an error message if the file
+   cannot be mapped or is not a valid adjacency list file on a given
+   system. In addition to the header, the num_vts + 1 offsets are
+   validated to be non-decreasing from 0 to num_es in one O(num_vts)
+   pass. The vertices in the pairs are not validated, because a validation
+   would read the entire pairs block; the file is trusted to contain
+   vertices less than num_vts, otherwise the graph algorithms may read
+   out of bounds.
+   a           : pointer to a preallocated block of size sizeof(adj_lst_t)
+   fname       : path of the file
+*/
+void adj_lst_mmap_open(adj_lst_t *a, const char *fname);
+
+/**
+   Unmaps an adjacency list mapped by adj_lst_mmap_open and leaves a block
+   of size sizeof(adj_lst_t) pointed to by the a parameter. A mapped
+   adjacency list is not freed with adj_lst_free.
+*/
+void adj_lst_mmap_close(adj_lst_t *a);
+
+#endif
@@ -33,6 +33,7 @@
 #include <string.h>
 #include <limits.h>
 #include <time.h>
+#include <math.h>
 #include "graph.h"
 #include "stack.h"
 #include "utilities-mem.h"
@@ -87,8 +88,32 @@ const size_t C_CORNER_NUM_VTS_MAX = 100;
 const double C_PROB_ONE = 1.0;
 const double C_PROB_HALF = 0.5;
 const double C_PROB_ZERO = 0.0;
+const double C_DEG_SPARSE = 8.0;
+const size_t C_SIZE_MAX = (size_t)-1;
+
+/* R-MAT and Chung-Lu tests */
+const size_t C_GEN_DEG = 16;
+const double C_RMAT_PROBS[3] = {0.57, 0.19, 0.19};
+const double C_RMAT_UNIF = 0.25;
+const double C_RMAT_DRANDS[4] = {0.1, 0.3, 0.6, 0.9};
+const double C_POW_EXP = 2.5; /* exponent of a power-law degree sequence */
+
+/* sort test */
+const size_t C_SORT_DEGS[2] = {16, 256};
+const size_t C_QUERY_COUNT = 100000;
+const size_t C_COMMON_COUNT = 1000;
+
+/* skip test */
+const size_t C_SKIP_NUM_VTS_MAX = 20;
+const size_t C_SKIPS_COUNT = 8;
+const size_t C_SKIPS[8] = {0, 3, 1, 7, 2, 0, 0, 5};
 
 size_t sum_vts(const adj_lst_t *a, size_t i);
+int cmp_sorted_lst(const adj_cmp_t *c, const adj_lst_t *a);
+int cmp_uint_lst(const adj_uint_t *u, const adj_lst_t *a);
+int cmp_adj_lst(const adj_lst_t *a, const adj_lst_t *b);
+int cmp_batch_lst(const adj_lst_t *a, const adj_lst_t *b);
+int cmp_vt(const void *a, const void *b);
 void print_uint(const void *a);
 void print_double(const void *a);
 void print_adj_lst(const adj_lst_t *a, void (*print_wt)(const void *));
@@ -160,6 +185,16 @@ void run_uint_graph_test(){
   uint_graph_helper(&a, C_NUMS_UNDIR, C_VTS_UNDIR, C_WTS_UINT_UNDIR);
   print_adj_lst(&a, print_uint);
   adj_lst_free(&a);
+  printf("Test adj_lst_csr_{dir_build, free} on a directed graph "
+	 "with size_t weights --> ");
+  adj_lst_csr_dir_build(&a, &g);
+  uint_graph_helper(&a, C_NUMS_DIR, C_VTS_DIR, C_WTS_UINT_DIR);
+  adj_lst_free(&a);
+  printf("Test adj_lst_csr_{undir_build, free} on an undirected "
+	 "graph with size_t weights --> ");
+  adj_lst_csr_undir_build(&a, &g);
+  uint_graph_helper(&a, C_NUMS_UNDIR, C_VTS_UNDIR, C_WTS_UINT_UNDIR);
+  adj_lst_free(&a);
   graph_free(&g);
 }
 
@@ -172,8 +207,8 @@ void uint_graph_helper(const adj_lst_t *a,
   size_t ix = 0;
   size_t i;
   for (i = 0; i < a->num_vts; i++){
-    res *= (nums[i] == a->vt_wts[i]->num_elts);
-    p_start = a->vt_wts[i]->elts;
+    res *= (nums[i] == adj_lst_vt_num_pairs(a, i));
+    p_start = adj_lst_vt_pairs(a, i);
     p_end = p_start + nums[i] * a->pair_size;
     for (p = p_start; p != p_end; p += a->pair_size){
       res *= (*(size_t *)p == vts[ix]);
@@ -212,6 +247,16 @@ void run_double_graph_test(){
   double_graph_helper(&a, C_NUMS_UNDIR, C_VTS_UNDIR, C_WTS_DOUBLE_UNDIR); 
   print_adj_lst(&a, print_double);
   adj_lst_free(&a);
+  printf("Test adj_lst_csr_{dir_build, free} on a directed graph "
+	 "with double weights --> ");
+  adj_lst_csr_dir_build(&a, &g);
+  double_graph_helper(&a, C_NUMS_DIR, C_VTS_DIR, C_WTS_DOUBLE_DIR);
+  adj_lst_free(&a);
+  printf("Test adj_lst_csr_{undir_build, free} on an undirected "
+	 "graph with double weights --> ");
+  adj_lst_csr_undir_build(&a, &g);
+  double_graph_helper(&a, C_NUMS_UNDIR, C_VTS_UNDIR, C_WTS_DOUBLE_UNDIR);
+  adj_lst_free(&a);
   graph_free(&g);
 }
 
@@ -224,8 +269,8 @@ void double_graph_helper(const adj_lst_t *a,
   size_t ix = 0;
   size_t i;
   for (i = 0; i < a->num_vts; i++){
-    res *= (nums[i] == a->vt_wts[i]->num_elts);
-    p_start = a->vt_wts[i]->elts;
+    res *= (nums[i] == adj_lst_vt_num_pairs(a, i));
+    p_start = adj_lst_vt_pairs(a, i);
     p_end = p_start + nums[i] * a->pair_size;
     for (p = p_start; p != p_end; p += a->pair_size){
       res *= (*(size_t *)p == vts[ix]);
@@ -243,6 +288,7 @@ void double_graph_helper(const adj_lst_t *a,
 */
 
 void corner_cases_helper(const adj_lst_t *a, size_t num_vts, int *res);
+void corner_cases_csr_helper(const adj_lst_t *a, size_t num_vts, int *res);
   
 void run_corner_cases_test(){
   int res = 1;
@@ -265,10 +311,22 @@ void run_corner_cases_test(){
 	    a.wt_size == 0);
     corner_cases_helper(&a, i, &res);
     adj_lst_free(&a);
+    adj_lst_csr_dir_build(&a, &g);
+    res *= (a.num_vts == i &&
+	    a.num_es == 0 &&
+	    a.wt_size == 0);
+    corner_cases_csr_helper(&a, i, &res);
+    adj_lst_free(&a);
+    adj_lst_csr_undir_build(&a, &g);
+    res *= (a.num_vts == i &&
+	    a.num_es == 0 &&
+	    a.wt_size == 0);
+    corner_cases_csr_helper(&a, i, &res);
+    adj_lst_free(&a);
     graph_free(&g);
   }
-  printf("Test adj_lst_{init, dir_build, undir_build, free} "
-	 "on corner cases --> ");
+  printf("Test adj_lst_{init, dir_build, undir_build, free} and "
+	 "adj_lst_csr_{dir_build, undir_build} on corner cases --> ");
   print_test_result(res);
 }
 
@@ -284,6 +342,14 @@ void corner_cases_helper(const adj_lst_t *a, size_t num_vts, int *res){
   }
 }
 
+void corner_cases_csr_helper(const adj_lst_t *a, size_t num_vts, int *res){
+  size_t i;
+  *res *= (a->vt_wts == NULL && a->offsets != NULL);
+  for(i = 0; i < num_vts; i++){
+    *res *= (adj_lst_vt_num_pairs(a, i) == 0);
+  }
+}
+
 /**
    Test on non-random graphs.
 */
@@ -337,6 +403,140 @@ void run_adj_lst_undir_build_test(int log_start, int log_end){
   }
 }
 
+/**
+   Runs a adj_lst_csr_undir_build test on complete unweighted graphs, and
+   compares the lists with the lists built by adj_lst_undir_build and
+   with the lists copied by adj_lst_csr_copy.
+*/
+void run_adj_lst_csr_undir_build_test(int log_start, int log_end){
+  int res = 1;
+  int l;
+  size_t i;
+  graph_t g;
+  adj_lst_t a, a_csr, a_cp;
+  clock_t t;
+  printf("Test adj_lst_csr_undir_build on complete unweighted graphs \n");
+  printf("\tn vertices, n(n - 1)/2 edges represented by n(n - 1) "
+	 "directed edges \n");
+  for (l = log_start; l <= log_end; l++){
+    complete_graph_init(&g, pow_two_perror(l));
+    adj_lst_init(&a, &g);
+    adj_lst_undir_build(&a, &g);
+    t = clock();
+    adj_lst_csr_undir_build(&a_csr, &g);
+    t = clock() - t;
+    printf("\t\tvertices: %lu, "
+	   "directed edges: %lu, "
+	   "build time: %.6f seconds\n",
+	   TOLU(a_csr.num_vts), TOLU(a_csr.num_es),
+	   (float)t / CLOCKS_PER_SEC);
+    fflush(stdout);
+    adj_lst_csr_copy(&a_cp, &a);
+    res *= (a.num_vts == a_csr.num_vts && a.num_es == a_csr.num_es);
+    res *= (a.num_vts == a_cp.num_vts && a.num_es == a_cp.num_es);
+    for (i = 0; i < a.num_vts; i++){
+      res *= (adj_lst_vt_num_pairs(&a, i) ==
+	      adj_lst_vt_num_pairs(&a_csr, i));
+      res *= (adj_lst_vt_num_pairs(&a, i) ==
+	      adj_lst_vt_num_pairs(&a_cp, i));
+      res *= (memcmp(adj_lst_vt_pairs(&a, i),
+		     adj_lst_vt_pairs(&a_csr, i),
+		     adj_lst_vt_num_pairs(&a, i) * a.pair_size) == 0);
+      res *= (memcmp(adj_lst_vt_pairs(&a, i),
+		     adj_lst_vt_pairs(&a_cp, i),
+		     adj_lst_vt_num_pairs(&a, i) * a.pair_size) == 0);
+    }
+    adj_lst_free(&a);
+    adj_lst_free(&a_csr);
+    adj_lst_free(&a_cp);
+    graph_free(&g);
+  }
+  printf("\t\tcorrectness across all builds --> ");
+  print_test_result(res);
+}
+
+/**
+   Runs adj_cmp_{dir, undir}_build and adj_cmp_copy tests on a small
+   weighted graph, and compares the decoded lists with the sorted lists.
+*/
+void run_adj_cmp_small_graph_test(){
+  int res = 1;
+  graph_t g;
+  adj_lst_t a;
+  adj_cmp_t c;
+  uint_graph_init(&g);
+  adj_cmp_dir_build(&c, &g);
+  adj_lst_csr_dir_build(&a, &g);
+  res *= (c.num_vts == a.num_vts && c.num_es == a.num_es);
+  res *= cmp_sorted_lst(&c, &a);
+  adj_cmp_free(&c);
+  adj_cmp_copy(&c, &a);
+  res *= cmp_sorted_lst(&c, &a);
+  adj_cmp_free(&c);
+  adj_lst_free(&a);
+  adj_cmp_undir_build(&c, &g);
+  adj_lst_csr_undir_build(&a, &g);
+  res *= (c.num_vts == a.num_vts && c.num_es == a.num_es);
+  res *= cmp_sorted_lst(&c, &a);
+  adj_cmp_free(&c);
+  adj_lst_free(&a);
+  graph_free(&g);
+  graph_base_init(&g, 0, 0);
+  adj_cmp_undir_build(&c, &g);
+  res *= (c.num_vts == 0 && c.num_es == 0);
+  adj_cmp_free(&c);
+  graph_free(&g);
+  printf("Test adj_cmp_{dir, undir}_build and adj_cmp_copy on a small "
+	 "graph --> ");
+  print_test_result(res);
+}
+
+/**
+   Runs adj_uint_{dir, undir}_build and adj_uint_copy tests on a small
+   graph with and without weights, and compares the lists with the lists
+   in CSR format.
+*/
+void run_adj_uint_small_graph_test(){
+  int res = 1;
+  int i;
+  graph_t g;
+  adj_lst_t a;
+  adj_uint_t u;
+  uint_graph_init(&g);
+  for (i = 0; i < 2; i++){
+    if (i == 1){
+      free(g.wts);
+      g.wts = NULL;
+      g.wt_size = 0;
+    }
+    adj_uint_dir_build(&u, &g);
+    adj_lst_csr_dir_build(&a, &g);
+    res *= cmp_uint_lst(&u, &a);
+    adj_uint_free(&u);
+    adj_uint_copy(&u, &a);
+    res *= cmp_uint_lst(&u, &a);
+    adj_uint_free(&u);
+    adj_lst_free(&a);
+    adj_uint_undir_build(&u, &g);
+    adj_lst_csr_undir_build(&a, &g);
+    res *= cmp_uint_lst(&u, &a);
+    res *= (u.pair_size == ((i == 0) ?
+			    2 * sizeof(size_t) :
+			    sizeof(unsigned int)));
+    adj_uint_free(&u);
+    adj_lst_free(&a);
+  }
+  graph_free(&g);
+  graph_base_init(&g, 0, 0);
+  adj_uint_undir_build(&u, &g);
+  res *= (u.num_vts == 0 && u.num_es == 0);
+  adj_uint_free(&u);
+  graph_free(&g);
+  printf("Test adj_uint_{dir, undir}_build and adj_uint_copy on a small "
+	 "graph --> ");
+  print_test_result(res);
+}
+
 /**
    Test on random graphs.
 */
@@ -494,10 +694,816 @@ void rand_build_helper(int log_start,
   }
 }
 
+/**
+   Test adj_lst_rand_dir_skip and adj_lst_rand_undir_skip.
+*/
+
+typedef struct{
+  size_t i;
+} skip_seq_arg_t;
+
+/**
+   Returns the skips in C_SKIPS cyclically.
+*/
+size_t skip_seq(void *arg){
+  skip_seq_arg_t *s = arg;
+  return C_SKIPS[s->i++ % C_SKIPS_COUNT];
+}
+
+typedef struct{
+  double p;
+  double log_q; /* log(1 - p) if 0 < p < 1 */
+} geom_arg_t;
+
+/**
+   Returns a geometric random variate as the number of failures before
+   the first success of Bernoulli trials with parameter p.
+*/
+size_t geom(void *arg){
+  double x;
+  geom_arg_t *g = arg;
+  if (g->p >= C_PROB_ONE) return 0;
+  if (g->p <= C_PROB_ZERO) return C_SIZE_MAX;
+  x = floor(log((RANDOM() + 1.0) / (RAND_MAX + 1.0)) / g->log_q);
+  if (x >= (double)C_SIZE_MAX) return C_SIZE_MAX;
+  return x;
+}
+
+void geom_arg_init(geom_arg_t *g, double p){
+  g->p = p;
+  g->log_q = (p > C_PROB_ZERO && p < C_PROB_ONE) ? log(1.0 - p) : 0.0;
+}
+
+/**
+   Builds the expected adjacency list of a skip build with the skips in
+   C_SKIPS by visiting each possible edge in the order of a skip build.
+*/
+void skip_seq_expected(adj_lst_t *a, size_t n, int undir){
+  size_t u, v, s;
+  bern_arg_t b;
+  skip_seq_arg_t sa;
+  graph_t g;
+  b.p = C_PROB_ONE;
+  sa.i = 0;
+  graph_base_init(&g, n, 0);
+  adj_lst_init(a, &g);
+  s = skip_seq(&sa);
+  for (u = 0; u < n; u++){
+    for (v = (undir) ? u + 1 : 0; v < n; v++){
+      if (u == v) continue;
+      if (s > 0){
+	s--;
+	continue;
+      }
+      if (undir){
+	adj_lst_add_undir_edge(a, u, v, NULL, bern, &b);
+      }else{
+	adj_lst_add_dir_edge(a, u, v, NULL, bern, &b);
+      }
+      s = skip_seq(&sa);
+    }
+  }
+}
+
+void run_adj_lst_rand_skip_seq_test(){
+  int res = 1;
+  size_t n;
+  skip_seq_arg_t sa;
+  adj_lst_t a, a_exp;
+  printf("Test adj_lst_rand_dir_skip and adj_lst_rand_undir_skip on "
+	 "a cyclic sequence of skips\n");
+  for (n = 0; n <= C_SKIP_NUM_VTS_MAX; n++){
+    sa.i = 0;
+    adj_lst_rand_dir_skip(&a, n, skip_seq, &sa);
+    skip_seq_expected(&a_exp, n, 0);
+    res *= cmp_adj_lst(&a, &a_exp);
+    adj_lst_free(&a);
+    adj_lst_free(&a_exp);
+    sa.i = 0;
+    adj_lst_rand_undir_skip(&a, n, skip_seq, &sa);
+    skip_seq_expected(&a_exp, n, 1);
+    res *= cmp_adj_lst(&a, &a_exp);
+    adj_lst_free(&a);
+    adj_lst_free(&a_exp);
+  }
+  printf("\tcorrectness --> ");
+  print_test_result(res);
+}
+
+/**
+   Runs adj_lst_rand_dir and adj_lst_rand_dir_skip, and adj_lst_rand_undir
+   and adj_lst_rand_undir_skip, on graphs with p = 1/2 and on sparse
+   graphs with an expected degree of C_DEG_SPARSE, and compares the
+   number of edges with its expectation and the build times.
+*/
+void rand_skip_helper(size_t n,
+		      double prob,
+		      int undir){
+  bern_arg_t b;
+  geom_arg_t g;
+  adj_lst_t a, a_skip;
+  clock_t t, t_skip;
+  b.p = prob;
+  geom_arg_init(&g, prob);
+  t = clock();
+  if (undir){
+    adj_lst_rand_undir(&a, n, bern, &b);
+  }else{
+    adj_lst_rand_dir(&a, n, bern, &b);
+  }
+  t = clock() - t;
+  t_skip = clock();
+  if (undir){
+    adj_lst_rand_undir_skip(&a_skip, n, geom, &g);
+  }else{
+    adj_lst_rand_dir_skip(&a_skip, n, geom, &g);
+  }
+  t_skip = clock() - t_skip;
+  printf("\t\tvertices: %lu, p: %.5f, expected directed edges: %.1f\n"
+	 "\t\t\tbern directed edges: %lu, build time: %.6f seconds\n"
+	 "\t\t\tskip directed edges: %lu, build time: %.6f seconds\n",
+	 TOLU(n), prob, prob * n * (n - 1),
+	 TOLU(a.num_es), (float)t / CLOCKS_PER_SEC,
+	 TOLU(a_skip.num_es), (float)t_skip / CLOCKS_PER_SEC);
+  fflush(stdout);
+  adj_lst_free(&a);
+  adj_lst_free(&a_skip);
+}
+
+void run_adj_lst_rand_skip_test(int log_start, int log_end){
+  int l;
+  size_t n;
+  printf("Test adj_lst_rand_dir_skip on the number of edges in "
+	 "expectation\n");
+  for (l = log_start; l <= log_end; l++){
+    n = pow_two_perror(l);
+    rand_skip_helper(n, C_PROB_HALF, 0);
+    if (n - 1 > C_DEG_SPARSE) rand_skip_helper(n, C_DEG_SPARSE / (n - 1), 0);
+  }
+  printf("Test adj_lst_rand_undir_skip on the number of edges in "
+	 "expectation\n");
+  for (l = log_start; l <= log_end; l++){
+    n = pow_two_perror(l);
+    rand_skip_helper(n, C_PROB_HALF, 1);
+    if (n - 1 > C_DEG_SPARSE) rand_skip_helper(n, C_DEG_SPARSE / (n - 1), 1);
+  }
+}
+
+/**
+   Test graph_rmat and graph_chung_lu.
+*/
+
+typedef struct{
+  double r; /* constant drand value if >= 0.0 */
+  size_t wt;
+} gen_arg_t;
+
+double gen_drand(void *arg){
+  gen_arg_t *ga = arg;
+  if (ga->r >= 0.0) return ga->r;
+  return (double)RANDOM() / ((double)RAND_MAX + 1.0);
+}
+
+/**
+   Writes consecutive size_t weights.
+*/
+void gen_rand_wt(void *wt, void *arg){
+  gen_arg_t *ga = arg;
+  *(size_t *)wt = ga->wt++;
+}
+
+/**
+   Counts the edges incident to each vertex, where a self-loop is counted
+   twice, and returns the maximum count.
+*/
+size_t gen_degs(const graph_t *g, size_t *degs){
+  size_t i, max = 0;
+  memset(degs, 0, g->num_vts * sizeof(size_t));
+  for (i = 0; i < g->num_es; i++){
+    degs[g->u[i]]++;
+    degs[g->v[i]]++;
+  }
+  for (i = 0; i < g->num_vts; i++){
+    if (degs[i] > max) max = degs[i];
+  }
+  return max;
+}
+
+/**
+   Runs a graph_rmat test on graphs with constant drand values, where the
+   edges are in one of the four corners of an adjacency matrix, and on
+   random graphs with C_GEN_DEG * n edges and R-MAT and uniform quadrant
+   probabilities.
+*/
+void run_graph_rmat_test(int log_start, int log_end){
+  int res = 1;
+  int l;
+  size_t i, j, n, max_deg, max_deg_unif;
+  size_t us[4], vs[4];
+  size_t *degs = NULL;
+  gen_arg_t ga;
+  graph_t g;
+  clock_t t;
+  printf("Test graph_rmat on graphs with constant drand values\n");
+  for (l = log_start; l <= log_end; l++){
+    n = pow_two_perror(l);
+    us[0] = 0; vs[0] = 0;
+    us[1] = 0; vs[1] = n - 1;
+    us[2] = n - 1; vs[2] = 0;
+    us[3] = n - 1; vs[3] = n - 1;
+    for (i = 0; i < 4; i++){
+      ga.r = C_RMAT_DRANDS[i];
+      ga.wt = 0;
+      graph_rmat(&g, l, C_GEN_DEG, C_RMAT_UNIF, C_RMAT_UNIF, C_RMAT_UNIF,
+		 sizeof(size_t), gen_drand, gen_rand_wt, &ga);
+      res *= (g.num_vts == n && g.num_es == C_GEN_DEG);
+      for (j = 0; j < g.num_es; j++){
+	res *= (g.u[j] == us[i] && g.v[j] == vs[i]);
+	res *= (((size_t *)g.wts)[j] == j);
+      }
+      graph_free(&g);
+    }
+  }
+  printf("\tcorrectness --> ");
+  print_test_result(res);
+  printf("Test graph_rmat on random graphs with a = %.2f, b = %.2f, "
+	 "c = %.2f and with uniform probabilities\n",
+	 C_RMAT_PROBS[0], C_RMAT_PROBS[1], C_RMAT_PROBS[2]);
+  degs = malloc_perror(pow_two_perror(log_end), sizeof(size_t));
+  ga.r = -1.0;
+  for (l = log_start; l <= log_end; l++){
+    n = pow_two_perror(l);
+    t = clock();
+    graph_rmat(&g, l, C_GEN_DEG * n, C_RMAT_PROBS[0], C_RMAT_PROBS[1],
+	       C_RMAT_PROBS[2], 0, gen_drand, NULL, &ga);
+    t = clock() - t;
+    max_deg = gen_degs(&g, degs);
+    graph_free(&g);
+    graph_rmat(&g, l, C_GEN_DEG * n, C_RMAT_UNIF, C_RMAT_UNIF,
+	       C_RMAT_UNIF, 0, gen_drand, NULL, &ga);
+    max_deg_unif = gen_degs(&g, degs);
+    graph_free(&g);
+    printf("\t\tvertices: %lu, edges: %lu, max degree: %lu (uniform: "
+	   "%lu), build time: %.6f seconds\n",
+	   TOLU(n), TOLU(C_GEN_DEG * n), TOLU(max_deg), TOLU(max_deg_unif),
+	   (float)t / CLOCKS_PER_SEC);
+  }
+  free(degs);
+  degs = NULL;
+}
+
+/**
+   Runs a graph_chung_lu test on graphs where a single vertex has a
+   positive expected degree, and on random graphs with a power-law
+   expected degree sequence, where vertices with odd indices have an
+   expected degree of 0.
+*/
+void run_graph_chung_lu_test(int log_start, int log_end){
+  int res = 1;
+  int l;
+  size_t i, j, n, max_deg, num_es;
+  size_t *degs = NULL;
+  double sum;
+  double *exp_degs = NULL;
+  gen_arg_t ga;
+  graph_t g;
+  clock_t t;
+  printf("Test graph_chung_lu on graphs with a single vertex of positive "
+	 "expected degree\n");
+  exp_degs = malloc_perror(pow_two_perror(log_end), sizeof(double));
+  degs = malloc_perror(pow_two_perror(log_end), sizeof(size_t));
+  ga.r = -1.0;
+  for (l = log_start; l <= log_end; l++){
+    n = pow_two_perror(l);
+    for (i = 0; i < n; i++){
+      for (j = 0; j < n; j++) exp_degs[j] = 0.0;
+      exp_degs[i] = C_GEN_DEG;
+      ga.wt = 0;
+      graph_chung_lu(&g, n, C_GEN_DEG, exp_degs, sizeof(size_t),
+		     gen_drand, gen_rand_wt, &ga);
+      res *= (g.num_vts == n && g.num_es == C_GEN_DEG);
+      for (j = 0; j < g.num_es; j++){
+	res *= (g.u[j] == i && g.v[j] == i);
+	res *= (((size_t *)g.wts)[j] == j);
+      }
+      graph_free(&g);
+      if (i == C_GEN_DEG) break;
+    }
+  }
+  printf("\tcorrectness --> ");
+  print_test_result(res);
+  printf("Test graph_chung_lu on random graphs with a power-law expected "
+	 "degree sequence with exponent %.1f\n", C_POW_EXP);
+  for (l = log_start; l <= log_end; l++){
+    n = pow_two_perror(l);
+    sum = 0.0;
+    for (i = 0; i < n; i++){
+      exp_degs[i] = (i & 1) ? 0.0 : pow(i + 1.0, -1.0 / (C_POW_EXP - 1.0));
+      sum += exp_degs[i];
+    }
+    for (i = 0; i < n; i++){
+      exp_degs[i] *= 2.0 * C_GEN_DEG * n / sum;
+    }
+    num_es = C_GEN_DEG * n;
+    t = clock();
+    graph_chung_lu(&g, n, num_es, exp_degs, 0, gen_drand, NULL, &ga);
+    t = clock() - t;
+    max_deg = gen_degs(&g, degs);
+    for (i = 1; i < n; i += 2){
+      res *= (degs[i] == 0);
+    }
+    graph_free(&g);
+    printf("\t\tvertices: %lu, edges: %lu, degree of 0: %lu "
+	   "(expected: %.1f), max degree: %lu, build time: %.6f seconds\n",
+	   TOLU(n), TOLU(num_es), TOLU(degs[0]), exp_degs[0], TOLU(max_deg),
+	   (float)t / CLOCKS_PER_SEC);
+  }
+  printf("\tno edges of vertices with an expected degree of 0 --> ");
+  print_test_result(res);
+  free(exp_degs);
+  free(degs);
+  exp_degs = NULL;
+  degs = NULL;
+}
+
+/**
+   Test adj_lst_insert_batch and adj_lst_delete_batch.
+*/
+
+/**
+   Returns the weight of an edge (u, v) in the batch and sort tests.
+*/
+size_t batch_wt(size_t u, size_t v){
+  return u ^ (v * 31);
+}
+
+/**
+   Initializes a random graph with n vertices, m edges, and size_t weights
+   that are a function of the endpoints of an edge.
+*/
+void batch_graph_init(graph_t *g, size_t n, size_t m){
+  size_t i;
+  graph_base_init(g, n, sizeof(size_t));
+  graph_es_init(g, m);
+  for (i = 0; i < m; i++){
+    g->u[i] = RANDOM() % n;
+    g->v[i] = RANDOM() % n;
+    ((size_t *)g->wts)[i] = batch_wt(g->u[i], g->v[i]);
+  }
+}
+
+/**
+   Initializes a graph with the edges of g that are not in h, with respect
+   to the edges of both directions of h if h is undirected.
+*/
+int cmp_edge(const void *a, const void *b){
+  const size_t *x = a;
+  const size_t *y = b;
+  if (x[0] != y[0]) return (x[0] > y[0]) - (x[0] < y[0]);
+  return (x[1] > y[1]) - (x[1] < y[1]);
+}
+
+void batch_graph_diff(graph_t *d, const graph_t *g, const graph_t *h,
+		      int undir){
+  size_t i, k = 0, num = 0;
+  size_t e[2];
+  size_t *es = NULL;
+  es = malloc_perror(4 * h->num_es + 1, sizeof(size_t));
+  for (i = 0; i < h->num_es; i++){
+    es[2 * num] = h->u[i];
+    es[2 * num + 1] = h->v[i];
+    num++;
+    if (undir){
+      es[2 * num] = h->v[i];
+      es[2 * num + 1] = h->u[i];
+      num++;
+    }
+  }
+  qsort(es, num, 2 * sizeof(size_t), cmp_edge);
+  graph_base_init(d, g->num_vts, g->wt_size);
+  graph_es_init(d, g->num_es);
+  for (i = 0; i < g->num_es; i++){
+    e[0] = g->u[i];
+    e[1] = g->v[i];
+    if (bsearch(e, es, num, 2 * sizeof(size_t), cmp_edge) == NULL){
+      d->u[k] = g->u[i];
+      d->v[k] = g->v[i];
+      ((size_t *)d->wts)[k] = ((size_t *)g->wts)[i];
+      k++;
+    }
+  }
+  d->num_es = k;
+  free(es);
+  es = NULL;
+}
+
+/**
+   Runs a test of inserting a batch of n edges into the adjacency list of
+   a random graph with n vertices and C_GEN_DEG * n edges, and of deleting
+   the batch, and compares the runtimes with a build of the adjacency list
+   of the graph with all edges. The lists after the insertion are
+   compared with the lists of the graph with all edges as multisets, and
+   the lists after the deletion are compared with the lists of the graph
+   without the edges of the batch, including the order of pairs.
+*/
+void run_adj_lst_batch_test(int log_start, int log_end){
+  int res = 1;
+  int l;
+  size_t n, undir;
+  graph_t g_init, g_batch, g_all, g_diff;
+  adj_lst_t a, a_all, a_diff;
+  clock_t t_ins, t_del, t_bld;
+  void (*build[2])(adj_lst_t *, const graph_t *);
+  build[0] = adj_lst_dir_build;
+  build[1] = adj_lst_undir_build;
+  for (undir = 0; undir < 2; undir++){
+    printf("Test adj_lst_insert_batch and adj_lst_delete_batch on random "
+	   "%s graphs\n", (undir) ? "undirected" : "directed");
+    for (l = log_start; l <= log_end; l++){
+      n = pow_two_perror(l);
+      batch_graph_init(&g_init, n, C_GEN_DEG * n);
+      batch_graph_init(&g_batch, n, n);
+      graph_base_init(&g_all, n, sizeof(size_t));
+      graph_es_init(&g_all, g_init.num_es + g_batch.num_es);
+      memcpy(g_all.u, g_init.u, g_init.num_es * sizeof(size_t));
+      memcpy(g_all.u + g_init.num_es, g_batch.u,
+	     g_batch.num_es * sizeof(size_t));
+      memcpy(g_all.v, g_init.v, g_init.num_es * sizeof(size_t));
+      memcpy(g_all.v + g_init.num_es, g_batch.v,
+	     g_batch.num_es * sizeof(size_t));
+      memcpy(g_all.wts, g_init.wts, g_init.num_es * sizeof(size_t));
+      memcpy((size_t *)g_all.wts + g_init.num_es, g_batch.wts,
+	     g_batch.num_es * sizeof(size_t));
+      batch_graph_diff(&g_diff, &g_init, &g_batch, undir);
+      adj_lst_init(&a, &g_init);
+      build[undir](&a, &g_init);
+      adj_lst_init(&a_all, &g_all);
+      t_bld = clock();
+      build[undir](&a_all, &g_all);
+      t_bld = clock() - t_bld;
+      adj_lst_init(&a_diff, &g_diff);
+      build[undir](&a_diff, &g_diff);
+      t_ins = clock();
+      adj_lst_insert_batch(&a, &g_batch, undir);
+      t_ins = clock() - t_ins;
+      res *= cmp_batch_lst(&a, &a_all);
+      t_del = clock();
+      adj_lst_delete_batch(&a, &g_batch, undir);
+      t_del = clock() - t_del;
+      res *= cmp_adj_lst(&a, &a_diff);
+      printf("\t\tvertices: %lu, batch edges: %lu\n"
+	     "\t\t\tinsert batch:   %.6f seconds\n"
+	     "\t\t\tdelete batch:   %.6f seconds\n"
+	     "\t\t\tbuild all:      %.6f seconds\n",
+	     TOLU(n), TOLU(g_batch.num_es),
+	     (float)t_ins / CLOCKS_PER_SEC,
+	     (float)t_del / CLOCKS_PER_SEC,
+	     (float)t_bld / CLOCKS_PER_SEC);
+      adj_lst_free(&a);
+      adj_lst_free(&a_all);
+      adj_lst_free(&a_diff);
+      graph_free(&g_init);
+      graph_free(&g_batch);
+      graph_free(&g_all);
+      graph_free(&g_diff);
+    }
+    printf("\tcorrectness across all batches --> ");
+    print_test_result(res);
+  }
+}
+
+/**
+   Returns 1 if there is a pair with a vertex v in the list of u, and if wt
+   is not NULL, a pair with v and the weight pointed to by wt, by a linear
+   scan of the list. Otherwise returns 0.
+*/
+int lin_has_edge(const adj_lst_t *a, size_t u, size_t v, const void *wt){
+  size_t i;
+  size_t num = adj_lst_vt_num_pairs(a, u);
+  const char *p = adj_lst_vt_pairs(a, u);
+  for (i = 0; i < num; i++){
+    if (*(const size_t *)(p + i * a->pair_size) == v &&
+	(wt == NULL ||
+	 memcmp(p + i * a->pair_size + a->offset, wt, a->wt_size) == 0)){
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/**
+   Returns the number of common neighbors of u and v, counted as in a
+   merge of multisets, by matching each pair of v with an unmatched pair of
+   u in a linear scan.
+*/
+size_t lin_num_common(const adj_lst_t *a, size_t u, size_t v){
+  size_t i, j, ret = 0;
+  size_t num_u = adj_lst_vt_num_pairs(a, u);
+  size_t num_v = adj_lst_vt_num_pairs(a, v);
+  const char *p = adj_lst_vt_pairs(a, u);
+  const char *q = adj_lst_vt_pairs(a, v);
+  size_t *vts = NULL;
+  vts = malloc_perror(num_u + 1, sizeof(size_t));
+  for (i = 0; i < num_u; i++){
+    vts[i] = *(const size_t *)(p + i * a->pair_size);
+  }
+  for (j = 0; j < num_v; j++){
+    for (i = 0; i < num_u; i++){
+      if (vts[i] == *(const size_t *)(q + j * a->pair_size)){
+	vts[i] = C_SIZE_MAX;
+	ret++;
+	break;
+      }
+    }
+  }
+  free(vts);
+  return ret;
+}
+
+/**
+   Returns 1 if the list of each vertex is sorted in ascending order,
+   otherwise returns 0.
+*/
+int is_sorted_lst(const adj_lst_t *a){
+  size_t i, j, num;
+  const char *p = NULL;
+  for (i = 0; i < a->num_vts; i++){
+    num = adj_lst_vt_num_pairs(a, i);
+    p = adj_lst_vt_pairs(a, i);
+    for (j = 1; j < num; j++){
+      if (*(const size_t *)(p + (j - 1) * a->pair_size) >
+	  *(const size_t *)(p + j * a->pair_size)){
+	return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/**
+   Runs a test of adj_lst_sort, adj_lst_has_edge, adj_lst_edge_wt, and
+   adj_lst_num_common on the adjacency lists of random graphs with n
+   vertices and deg * n edges in both formats, and compares the
+   runtime of C_QUERY_COUNT edge queries with the runtime of linear scans.
+*/
+void sort_helper(size_t n,
+		 size_t deg,
+		 void (*build)(adj_lst_t *, const graph_t *),
+		 int csr,
+		 int *res){
+  size_t i, u, v;
+  size_t *us = NULL, *vs = NULL;
+  int *has = NULL, *lin = NULL;
+  void *wt = NULL;
+  graph_t g;
+  adj_lst_t a, a_sorted;
+  clock_t t_sort, t_has, t_lin;
+  batch_graph_init(&g, n, deg * n);
+  if (!csr){
+    adj_lst_init(&a, &g);
+    adj_lst_init(&a_sorted, &g);
+  }
+  build(&a, &g);
+  build(&a_sorted, &g);
+  t_sort = clock();
+  adj_lst_sort(&a_sorted);
+  t_sort = clock() - t_sort;
+  *res *= is_sorted_lst(&a_sorted);
+  *res *= cmp_batch_lst(&a_sorted, &a);
+  us = malloc_perror(C_QUERY_COUNT, sizeof(size_t));
+  vs = malloc_perror(C_QUERY_COUNT, sizeof(size_t));
+  has = malloc_perror(C_QUERY_COUNT, sizeof(int));
+  lin = malloc_perror(C_QUERY_COUNT, sizeof(int));
+  for (i = 0; i < C_QUERY_COUNT; i++){
+    us[i] = RANDOM() % n;
+    vs[i] = RANDOM() % n;
+  }
+  t_has = clock();
+  for (i = 0; i < C_QUERY_COUNT; i++){
+    has[i] = adj_lst_has_edge(&a_sorted, us[i], vs[i]);
+  }
+  t_has = clock() - t_has;
+  t_lin = clock();
+  for (i = 0; i < C_QUERY_COUNT; i++){
+    lin[i] = lin_has_edge(&a, us[i], vs[i], NULL);
+  }
+  t_lin = clock() - t_lin;
+  for (i = 0; i < C_QUERY_COUNT; i++){
+    *res *= (has[i] == lin[i]);
+    wt = adj_lst_edge_wt(&a_sorted, us[i], vs[i]);
+    *res *= ((wt != NULL) == has[i]);
+    if (wt != NULL){
+      *res *= lin_has_edge(&a, us[i], vs[i], wt);
+      *res *= (*(size_t *)wt == batch_wt(us[i], vs[i]) ||
+	       *(size_t *)wt == batch_wt(vs[i], us[i]));
+    }
+  }
+  /* queries of existing edges */
+  for (i = 0; i < g.num_es; i++){
+    *res *= adj_lst_has_edge(&a_sorted, g.u[i], g.v[i]);
+  }
+  for (i = 0; i < C_COMMON_COUNT; i++){
+    u = RANDOM() % n;
+    v = (i % 2) ? u : RANDOM() % n;
+    *res *= (adj_lst_num_common(&a_sorted, u, v) ==
+	     lin_num_common(&a, u, v));
+  }
+  printf("\t\tvertices: %lu, %s, edges: %lu\n"
+	 "\t\t\tsort:                    %.6f seconds\n"
+	 "\t\t\tedge queries (sorted):   %.6f seconds\n"
+	 "\t\t\tedge queries (linear):   %.6f seconds\n",
+	 TOLU(n), (csr) ? "CSR" : "stack", TOLU(g.num_es),
+	 (float)t_sort / CLOCKS_PER_SEC,
+	 (float)t_has / CLOCKS_PER_SEC,
+	 (float)t_lin / CLOCKS_PER_SEC);
+  adj_lst_free(&a);
+  adj_lst_free(&a_sorted);
+  graph_free(&g);
+  free(us);
+  free(vs);
+  free(has);
+  free(lin);
+}
+
+void run_adj_lst_sort_test(int log_start, int log_end){
+  int res = 1;
+  int l;
+  size_t i, undir;
+  void (*build[2])(adj_lst_t *, const graph_t *);
+  void (*csr_build[2])(adj_lst_t *, const graph_t *);
+  build[0] = adj_lst_dir_build;
+  build[1] = adj_lst_undir_build;
+  csr_build[0] = adj_lst_csr_dir_build;
+  csr_build[1] = adj_lst_csr_undir_build;
+  for (undir = 0; undir < 2; undir++){
+    printf("Test adj_lst_sort, adj_lst_has_edge, adj_lst_edge_wt, and "
+	   "adj_lst_num_common on random %s graphs\n",
+	   (undir) ? "undirected" : "directed");
+    for (i = 0; i < 2; i++){
+      for (l = log_start; l <= log_end; l++){
+	sort_helper(pow_two_perror(l), C_SORT_DEGS[i], build[undir], 0,
+		    &res);
+	sort_helper(pow_two_perror(l), C_SORT_DEGS[i], csr_build[undir], 1,
+		    &res);
+      }
+    }
+    printf("\tcorrectness across all queries --> ");
+    print_test_result(res);
+    res = 1;
+  }
+}
+
+/**
+   Runs an adj_cmp_copy test on random undirected graphs, and compares the
+   decoded lists with the sorted lists.
+*/
+void run_adj_cmp_copy_test(int log_start, int log_end){
+  int res = 1;
+  int l;
+  bern_arg_t b;
+  adj_lst_t a;
+  adj_cmp_t c;
+  clock_t t;
+  b.p = C_PROB_HALF;
+  printf("Test adj_cmp_copy on random undirected graphs\n");
+  for (l = log_start; l <= log_end; l++){
+    adj_lst_rand_undir(&a, pow_two_perror(l), bern, &b);
+    t = clock();
+    adj_cmp_copy(&c, &a);
+    t = clock() - t;
+    printf("\t\tvertices: %lu, directed edges: %lu, "
+	   "bytes per edge: %.2f (%lu), build time: %.6f seconds\n",
+	   TOLU(c.num_vts), TOLU(c.num_es),
+	   (c.num_es > 0) ? (double)c.offsets[c.num_vts] / c.num_es : 0.0,
+	   TOLU(a.pair_size), (float)t / CLOCKS_PER_SEC);
+    fflush(stdout);
+    res *= (c.num_vts == a.num_vts && c.num_es == a.num_es);
+    res *= cmp_sorted_lst(&c, &a);
+    adj_cmp_free(&c);
+    adj_lst_free(&a);
+  }
+  printf("\t\tcorrectness across all builds --> ");
+  print_test_result(res);
+}
+
 /**
    Auxiliary functions.
 */
 
+/**
+   Compares the decoded lists of a compressed adjacency list with the
+   sorted vertices of the lists of an adjacency list.
+*/
+int cmp_vt(const void *a, const void *b){
+  size_t x = *(const size_t *)a;
+  size_t y = *(const size_t *)b;
+  return (x > y) - (x < y);
+}
+
+int cmp_sorted_lst(const adj_cmp_t *c, const adj_lst_t *a){
+  int res = 1;
+  size_t i, j, v, num;
+  size_t *vts = NULL;
+  const char *p = NULL;
+  adj_cmp_iter_t it;
+  vts = malloc_perror(a->num_vts + 1, sizeof(size_t));
+  for (i = 0; i < a->num_vts; i++){
+    num = adj_lst_vt_num_pairs(a, i);
+    p = adj_lst_vt_pairs(a, i);
+    for (j = 0; j < num; j++){
+      vts[j] = *(const size_t *)(p + j * a->pair_size);
+    }
+    qsort(vts, num, sizeof(size_t), cmp_vt);
+    adj_cmp_iter_init(&it, c, i);
+    for (j = 0; j < num; j++){
+      res *= (adj_cmp_iter_next(&it, &v) && v == vts[j]);
+    }
+    res *= !adj_cmp_iter_next(&it, &v);
+  }
+  free(vts);
+  return res;
+}
+
+/**
+   Compares the lists of a compact-id adjacency list with the lists of an
+   adjacency list, including the order of vertex weight pairs.
+*/
+int cmp_uint_lst(const adj_uint_t *u, const adj_lst_t *a){
+  int res = 1;
+  size_t i, j, num;
+  const char *p = NULL, *q = NULL;
+  res *= (u->num_vts == a->num_vts && u->num_es == a->num_es);
+  res *= (u->wt_size == a->wt_size);
+  for (i = 0; res && i < a->num_vts; i++){
+    num = adj_lst_vt_num_pairs(a, i);
+    res *= (adj_uint_vt_num_pairs(u, i) == num);
+    p = adj_lst_vt_pairs(a, i);
+    q = adj_uint_vt_pairs(u, i);
+    for (j = 0; res && j < num; j++){
+      res *= (*(const size_t *)p == *(const unsigned int *)q);
+      res *= (memcmp(p + a->offset, q + u->offset, a->wt_size) == 0);
+      p += a->pair_size;
+      q += u->pair_size;
+    }
+  }
+  return res;
+}
+
+/**
+   Compares the lists of two adjacency lists with size_t weights as
+   multisets of vertices, and checks that the weight of each pair (u, v)
+   is batch_wt(u, v).
+*/
+int cmp_batch_lst(const adj_lst_t *a, const adj_lst_t *b){
+  int res = 1;
+  size_t i, j, num;
+  size_t *vts_a = NULL, *vts_b = NULL;
+  const char *p = NULL, *q = NULL;
+  res *= (a->num_vts == b->num_vts && a->num_es == b->num_es);
+  vts_a = malloc_perror(a->num_es + 1, sizeof(size_t));
+  vts_b = malloc_perror(a->num_es + 1, sizeof(size_t));
+  for (i = 0; res && i < a->num_vts; i++){
+    num = adj_lst_vt_num_pairs(a, i);
+    res *= (adj_lst_vt_num_pairs(b, i) == num);
+    p = adj_lst_vt_pairs(a, i);
+    q = adj_lst_vt_pairs(b, i);
+    for (j = 0; res && j < num; j++){
+      vts_a[j] = *(const size_t *)(p + j * a->pair_size);
+      vts_b[j] = *(const size_t *)(q + j * b->pair_size);
+      res *= (*(const size_t *)(p + j * a->pair_size + a->offset) ==
+	      batch_wt(i, vts_a[j]) ||
+	      *(const size_t *)(p + j * a->pair_size + a->offset) ==
+	      batch_wt(vts_a[j], i));
+    }
+    qsort(vts_a, num, sizeof(size_t), cmp_vt);
+    qsort(vts_b, num, sizeof(size_t), cmp_vt);
+    res *= (num == 0 || memcmp(vts_a, vts_b, num * sizeof(size_t)) == 0);
+  }
+  free(vts_a);
+  free(vts_b);
+  return res;
+}
+
+/**
+   Compares two adjacency lists, including the order of vertex weight
+   pairs.
+*/
+int cmp_adj_lst(const adj_lst_t *a, const adj_lst_t *b){
+  int res = 1;
+  size_t i, num;
+  res *= (a->num_vts == b->num_vts && a->num_es == b->num_es);
+  res *= (a->pair_size == b->pair_size);
+  for (i = 0; res && i < a->num_vts; i++){
+    num = adj_lst_vt_num_pairs(a, i);
+    res *= (adj_lst_vt_num_pairs(b, i) == num);
+    res *= (num == 0 ||
+	    memcmp(adj_lst_vt_pairs(a, i),
+		   adj_lst_vt_pairs(b, i),
+		   num * a->pair_size) == 0);
+  }
+  return res;
+}
+
 /**
    Sums the vertices in the ith stack in an adjacency list. Wraps around and
    does not check for overflow.
@@ -505,8 +1511,8 @@ void rand_build_helper(int log_start,
 size_t sum_vts(const adj_lst_t *a, size_t i){
   char *p = NULL, *p_start = NULL, *p_end = NULL;
   size_t ret = 0;
-  p_start = a->vt_wts[i]->elts;
-  p_end = p_start + a->vt_wts[i]->num_elts * a->pair_size;
+  p_start = adj_lst_vt_pairs(a, i);
+  p_end = p_start + adj_lst_vt_num_pairs(a, i) * a->pair_size;
   for (p = p_start; p != p_end; p += a->pair_size){
     ret += *(size_t *)p;
   }
@@ -531,8 +1537,8 @@ void print_adj_lst(const adj_lst_t *a, void (*print_wt)(const void *)){
   printf("\tvertices: \n");
   for (i = 0; i < a->num_vts; i++){
     printf("\t%lu : ", TOLU(i));
-    p_start = a->vt_wts[i]->elts;
-    p_end = p_start + a->vt_wts[i]->num_elts * a->pair_size;
+    p_start = adj_lst_vt_pairs(a, i);
+    p_end = p_start + adj_lst_vt_num_pairs(a, i) * a->pair_size;
     for (p = p_start; p != p_end; p += a->pair_size){
       printf("%lu ", TOLU(*(size_t *)p));
     }
@@ -542,8 +1548,8 @@ void print_adj_lst(const adj_lst_t *a, void (*print_wt)(const void *)){
     printf("\tweights: \n");
     for (i = 0; i < a->num_vts; i++){
       printf("\t%lu : ", TOLU(i));
-      p_start = a->vt_wts[i]->elts;
-      p_end = p_start + a->vt_wts[i]->num_elts * a->pair_size;
+      p_start = adj_lst_vt_pairs(a, i);
+      p_end = p_start + adj_lst_vt_num_pairs(a, i) * a->pair_size;
       for (p = p_start; p != p_end; p += a->pair_size){
 	print_wt(p + a->offset);
       }
@@ -586,15 +1592,25 @@ int main(int argc, char *argv[]){
     run_uint_graph_test();
     run_double_graph_test();
     run_corner_cases_test();
+    run_adj_cmp_small_graph_test();
+    run_adj_uint_small_graph_test();
   }
   if (args[3]){
     run_adj_lst_undir_build_test(args[0], args[1]);
+    run_adj_lst_csr_undir_build_test(args[0], args[1]);
   }
   if (args[4]){
     run_adj_lst_add_dir_edge_test(args[0], args[1]);
     run_adj_lst_add_undir_edge_test(args[0], args[1]);
     run_adj_lst_rand_dir_test(args[0], args[1]);
     run_adj_lst_rand_undir_test(args[0], args[1]);
+    run_adj_lst_rand_skip_seq_test();
+    run_adj_lst_rand_skip_test(args[0], args[1]);
+    run_graph_rmat_test(args[0], args[1]);
+    run_graph_chung_lu_test(args[0], args[1]);
+    run_adj_lst_batch_test(args[0], args[1]);
+    run_adj_lst_sort_test(args[0], args[1]);
+    run_adj_cmp_copy_test(args[0], args[1]);
   }
   free(args);
   args = NULL;
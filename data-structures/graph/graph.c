@@ -12,6 +12,42 @@
    (in bytes) enables a user to iterate with a char *p pointer across a stack
    and access a weight by p + offset when p points to a vertex of a pair.
 
+   An adjacency list can also be built in an immutable compressed sparse
+   row (CSR) format, where the vertex weight pairs of all lists are stored
+   in a single contiguous block in the order of vertices and the list of a
+   vertex u is delimited by offsets[u] and offsets[u + 1]. The CSR format
+   is built with a counting pass over the edges, a prefix sum, and a
+   filling pass, without reallocation.
+
+   A compressed adjacency list (adj_cmp_t) stores the sorted list of each
+   vertex as varints in a single byte block, where the first neighbor is
+   the zigzag-mapped difference from the list vertex and each next
+   neighbor is the difference from the previous neighbor. The byte block
+   grows by doubling during encoding and is shrunk to its final size.
+
+   A compact-id adjacency list (adj_uint_t) is built as the CSR format
+   with unsigned int vertices in the pairs.
+
+   Random graphs according to the R-MAT and Chung-Lu models are generated
+   as graph_t edge arrays by range, so that disjoint ranges of edges can be
+   generated concurrently.
+
+   A batch of edge updates is sorted by source vertex with a sort function
+   of a user (e.g. qsort), and the insertions or deletions of a source are
+   applied to its stack in one pass. A deletion compacts a stack in place
+   with a binary search of each pair among the batch targets of the source.
+
+   The lists of an adjacency list in either format can be sorted by
+   neighbor in place with qsort, by vertex range. In a sorted list, an edge
+   is found with geq_bsearch in utilities-alg.h in O(log d) time for a list
+   of d pairs, or with a scan of the sorted list if d is small, and the
+   common neighbors of two vertices are counted by merging their lists.
+
+   A random graph can be built in O(n + m) time, where m is the number of
+   added edges, with a skip function that returns the number of possible
+   edges that are not added before the next added edge (e.g. a geometric
+   random variate), instead of a Bernoulli trial for each possible edge.
+
    Due to cache-efficient allocation, the implementation requires that
    sizeof(size_t) and the size of a generic weight are powers of two.
    The size of weight can also be 0.
@@ -30,13 +66,35 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 #include "graph.h"
 #include "stack.h"
+#include "utilities-alg.h"
 #include "utilities-mem.h"
 
 static void *wt_ptr(const graph_t *g, size_t i);
+static void init_pair_layout(adj_lst_t *a, const graph_t *g);
+static void csr_build(adj_lst_t *a, const graph_t *g, int undir);
+static void cmp_build(adj_cmp_t *c, const graph_t *g, int undir);
+static void uint_build(adj_uint_t *u, const graph_t *g, int undir);
+static void uint_init(adj_uint_t *u, size_t num_vts, size_t wt_size);
+static void rand_skip(adj_lst_t *a,
+		      size_t n,
+		      size_t (*skip)(void *),
+		      void *arg,
+		      int undir);
+static size_t cum_search(const double *cum, size_t n, double x);
+static void batch_check(const adj_lst_t *a, const graph_t *g, int insert);
+static int batch_has(const adj_batch_elt_t *elts, size_t n, size_t v);
+static int cmp_batch_elt(const void *a, const void *b);
+static void *vt_search(const adj_lst_t *a, size_t u, size_t v);
+static size_t varint_put(unsigned char *p, size_t x);
+static int cmp_vt(const void *a, const void *b);
 
 const size_t STACK_INIT_COUNT = 1;
+static const size_t CMP_INIT_COUNT = 1024;
+static const size_t VARINT_SIZE_MAX = (CHAR_BIT * sizeof(size_t) + 6) / 7;
+static const size_t SEARCH_SCAN_MAX = 32; /* linear scan of shorter lists */
 
 /**
    Initializes a weighted or unweighted graph with n vertices and no edges,
@@ -54,6 +112,19 @@ void graph_base_init(graph_t *g, size_t n, size_t wt_size){
   g->wts = NULL;
 }
 
+/**
+   Allocates the edge arrays of a graph previously initialized with
+   graph_base_init for num_es edges, e.g. before the edges are set by a
+   generator. The arrays are NULL if num_es is 0.
+*/
+void graph_es_init(graph_t *g, size_t num_es){
+  g->num_es = num_es;
+  if (num_es == 0) return;
+  g->u = malloc_perror(num_es, sizeof(size_t));
+  g->v = malloc_perror(num_es, sizeof(size_t));
+  if (g->wt_size > 0) g->wts = malloc_perror(num_es, g->wt_size);
+}
+
 /**
    Frees a graph and leaves a block of size sizeof(graph_t) pointed to by 
    the g parameter.
@@ -67,6 +138,165 @@ void graph_free(graph_t *g){
   g->wts = NULL;
 }
 
+/**
+   Initializes a random directed or undirected graph with 2**log_n
+   vertices and num_es edges according to the recursive matrix (R-MAT)
+   model of Chakrabarti, Zhan, and Faloutsos, which is a stochastic
+   Kronecker graph with a 2 x 2 initiator matrix. The endpoints of an
+   edge are chosen by log_n recursive descents into one of the four
+   quadrants of the adjacency matrix with the probabilities a, b, c, and
+   1 - a - b - c, which yields a skewed (power-law-like) degree
+   distribution and hub vertices if a > 1/4. Self-loops and multiple edges
+   are not removed. The graph_t representation is shared by directed and
+   undirected graphs.
+   g           : pointer to a preallocated block of size sizeof(graph_t)
+   log_n       : 2**log_n vertices, where log_n < # bits in size_t
+   num_es      : number of edges
+   a, b, c     : >= 0 probabilities of the upper left, upper right, and
+                 lower left quadrants, where a + b + c <= 1.0
+   wt_size     : 0 if the graph is unweighted, > 0 otherwise
+   drand       : returns a uniform double in [0.0, 1.0) and takes arg as
+                 its parameter
+   rand_wt     : if wt_size > 0, writes a random weight to the block of
+                 size wt_size pointed to by its first parameter and takes
+                 arg as its second parameter; NULL otherwise
+   arg         : argument of drand and rand_wt (e.g. a generator state)
+*/
+void graph_rmat(graph_t *g,
+		size_t log_n,
+		size_t num_es,
+		double a,
+		double b,
+		double c,
+		size_t wt_size,
+		double (*drand)(void *),
+		void (*rand_wt)(void *, void *),
+		void *arg){
+  if (log_n >= CHAR_BIT * sizeof(size_t)){
+    fprintf(stderr, "graph_rmat: log_n >= # bits in size_t\n");
+    exit(EXIT_FAILURE);
+  }
+  graph_base_init(g, (size_t)1 << log_n, wt_size);
+  graph_es_init(g, num_es);
+  graph_rmat_range(g, 0, num_es, a, b, c, drand, rand_wt, arg);
+}
+
+/**
+   Sets the edges in the range [e_start, e_end) of a graph with 2**log_n
+   vertices and allocated edge arrays (e.g. by graph_es_init) according to
+   the R-MAT model. Please see the parameter specification in graph_rmat.
+   Calls on disjoint ranges can be made concurrently with different
+   arguments of drand and rand_wt.
+*/
+void graph_rmat_range(graph_t *g,
+		      size_t e_start,
+		      size_t e_end,
+		      double a,
+		      double b,
+		      double c,
+		      double (*drand)(void *),
+		      void (*rand_wt)(void *, void *),
+		      void *arg){
+  size_t i, j, u, v, log_n = 0;
+  double r, ab = a + b, abc = a + b + c;
+  while (((size_t)1 << log_n) < g->num_vts) log_n++;
+  for (i = e_start; i < e_end; i++){
+    u = 0;
+    v = 0;
+    for (j = 0; j < log_n; j++){
+      r = drand(arg);
+      u <<= 1;
+      v <<= 1;
+      if (r < a){
+	/* upper left quadrant */
+      }else if (r < ab){
+	v |= 1;
+      }else if (r < abc){
+	u |= 1;
+      }else{
+	u |= 1;
+	v |= 1;
+      }
+    }
+    g->u[i] = u;
+    g->v[i] = v;
+    if (g->wt_size > 0) rand_wt((char *)g->wts + i * g->wt_size, arg);
+  }
+}
+
+/**
+   Initializes a random directed or undirected graph with n vertices and
+   num_es edges according to the Chung-Lu model with an expected degree
+   sequence, where each endpoint of each edge is chosen independently with
+   a probability proportional to the expected degree of a vertex. If
+   num_es is the half of the sum of the expected degrees, the expected
+   degree of each vertex in an undirected graph is its expected degree in
+   the sequence, e.g. a power-law degree sequence. Self-loops and multiple
+   edges are not removed. An additional block of n doubles is temporarily
+   allocated.
+   g           : pointer to a preallocated block of size sizeof(graph_t)
+   n           : number of vertices
+   num_es      : number of edges
+   degs        : pointer to n >= 0 expected degrees with a positive sum if
+                 num_es > 0
+   wt_size     : 0 if the graph is unweighted, > 0 otherwise
+   drand       : returns a uniform double in [0.0, 1.0) and takes arg as
+                 its parameter
+   rand_wt     : if wt_size > 0, writes a random weight to the block of
+                 size wt_size pointed to by its first parameter and takes
+                 arg as its second parameter; NULL otherwise
+   arg         : argument of drand and rand_wt (e.g. a generator state)
+*/
+void graph_chung_lu(graph_t *g,
+		    size_t n,
+		    size_t num_es,
+		    const double *degs,
+		    size_t wt_size,
+		    double (*drand)(void *),
+		    void (*rand_wt)(void *, void *),
+		    void *arg){
+  size_t i;
+  double *cum_degs = NULL;
+  graph_base_init(g, n, wt_size);
+  graph_es_init(g, num_es);
+  if (num_es == 0) return;
+  cum_degs = malloc_perror(n, sizeof(double));
+  cum_degs[0] = degs[0];
+  for (i = 1; i < n; i++){
+    cum_degs[i] = cum_degs[i - 1] + degs[i];
+  }
+  graph_chung_lu_range(g, 0, num_es, cum_degs, drand, rand_wt, arg);
+  free(cum_degs);
+  cum_degs = NULL;
+}
+
+/**
+   Sets the edges in the range [e_start, e_end) of a graph with allocated
+   edge arrays (e.g. by graph_es_init) according to the Chung-Lu model,
+   where cum_degs points to the num_vts inclusive prefix sums of the
+   expected degrees. An endpoint is found by a binary search in cum_degs.
+   Please see the parameter specification in graph_chung_lu. Calls on
+   disjoint ranges can be made concurrently with different arguments of
+   drand and rand_wt.
+*/
+void graph_chung_lu_range(graph_t *g,
+			  size_t e_start,
+			  size_t e_end,
+			  const double *cum_degs,
+			  double (*drand)(void *),
+			  void (*rand_wt)(void *, void *),
+			  void *arg){
+  size_t i;
+  double total;
+  if (e_start == e_end) return;
+  total = cum_degs[g->num_vts - 1];
+  for (i = e_start; i < e_end; i++){
+    g->u[i] = cum_search(cum_degs, g->num_vts, drand(arg) * total);
+    g->v[i] = cum_search(cum_degs, g->num_vts, drand(arg) * total);
+    if (g->wt_size > 0) rand_wt((char *)g->wts + i * g->wt_size, arg);
+  }
+}
+
 /**
    Initializes the adjacency list of a graph.
    a           : pointer to a preallocated block of size sizeof(adj_lst_t)
@@ -75,24 +305,11 @@ void graph_free(graph_t *g){
 */
 void adj_lst_init(adj_lst_t *a, const graph_t *g){
   size_t i;
-  a->num_vts = g->num_vts;
-  a->num_es = 0; 
-  a->wt_size = g->wt_size;
-  /* compute vertex weight pair size with general alignment in memory */
-  if (a->wt_size == 0){
-    a->pair_size = sizeof(size_t);
-    a->offset = 0;
-  }else if (a->wt_size <= sizeof(size_t)){
-    /* sizeof(size_t) is mult. of  wt_size */
-    a->pair_size = mul_sz_perror(2, sizeof(size_t));
-    a->offset = sizeof(size_t);
-  }else{
-    /* wt_size is mult of sizeof(size_t); malloc's pointer is wt aligned */
-    a->pair_size = mul_sz_perror(2, a->wt_size);
-    a->offset = a->wt_size;
-  }
+  init_pair_layout(a, g);
   a->buf = malloc_perror(1, a->pair_size);
   a->vt_wts = NULL;
+  a->offsets = NULL;
+  a->pairs = NULL;
   if (a->num_vts > 0){
     a->vt_wts = malloc_perror(a->num_vts, sizeof(stack_t *));
   }
@@ -135,6 +352,175 @@ void adj_lst_undir_build(adj_lst_t *a, const graph_t *g){
   }
 }
 
+/**
+   Initializes an adjacency list in CSR format with offsets and pairs
+   blocks that are allocated for the vertices of a graph and num_pairs
+   vertex weight pairs, but not set. Provides a basis for CSR builders,
+   including multithreaded builders outside graph.c, which set
+   offsets[0..num_vts] and the pairs.
+   a           : pointer to a preallocated block of size sizeof(adj_lst_t)
+   g           : pointer to a graph previously constructed with at least
+                 graph_base_init
+   num_pairs   : number of vertex weight pairs across all lists
+*/
+void adj_lst_csr_init(adj_lst_t *a, const graph_t *g, size_t num_pairs){
+  init_pair_layout(a, g);
+  a->num_es = num_pairs;
+  a->buf = malloc_perror(1, a->pair_size);
+  a->vt_wts = NULL;
+  a->offsets = malloc_perror(add_sz_perror(a->num_vts, 1), sizeof(size_t));
+  a->pairs = malloc_perror(num_pairs + (num_pairs == 0), a->pair_size);
+}
+
+/**
+   Initializes and builds the immutable adjacency list of a directed graph
+   in CSR format. The vertex weight pairs of each list are in the same
+   order as in the list built by adj_lst_dir_build. An edge is not added to
+   an adjacency list in CSR format.
+   a           : pointer to a preallocated block of size sizeof(adj_lst_t)
+   g           : pointer to a graph previously constructed with at least
+                 graph_base_init
+*/
+void adj_lst_csr_dir_build(adj_lst_t *a, const graph_t *g){
+  csr_build(a, g, 0);
+}
+
+/**
+   Initializes and builds the immutable adjacency list of an undirected
+   graph in CSR format. The vertex weight pairs of each list are in the
+   same order as in the list built by adj_lst_undir_build. An edge is not
+   added to an adjacency list in CSR format.
+*/
+void adj_lst_csr_undir_build(adj_lst_t *a, const graph_t *g){
+  csr_build(a, g, 1);
+}
+
+/**
+   Initializes and builds an immutable copy of an adjacency list in CSR
+   format, e.g. after the adjacency list was built by adj_lst_rand_dir or
+   adj_lst_rand_undir.
+   c           : pointer to a preallocated block of size sizeof(adj_lst_t)
+   a           : pointer to an adjacency list in either format
+*/
+void adj_lst_csr_copy(adj_lst_t *c, const adj_lst_t *a){
+  size_t i, num;
+  c->num_vts = a->num_vts;
+  c->num_es = a->num_es;
+  c->wt_size = a->wt_size;
+  c->pair_size = a->pair_size;
+  c->offset = a->offset;
+  c->buf = malloc_perror(1, c->pair_size);
+  c->vt_wts = NULL;
+  c->offsets = malloc_perror(add_sz_perror(c->num_vts, 1), sizeof(size_t));
+  c->pairs = malloc_perror(c->num_es + (c->num_es == 0), c->pair_size);
+  c->offsets[0] = 0;
+  for (i = 0; i < c->num_vts; i++){
+    num = adj_lst_vt_num_pairs(a, i);
+    if (num > 0){
+      memcpy((char *)c->pairs + c->offsets[i] * c->pair_size,
+	     adj_lst_vt_pairs(a, i),
+	     num * c->pair_size);
+    }
+    c->offsets[i + 1] = c->offsets[i] + num;
+  }
+}
+
+/**
+   Returns a pointer to the first vertex weight pair in the list of a
+   vertex u, in either format.
+*/
+void *adj_lst_vt_pairs(const adj_lst_t *a, size_t u){
+  if (a->offsets != NULL){
+    return (char *)a->pairs + a->offsets[u] * a->pair_size;
+  }
+  return a->vt_wts[u]->elts;
+}
+
+/**
+   Returns the number of vertex weight pairs in the list of a vertex u, in
+   either format.
+*/
+size_t adj_lst_vt_num_pairs(const adj_lst_t *a, size_t u){
+  if (a->offsets != NULL){
+    return a->offsets[u + 1] - a->offsets[u];
+  }
+  return a->vt_wts[u]->num_elts;
+}
+
+/**
+   Sorts the list of each vertex of an adjacency list in either format by
+   neighbor in ascending order, in O(d log d) time for a list of d pairs.
+   The order of the pairs of multiple edges is unspecified. A list remains
+   sorted until an edge is added to the list (e.g. by a batch insertion).
+*/
+void adj_lst_sort(adj_lst_t *a){
+  adj_lst_sort_range(a, 0, a->num_vts);
+}
+
+/**
+   Sorts the lists of the vertices in the range [vt_start, vt_end) as
+   adj_lst_sort. Calls on disjoint vertex ranges can be made concurrently.
+*/
+void adj_lst_sort_range(adj_lst_t *a, size_t vt_start, size_t vt_end){
+  size_t i;
+  for (i = vt_start; i < vt_end; i++){
+    qsort(adj_lst_vt_pairs(a, i),
+	  adj_lst_vt_num_pairs(a, i),
+	  a->pair_size,
+	  cmp_vt);
+  }
+}
+
+/**
+   Returns 1 if there is an edge (u, v) in an adjacency list with sorted
+   lists in either format, and 0 otherwise, in O(log d) time for a list of
+   d pairs.
+*/
+int adj_lst_has_edge(const adj_lst_t *a, size_t u, size_t v){
+  return vt_search(a, u, v) != NULL;
+}
+
+/**
+   Returns a pointer to the weight of an edge (u, v) in a weighted
+   adjacency list with sorted lists in either format, or NULL if there is
+   no edge (u, v), in O(log d) time for a list of d pairs. If there are
+   multiple edges (u, v), it is unspecified which weight is returned.
+*/
+void *adj_lst_edge_wt(const adj_lst_t *a, size_t u, size_t v){
+  char *p = vt_search(a, u, v);
+  if (p == NULL) return NULL;
+  return p + a->offset;
+}
+
+/**
+   Returns the number of common neighbors of u and v in an adjacency list
+   with sorted lists in either format, by merging the lists in
+   O(d_u + d_v) time. The pairs of multiple edges are counted as in a
+   merge of multisets.
+*/
+size_t adj_lst_num_common(const adj_lst_t *a, size_t u, size_t v){
+  size_t i = 0, j = 0, ret = 0;
+  size_t x, y;
+  size_t num_u = adj_lst_vt_num_pairs(a, u);
+  size_t num_v = adj_lst_vt_num_pairs(a, v);
+  const char *p = adj_lst_vt_pairs(a, u);
+  const char *q = adj_lst_vt_pairs(a, v);
+  while (i < num_u && j < num_v){
+    x = *(const size_t *)(p + i * a->pair_size);
+    y = *(const size_t *)(q + j * a->pair_size);
+    if (x < y){
+      i++;
+    }else if (y < x){
+      j++;
+    }else{
+      ret++;
+      i++;
+      j++;
+    }
+  }
+  return ret;
+}
+
 /**
    Adds a directed edge (u, v) according to the Bernoulli distribution
    provided by bern that takes arg as its parameter. The edge is added if
@@ -228,21 +614,400 @@ void adj_lst_rand_undir(adj_lst_t *a,
   }
 }
 
+/**
+   Builds the adjacency list of a directed unweighted graph with n vertices
+   in O(n + m) time, where m is the number of added edges, by skipping
+   over the n(n - 1) possible edges (u, v) in the order of u and then v
+   (Batagelj and Brandes). skip takes arg as its parameter and returns the
+   number of consecutive possible edges that are not added before the next
+   added edge. If skip is distributed geometrically as the number of
+   failures before the first success of Bernoulli trials with parameter p,
+   then each possible edge is added independently with probability p. The
+   list of each vertex is sorted in ascending order.
+*/
+void adj_lst_rand_dir_skip(adj_lst_t *a,
+			   size_t n,
+			   size_t (*skip)(void *),
+			   void *arg){
+  rand_skip(a, n, skip, arg, 0);
+}
+
+/**
+   Builds the adjacency list of an undirected unweighted graph with n
+   vertices in O(n + m) time by skipping over the n(n - 1)/2 possible
+   edges (u, v), where u < v, in the order of u and then v. Please see
+   the specification of skip in adj_lst_rand_dir_skip. The list of each
+   vertex is sorted in ascending order.
+*/
+void adj_lst_rand_undir_skip(adj_lst_t *a,
+			     size_t n,
+			     size_t (*skip)(void *),
+			     void *arg){
+  rand_skip(a, n, skip, arg, 1);
+}
+
+/**
+   Initializes a batch of edge updates from the edges of a batch graph,
+   where an undirected edge (u, v) yields the elements (u, v) and (v, u),
+   and sorts the elements by source, then target, and then edge index
+   with a sort function with the parameters of qsort (e.g. qsort or a
+   wrapper of a parallel sort). The sorted batch is applied to the list of
+   each source vertex in one pass.
+   bt          : pointer to a preallocated block of size sizeof(adj_batch_t)
+   g           : pointer to a batch graph with the vertices of an adjacency
+                 list and at least one edge; g is accessed until
+                 adj_batch_free is called
+   undir       : nonzero if the edges are undirected, 0 otherwise
+   sort        : sort function with the parameters of qsort
+*/
+void adj_batch_init(adj_batch_t *bt,
+		    const graph_t *g,
+		    int undir,
+		    void (*sort)(void *,
+				 size_t,
+				 size_t,
+				 int (*)(const void *, const void *))){
+  size_t i, j = 0;
+  bt->num_elts = (undir) ? mul_sz_perror(g->num_es, 2) : g->num_es;
+  bt->elts = malloc_perror(bt->num_elts, sizeof(adj_batch_elt_t));
+  bt->g = g;
+  for (i = 0; i < g->num_es; i++){
+    bt->elts[j].u = g->u[i];
+    bt->elts[j].v = g->v[i];
+    bt->elts[j].ix = i;
+    j++;
+    if (undir){
+      bt->elts[j].u = g->v[i];
+      bt->elts[j].v = g->u[i];
+      bt->elts[j].ix = i;
+      j++;
+    }
+  }
+  sort(bt->elts, bt->num_elts, sizeof(adj_batch_elt_t), cmp_batch_elt);
+}
+
+/**
+   Frees the elements of a batch and leaves a block of size
+   sizeof(adj_batch_t) pointed to by the bt parameter.
+*/
+void adj_batch_free(adj_batch_t *bt){
+  free(bt->elts);
+  bt->elts = NULL;
+}
+
+/**
+   Inserts the edges of the elements in the range [start, end) of a sorted
+   batch into an adjacency list that is not in CSR format, with the
+   weights of the batch graph if the graph is weighted. The pairs are
+   appended to the list of each source in the order of the elements.
+   Returns the number of inserted pairs, without updating a->num_es. If
+   each of the ranges of concurrent calls starts and ends at the boundaries
+   of the elements of a source vertex, the calls are performed on disjoint
+   lists and can be made concurrently.
+*/
+size_t adj_lst_insert_batch_range(adj_lst_t *a,
+				  const adj_batch_t *bt,
+				  size_t start,
+				  size_t end){
+  size_t i;
+  void *buf = NULL;
+  const adj_batch_elt_t *e = NULL;
+  const graph_t *g = bt->g;
+  batch_check(a, g, 1);
+  buf = malloc_perror(1, a->pair_size);
+  for (i = start; i < end; i++){
+    e = &bt->elts[i];
+    memcpy(buf, &e->v, sizeof(size_t));
+    if (a->wt_size > 0){
+      memcpy((char *)buf + a->offset,
+	     (const char *)g->wts + e->ix * g->wt_size,
+	     a->wt_size);
+    }
+    stack_push(a->vt_wts[e->u], buf);
+  }
+  free(buf);
+  buf = NULL;
+  return end - start;
+}
+
+/**
+   Deletes the edges of the elements in the range [start, end) of a sorted
+   batch from an adjacency list that is not in CSR format. All pairs with a
+   vertex v are deleted from the list of u for an element (u, v), and the
+   order of the remaining pairs is preserved. Weights are not compared.
+   Returns the number of deleted pairs, without updating a->num_es. Please
+   see adj_lst_insert_batch_range for concurrent calls.
+*/
+size_t adj_lst_delete_batch_range(adj_lst_t *a,
+				  const adj_batch_t *bt,
+				  size_t start,
+				  size_t end){
+  size_t i, j, k, s, num, ret = 0;
+  char *p = NULL;
+  const adj_batch_elt_t *elts = bt->elts;
+  batch_check(a, bt->g, 0);
+  s = start;
+  while (s < end){
+    /* elements [s, k) of a source vertex, sorted by v */
+    for (k = s + 1; k < end && elts[k].u == elts[s].u; k++);
+    p = a->vt_wts[elts[s].u]->elts;
+    num = a->vt_wts[elts[s].u]->num_elts;
+    for (i = 0, j = 0; i < num; i++){
+      if (!batch_has(elts + s, k - s, *(size_t *)(p + i * a->pair_size))){
+	if (j < i){
+	  memcpy(p + j * a->pair_size, p + i * a->pair_size, a->pair_size);
+	}
+	j++;
+      }
+    }
+    a->vt_wts[elts[s].u]->num_elts = j;
+    ret += num - j;
+    s = k;
+  }
+  return ret;
+}
+
+/**
+   Inserts the edges of a batch graph into an adjacency list that is not
+   in CSR format, in O(k log k + k) time for k edges, without rebuilding
+   the adjacency list. If the adjacency list is weighted, the batch graph
+   has weights of the same size.
+   a           : pointer to an adjacency list initialized with
+                 adj_lst_init and not in CSR format
+   g           : pointer to a batch graph with the vertices of the
+                 adjacency list
+   undir       : nonzero if the edges are undirected, 0 otherwise
+*/
+void adj_lst_insert_batch(adj_lst_t *a, const graph_t *g, int undir){
+  adj_batch_t bt;
+  if (g->num_es == 0) return;
+  adj_batch_init(&bt, g, undir, qsort);
+  a->num_es += adj_lst_insert_batch_range(a, &bt, 0, bt.num_elts);
+  adj_batch_free(&bt);
+}
+
+/**
+   Deletes the edges of a batch graph from an adjacency list that is not
+   in CSR format, in O(k log k) time for sorting k edges and O(d log k)
+   time for each source vertex with a list of d pairs, without rebuilding
+   the adjacency list. All pairs of an edge are deleted, including the
+   pairs of multiple edges. Please see adj_lst_insert_batch for the
+   parameters.
+*/
+void adj_lst_delete_batch(adj_lst_t *a, const graph_t *g, int undir){
+  adj_batch_t bt;
+  if (g->num_es == 0) return;
+  adj_batch_init(&bt, g, undir, qsort);
+  a->num_es -= adj_lst_delete_batch_range(a, &bt, 0, bt.num_elts);
+  adj_batch_free(&bt);
+}
+
 /**
    Frees an adjacency list and leaves a block of size sizeof(adj_lst_t)
    pointed to by the a parameter.
 */
 void adj_lst_free(adj_lst_t *a){
   size_t i;
-  for (i = 0; i < a->num_vts; i++){
+  for (i = 0; a->vt_wts != NULL && i < a->num_vts; i++){
     stack_free(a->vt_wts[i]);
     free(a->vt_wts[i]);
     a->vt_wts[i] = NULL;
   }
   free(a->buf);
   free(a->vt_wts); /* free(NULL) performs no operation */
+  free(a->offsets);
+  free(a->pairs);
   a->buf = NULL;
   a->vt_wts = NULL;
+  a->offsets = NULL;
+  a->pairs = NULL;
+}
+
+/**
+   Initializes and builds the immutable compressed adjacency list of a
+   directed or undirected graph. The neighbors of each list are sorted and
+   the weights of a weighted graph are not included. An uncompressed list
+   of vertices is temporarily allocated during a build.
+   c           : pointer to a preallocated block of size sizeof(adj_cmp_t)
+   g           : pointer to a graph previously constructed with at least
+                 graph_base_init
+*/
+void adj_cmp_dir_build(adj_cmp_t *c, const graph_t *g){
+  cmp_build(c, g, 0);
+}
+
+void adj_cmp_undir_build(adj_cmp_t *c, const graph_t *g){
+  cmp_build(c, g, 1);
+}
+
+/**
+   Initializes and builds an immutable compressed copy of the vertices of
+   an adjacency list in either format. The neighbors of each list are
+   sorted and the weights are not included.
+   c           : pointer to a preallocated block of size sizeof(adj_cmp_t)
+   a           : pointer to an adjacency list in either format
+*/
+void adj_cmp_copy(adj_cmp_t *c, const adj_lst_t *a){
+  size_t i, j, num, count = CMP_INIT_COUNT, vts_count = 1;
+  size_t x, prev;
+  size_t *vts = NULL;
+  const char *p = NULL;
+  c->num_vts = a->num_vts;
+  c->num_es = 0;
+  c->offsets = malloc_perror(add_sz_perror(c->num_vts, 1), sizeof(size_t));
+  c->bytes = malloc_perror(count, 1);
+  vts = malloc_perror(vts_count, sizeof(size_t));
+  c->offsets[0] = 0;
+  for (i = 0; i < c->num_vts; i++){
+    num = adj_lst_vt_num_pairs(a, i);
+    if (num > vts_count){
+      vts_count = num;
+      vts = realloc_perror(vts, vts_count, sizeof(size_t));
+    }
+    p = adj_lst_vt_pairs(a, i);
+    for (j = 0; j < num; j++){
+      vts[j] = *(const size_t *)(p + j * a->pair_size);
+    }
+    qsort(vts, num, sizeof(size_t), cmp_vt);
+    c->offsets[i + 1] = c->offsets[i];
+    prev = i;
+    for (j = 0; j < num; j++){
+      if (count - c->offsets[i + 1] < VARINT_SIZE_MAX){
+	count = mul_sz_perror(count, 2);
+	c->bytes = realloc_perror(c->bytes, count, 1);
+      }
+      if (j == 0){
+	/* zigzag mapping of v - u */
+	x = (vts[0] >= i) ? 2 * (vts[0] - i) : 2 * (i - vts[0]) - 1;
+      }else{
+	x = vts[j] - prev;
+      }
+      c->offsets[i + 1] += varint_put(c->bytes + c->offsets[i + 1], x);
+      prev = vts[j];
+    }
+    c->num_es += num;
+  }
+  c->bytes = realloc_perror(c->bytes, c->offsets[c->num_vts] + 1, 1);
+  free(vts);
+}
+
+/**
+   Initializes an iterator across the list of a vertex u, and decodes the
+   next neighbor into the block pointed to by v. adj_cmp_iter_next returns
+   nonzero if a neighbor was decoded, and 0 if the list was exhausted. An
+   iterator is a small struct that can be copied, e.g. onto a stack in an
+   iterative DFS.
+*/
+void adj_cmp_iter_init(adj_cmp_iter_t *it, const adj_cmp_t *c, size_t u){
+  it->p = c->bytes + c->offsets[u];
+  it->end = c->bytes + c->offsets[u + 1];
+  it->v = u;
+  it->first = 1;
+}
+
+int adj_cmp_iter_next(adj_cmp_iter_t *it, size_t *v){
+  size_t x;
+  int shift = 7;
+  unsigned char b;
+  if (it->p == it->end) return 0;
+  b = *it->p++;
+  x = b & 0x7f;
+  while (b & 0x80){
+    b = *it->p++;
+    x |= (size_t)(b & 0x7f) << shift;
+    shift += 7;
+  }
+  if (it->first){
+    it->v = (x & 1) ? it->v - (x >> 1) - 1 : it->v + (x >> 1);
+    it->first = 0;
+  }else{
+    it->v += x;
+  }
+  *v = it->v;
+  return 1;
+}
+
+/**
+   Frees a compressed adjacency list and leaves a block of size
+   sizeof(adj_cmp_t) pointed to by the c parameter.
+*/
+void adj_cmp_free(adj_cmp_t *c){
+  free(c->offsets);
+  free(c->bytes);
+  c->offsets = NULL;
+  c->bytes = NULL;
+}
+
+/**
+   Initializes and builds the immutable compact-id adjacency list of a
+   directed or undirected graph in CSR format. The vertex weight pairs of
+   each list are in the same order as in the list built by
+   adj_lst_csr_dir_build or adj_lst_csr_undir_build. Exits with an error
+   message if the number of vertices is greater than UINT_MAX.
+   u           : pointer to a preallocated block of size sizeof(adj_uint_t)
+   g           : pointer to a graph previously constructed with at least
+                 graph_base_init
+*/
+void adj_uint_dir_build(adj_uint_t *u, const graph_t *g){
+  uint_build(u, g, 0);
+}
+
+void adj_uint_undir_build(adj_uint_t *u, const graph_t *g){
+  uint_build(u, g, 1);
+}
+
+/**
+   Initializes and builds an immutable compact-id copy of an adjacency list
+   in either format, with the same order of vertex weight pairs. Exits with
+   an error message if the number of vertices is greater than UINT_MAX.
+   u           : pointer to a preallocated block of size sizeof(adj_uint_t)
+   a           : pointer to an adjacency list in either format
+*/
+void adj_uint_copy(adj_uint_t *u, const adj_lst_t *a){
+  size_t i, j, num;
+  unsigned int vt;
+  const char *p = NULL;
+  char *q = NULL;
+  uint_init(u, a->num_vts, a->wt_size);
+  u->num_es = a->num_es;
+  u->pairs = malloc_perror(u->num_es + (u->num_es == 0), u->pair_size);
+  u->offsets[0] = 0;
+  for (i = 0; i < u->num_vts; i++){
+    num = adj_lst_vt_num_pairs(a, i);
+    p = adj_lst_vt_pairs(a, i);
+    q = (char *)u->pairs + u->offsets[i] * u->pair_size;
+    for (j = 0; j < num; j++){
+      vt = *(const size_t *)p;
+      memcpy(q, &vt, sizeof(unsigned int));
+      if (u->wt_size > 0) memcpy(q + u->offset, p + a->offset, u->wt_size);
+      p += a->pair_size;
+      q += u->pair_size;
+    }
+    u->offsets[i + 1] = u->offsets[i] + num;
+  }
+}
+
+/**
+   Returns a pointer to the first vertex weight pair in the list of a
+   vertex v, and the number of vertex weight pairs in the list.
+*/
+void *adj_uint_vt_pairs(const adj_uint_t *u, size_t v){
+  return (char *)u->pairs + u->offsets[v] * u->pair_size;
+}
+
+size_t adj_uint_vt_num_pairs(const adj_uint_t *u, size_t v){
+  return u->offsets[v + 1] - u->offsets[v];
+}
+
+/**
+   Frees a compact-id adjacency list and leaves a block of size
+   sizeof(adj_uint_t) pointed to by the u parameter.
+*/
+void adj_uint_free(adj_uint_t *u){
+  free(u->offsets);
+  free(u->pairs);
+  u->offsets = NULL;
+  u->pairs = NULL;
 }
 
 /** Helper functions */
@@ -250,3 +1015,309 @@ void adj_lst_free(adj_lst_t *a){
 static void *wt_ptr(const graph_t *g, size_t i){
   return (void *)((char *)g->wts + i * g->wt_size);
 }
+
+/**
+   Sets the size parameters of an adjacency list and computes the vertex
+   weight pair size with general alignment in memory.
+*/
+static void init_pair_layout(adj_lst_t *a, const graph_t *g){
+  a->num_vts = g->num_vts;
+  a->num_es = 0;
+  a->wt_size = g->wt_size;
+  if (a->wt_size == 0){
+    a->pair_size = sizeof(size_t);
+    a->offset = 0;
+  }else if (a->wt_size <= sizeof(size_t)){
+    /* sizeof(size_t) is mult. of  wt_size */
+    a->pair_size = mul_sz_perror(2, sizeof(size_t));
+    a->offset = sizeof(size_t);
+  }else{
+    /* wt_size is mult of sizeof(size_t); malloc's pointer is wt aligned */
+    a->pair_size = mul_sz_perror(2, a->wt_size);
+    a->offset = a->wt_size;
+  }
+}
+
+/**
+   Builds an adjacency list in CSR format by counting the pairs of each
+   vertex, computing the offsets with a prefix sum, and copying the pairs
+   in the order of edges. If undir is nonzero, each edge (u, v) also
+   results in a (u, weight) pair in the list of v.
+*/
+static void csr_build(adj_lst_t *a, const graph_t *g, int undir){
+  size_t i, num_pairs;
+  size_t *pos = NULL;
+  char *p = NULL;
+  num_pairs = (undir) ? mul_sz_perror(g->num_es, 2) : g->num_es;
+  adj_lst_csr_init(a, g, num_pairs);
+  memset(a->offsets, 0, (a->num_vts + 1) * sizeof(size_t));
+  for (i = 0; i < g->num_es; i++){
+    a->offsets[g->u[i] + 1]++;
+    if (undir) a->offsets[g->v[i] + 1]++;
+  }
+  for (i = 0; i < a->num_vts; i++){
+    a->offsets[i + 1] += a->offsets[i];
+  }
+  /* next free pair index of each vertex */
+  pos = malloc_perror(a->num_vts + (a->num_vts == 0), sizeof(size_t));
+  if (a->num_vts > 0){
+    memcpy(pos, a->offsets, a->num_vts * sizeof(size_t));
+  }
+  for (i = 0; i < g->num_es; i++){
+    p = (char *)a->pairs + pos[g->u[i]]++ * a->pair_size;
+    memcpy(p, &g->v[i], sizeof(size_t));
+    if (a->wt_size > 0){
+      memcpy(p + a->offset, wt_ptr(g, i), a->wt_size);
+    }
+    if (undir){
+      p = (char *)a->pairs + pos[g->v[i]]++ * a->pair_size;
+      memcpy(p, &g->u[i], sizeof(size_t));
+      if (a->wt_size > 0){
+	memcpy(p + a->offset, wt_ptr(g, i), a->wt_size);
+      }
+    }
+  }
+  free(pos);
+}
+
+/**
+   Builds a compressed adjacency list from a temporary unweighted
+   adjacency list in CSR format.
+*/
+static void cmp_build(adj_cmp_t *c, const graph_t *g, int undir){
+  graph_t h = *g;
+  adj_lst_t a;
+  h.wt_size = 0;
+  h.wts = NULL;
+  csr_build(&a, &h, undir);
+  adj_cmp_copy(c, &a);
+  adj_lst_free(&a);
+}
+
+/**
+   Builds a compact-id adjacency list in CSR format as in csr_build, with
+   an unsigned int vertex at the beginning of each pair.
+*/
+static void uint_build(adj_uint_t *u, const graph_t *g, int undir){
+  size_t i;
+  size_t vt_size = sizeof(unsigned int);
+  size_t *pos = NULL;
+  unsigned int vt;
+  char *p = NULL;
+  uint_init(u, g->num_vts, g->wt_size);
+  u->num_es = (undir) ? mul_sz_perror(g->num_es, 2) : g->num_es;
+  memset(u->offsets, 0, (u->num_vts + 1) * sizeof(size_t));
+  u->pairs = malloc_perror(u->num_es + (u->num_es == 0), u->pair_size);
+  for (i = 0; i < g->num_es; i++){
+    u->offsets[g->u[i] + 1]++;
+    if (undir) u->offsets[g->v[i] + 1]++;
+  }
+  for (i = 0; i < u->num_vts; i++){
+    u->offsets[i + 1] += u->offsets[i];
+  }
+  /* next free pair index of each vertex */
+  pos = malloc_perror(u->num_vts + (u->num_vts == 0), sizeof(size_t));
+  if (u->num_vts > 0){
+    memcpy(pos, u->offsets, u->num_vts * sizeof(size_t));
+  }
+  for (i = 0; i < g->num_es; i++){
+    p = (char *)u->pairs + pos[g->u[i]]++ * u->pair_size;
+    vt = g->v[i];
+    memcpy(p, &vt, vt_size);
+    if (u->wt_size > 0){
+      memcpy(p + u->offset, wt_ptr(g, i), u->wt_size);
+    }
+    if (undir){
+      p = (char *)u->pairs + pos[g->v[i]]++ * u->pair_size;
+      vt = g->u[i];
+      memcpy(p, &vt, vt_size);
+      if (u->wt_size > 0){
+	memcpy(p + u->offset, wt_ptr(g, i), u->wt_size);
+      }
+    }
+  }
+  free(pos);
+}
+
+/**
+   Sets the size parameters and the pair layout of a compact-id adjacency
+   list, and allocates its offsets. Exits with an error message if the
+   number of vertices is greater than UINT_MAX.
+*/
+static void uint_init(adj_uint_t *u, size_t num_vts, size_t wt_size){
+  size_t vt_size = sizeof(unsigned int);
+  if (num_vts > UINT_MAX){
+    fprintf(stderr, "adj_uint_t: number of vertices > UINT_MAX\n");
+    exit(EXIT_FAILURE);
+  }
+  u->num_vts = num_vts;
+  u->num_es = 0;
+  u->wt_size = wt_size;
+  if (wt_size == 0){
+    u->pair_size = vt_size;
+    u->offset = 0;
+  }else if (wt_size <= vt_size){
+    u->pair_size = 2 * vt_size;
+    u->offset = vt_size;
+  }else{
+    u->pair_size = mul_sz_perror(2, wt_size);
+    u->offset = wt_size;
+  }
+  u->offsets = malloc_perror(add_sz_perror(num_vts, 1), sizeof(size_t));
+}
+
+/**
+   Builds a random unweighted adjacency list by skipping over the possible
+   edges row by row, where the row of a vertex u consists of the possible
+   edges (u, v) with v != u in a directed graph and v > u in an undirected
+   graph. The remaining skip is carried across rows without overflow.
+*/
+static void rand_skip(adj_lst_t *a,
+		      size_t n,
+		      size_t (*skip)(void *),
+		      void *arg,
+		      int undir){
+  size_t u = 0, v, k = 0, len, s;
+  graph_t g;
+  graph_base_init(&g, n, 0);
+  adj_lst_init(a, &g);
+  if (n < 2) return;
+  s = skip(arg);
+  while (1){
+    len = (undir) ? n - 1 - u : n - 1;
+    while (s >= len - k){
+      s -= len - k;
+      k = 0;
+      u++;
+      if (u == n - 1 + !undir) return;
+      len = (undir) ? n - 1 - u : n - 1;
+    }
+    k += s;
+    if (undir){
+      v = u + 1 + k;
+      memcpy(a->buf, &v, sizeof(size_t));
+      stack_push(a->vt_wts[u], a->buf);
+      memcpy(a->buf, &u, sizeof(size_t));
+      stack_push(a->vt_wts[v], a->buf);
+      a->num_es += 2;
+    }else{
+      v = (k < u) ? k : k + 1;
+      memcpy(a->buf, &v, sizeof(size_t));
+      stack_push(a->vt_wts[u], a->buf);
+      a->num_es++;
+    }
+    k++;
+    s = skip(arg);
+  }
+}
+
+/**
+   Returns the smallest index i in [0, n) s.t. cum[i] > x in a
+   nondecreasing array of n > 0 elements, or n - 1 if there is no such
+   index.
+*/
+static size_t cum_search(const double *cum, size_t n, double x){
+  size_t lo = 0, hi = n - 1, mid;
+  while (lo < hi){
+    mid = lo + (hi - lo) / 2;
+    if (cum[mid] > x){
+      hi = mid;
+    }else{
+      lo = mid + 1;
+    }
+  }
+  return lo;
+}
+
+/**
+   Exits with an error message if an adjacency list is in CSR format, or if
+   the weights of a batch graph for insertion do not match the weights of
+   the adjacency list.
+*/
+static void batch_check(const adj_lst_t *a, const graph_t *g, int insert){
+  if (a->offsets != NULL){
+    fprintf(stderr, "adj_lst_t: batch update of a list in CSR format\n");
+    exit(EXIT_FAILURE);
+  }
+  if (insert && a->wt_size > 0 && g->wt_size != a->wt_size){
+    fprintf(stderr, "adj_lst_t: batch weight size != list weight size\n");
+    exit(EXIT_FAILURE);
+  }
+}
+
+/**
+   Returns 1 if v is a target of the n > 0 batch elements of a source
+   vertex, which are sorted by target, and 0 otherwise.
+*/
+static int batch_has(const adj_batch_elt_t *elts, size_t n, size_t v){
+  size_t lo = 0, hi = n, mid;
+  while (lo < hi){
+    mid = lo + (hi - lo) / 2;
+    if (elts[mid].v < v){
+      lo = mid + 1;
+    }else{
+      hi = mid;
+    }
+  }
+  return (lo < n && elts[lo].v == v);
+}
+
+/**
+   Compares two batch elements by source, then target, and then index.
+*/
+static int cmp_batch_elt(const void *a, const void *b){
+  const adj_batch_elt_t *x = a;
+  const adj_batch_elt_t *y = b;
+  if (x->u != y->u) return (x->u > y->u) - (x->u < y->u);
+  if (x->v != y->v) return (x->v > y->v) - (x->v < y->v);
+  return (x->ix > y->ix) - (x->ix < y->ix);
+}
+
+/**
+   Writes x as a varint at p and returns the number of written bytes.
+*/
+static size_t varint_put(unsigned char *p, size_t x){
+  size_t n = 0;
+  while (x >= 0x80){
+    p[n++] = (unsigned char)((x & 0x7f) | 0x80);
+    x >>= 7;
+  }
+  p[n++] = (unsigned char)x;
+  return n;
+}
+
+/**
+   Returns a pointer to a pair with a vertex v in the sorted list of u, or
+   NULL if there is no such pair.
+*/
+static void *vt_search(const adj_lst_t *a, size_t u, size_t v){
+  size_t i, x;
+  size_t num = adj_lst_vt_num_pairs(a, u);
+  char *p = adj_lst_vt_pairs(a, u);
+  if (num <= SEARCH_SCAN_MAX){
+    for (i = 0; i < num; i++){
+      x = *(size_t *)(p + i * a->pair_size);
+      if (x == v) return p + i * a->pair_size;
+      if (x > v) break;
+    }
+    return NULL;
+  }
+  i = geq_bsearch(&v, p, num, a->pair_size, cmp_vt);
+  if (i < num && *(size_t *)(p + i * a->pair_size) == v){
+    return p + i * a->pair_size;
+  }
+  /* geq_bsearch may return the index after a pair with v */
+  if (i > 0 && *(size_t *)(p + (i - 1) * a->pair_size) == v){
+    return p + (i - 1) * a->pair_size;
+  }
+  return NULL;
+}
+
+/**
+   Compares two vertices.
+*/
+static int cmp_vt(const void *a, const void *b){
+  size_t x = *(const size_t *)a;
+  size_t y = *(const size_t *)b;
+  return (x > y) - (x < y);
+}
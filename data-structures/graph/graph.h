@@ -13,6 +13,55 @@
    (in bytes) enables a user to iterate with a char *p pointer across a stack
    and access a weight by p + offset when p points to a vertex of a pair.
 
+   An adjacency list can also be built in an immutable compressed sparse
+   row (CSR) format, where the vertex weight pairs of all lists are stored
+   in a single contiguous block in the order of vertices and the list of a
+   vertex u is delimited by offsets[u] and offsets[u + 1]. The CSR format
+   uses the same pair_size and offset values, eliminates a stack and a
+   pointer dereference per vertex, and enables a traversal to access the
+   lists of consecutive vertices sequentially in memory. The lists of both
+   formats are accessed by adj_lst_vt_pairs and adj_lst_vt_num_pairs.
+
+   The adjacency list of an unweighted graph can also be built in an
+   immutable compressed format (adj_cmp_t), where the list of a vertex u is
+   sorted and stored as a sequence of varints (7 bits per byte, with the
+   high bit set in all bytes except the last) in a single byte block
+   delimited by offsets[u] and offsets[u + 1]. The first neighbor v is
+   encoded as the zigzag-mapped difference v - u, and each next neighbor
+   as the difference from the previous neighbor. A neighbor that is close
+   to u or to the previous neighbor, e.g. after a locality-improving
+   relabeling of vertices, takes one byte instead of sizeof(size_t) bytes.
+   The lists are decoded sequentially with adj_cmp_iter_init and
+   adj_cmp_iter_next.
+
+   An adjacency list of a graph with at most UINT_MAX vertices can also be
+   built in an immutable compact-id CSR format (adj_uint_t), where a
+   vertex in a pair is an unsigned int (32 bits on common 64-bit systems).
+   The pair layout follows the layout of adj_lst_t with sizeof(unsigned
+   int) in place of sizeof(size_t), which halves the size of a pair of an
+   unweighted graph, and of a graph with weights of size at most
+   sizeof(unsigned int). The lists are accessed by adj_uint_vt_pairs and
+   adj_uint_vt_num_pairs, and the algorithms instantiated for the format
+   (e.g. bfs_uint) provide unsigned int vertex output arrays.
+
+   Random graphs with skewed degree distributions are generated as graph_t
+   edge arrays according to the R-MAT and Chung-Lu models, with optional
+   random weights. The edges of a range can be generated independently of
+   other ranges, which enables parallel generation (e.g. in graph-pthread).
+
+   An adjacency list that is not in CSR format is updated by batches of
+   edge insertions and deletions (adj_batch_t), where a batch is sorted by
+   source vertex and applied to the list of each source in one pass. The
+   elements of the distinct sources of a batch can be applied concurrently
+   (e.g. in graph-pthread).
+
+   The lists of an adjacency list in either format can be sorted by
+   neighbor after a build with adj_lst_sort. In sorted lists, the existence
+   and the weight of an edge (u, v) are queried by binary search in
+   O(log d) time for a list of d pairs, instead of a linear scan of the
+   list of u, and the common neighbors of two vertices are counted by
+   merging their lists.
+
    Due to cache-efficient allocation, the implementation requires that
    sizeof(size_t) and the size of a generic weight are powers of two.
    The size of weight can also be 0.
@@ -50,9 +99,48 @@ typedef struct{
   size_t pair_size; /* size of a vertex weight pair aligned in memory */
   size_t offset;    /* number of bytes from beginning of pair to weight */
   void *buf;        /* buffer that is only used by adj_lst_ functions */
-  stack_t **vt_wts; /* stacks of vertex weight pairs, NULL if no vertices */
+  stack_t **vt_wts; /* stacks of vertex weight pairs, NULL if no vertices
+                       or in CSR format */
+  size_t *offsets;  /* CSR format: num_vts + 1 pair offsets, NULL otherwise */
+  void *pairs;      /* CSR format: vertex weight pairs, NULL otherwise */
 } adj_lst_t; /* vertex weight pairs are contiguous to decrease cache misses */
 
+typedef struct{
+  size_t num_vts;
+  size_t num_es;         /* number of neighbors across all lists */
+  size_t *offsets;       /* num_vts + 1 byte offsets */
+  unsigned char *bytes;  /* varint-encoded lists */
+} adj_cmp_t;
+
+typedef struct{
+  const unsigned char *p;
+  const unsigned char *end;
+  size_t v;              /* last decoded vertex, or the list vertex */
+  int first;
+} adj_cmp_iter_t;
+
+typedef struct{
+  size_t num_vts;        /* <= UINT_MAX */
+  size_t num_es;
+  size_t wt_size;
+  size_t pair_size;
+  size_t offset;
+  size_t *offsets;       /* num_vts + 1 pair offsets */
+  void *pairs;           /* pairs with unsigned int vertices */
+} adj_uint_t;
+
+typedef struct{
+  size_t u;
+  size_t v;
+  size_t ix;             /* index of the edge in a batch graph */
+} adj_batch_elt_t;
+
+typedef struct{
+  size_t num_elts;
+  adj_batch_elt_t *elts; /* sorted by u, then v, then ix */
+  const graph_t *g;      /* batch graph */
+} adj_batch_t;
+
 /**
    Initializes a weighted or unweighted graph with n vertices and no edges,
    providing a basis for graph construction.
@@ -62,12 +150,120 @@ typedef struct{
 */
 void graph_base_init(graph_t *g, size_t n, size_t wt_size);
 
+/**
+   Allocates the edge arrays of a graph previously initialized with
+   graph_base_init for num_es edges, e.g. before the edges are set by a
+   generator. The arrays are NULL if num_es is 0.
+*/
+void graph_es_init(graph_t *g, size_t num_es);
+
 /**
    Frees a graph and leaves a block of size sizeof(graph_t) pointed to by 
    the g parameter.
 */
 void graph_free(graph_t *g);
 
+/**
+   Initializes a random directed or undirected graph with 2**log_n
+   vertices and num_es edges according to the recursive matrix (R-MAT)
+   model of Chakrabarti, Zhan, and Faloutsos, which is a stochastic
+   Kronecker graph with a 2 x 2 initiator matrix. The endpoints of an
+   edge are chosen by log_n recursive descents into one of the four
+   quadrants of the adjacency matrix with the probabilities a, b, c, and
+   1 - a - b - c, which yields a skewed (power-law-like) degree
+   distribution and hub vertices if a > 1/4. Self-loops and multiple edges
+   are not removed. The graph_t representation is shared by directed and
+   undirected graphs.
+   g           : pointer to a preallocated block of size sizeof(graph_t)
+   log_n       : 2**log_n vertices, where log_n < # bits in size_t
+   num_es      : number of edges
+   a, b, c     : >= 0 probabilities of the upper left, upper right, and
+                 lower left quadrants, where a + b + c <= 1.0
+   wt_size     : 0 if the graph is unweighted, > 0 otherwise
+   drand       : returns a uniform double in [0.0, 1.0) and takes arg as
+                 its parameter
+   rand_wt     : if wt_size > 0, writes a random weight to the block of
+                 size wt_size pointed to by its first parameter and takes
+                 arg as its second parameter; NULL otherwise
+   arg         : argument of drand and rand_wt (e.g. a generator state)
+*/
+void graph_rmat(graph_t *g,
+		size_t log_n,
+		size_t num_es,
+		double a,
+		double b,
+		double c,
+		size_t wt_size,
+		double (*drand)(void *),
+		void (*rand_wt)(void *, void *),
+		void *arg);
+
+/**
+   Sets the edges in the range [e_start, e_end) of a graph with 2**log_n
+   vertices and allocated edge arrays (e.g. by graph_es_init) according to
+   the R-MAT model. Please see the parameter specification in graph_rmat.
+   Calls on disjoint ranges can be made concurrently with different
+   arguments of drand and rand_wt.
+*/
+void graph_rmat_range(graph_t *g,
+		      size_t e_start,
+		      size_t e_end,
+		      double a,
+		      double b,
+		      double c,
+		      double (*drand)(void *),
+		      void (*rand_wt)(void *, void *),
+		      void *arg);
+
+/**
+   Initializes a random directed or undirected graph with n vertices and
+   num_es edges according to the Chung-Lu model with an expected degree
+   sequence, where each endpoint of each edge is chosen independently with
+   a probability proportional to the expected degree of a vertex. If
+   num_es is the half of the sum of the expected degrees, the expected
+   degree of each vertex in an undirected graph is its expected degree in
+   the sequence, e.g. a power-law degree sequence. Self-loops and multiple
+   edges are not removed. An additional block of n doubles is temporarily
+   allocated.
+   g           : pointer to a preallocated block of size sizeof(graph_t)
+   n           : number of vertices
+   num_es      : number of edges
+   degs        : pointer to n >= 0 expected degrees with a positive sum if
+                 num_es > 0
+   wt_size     : 0 if the graph is unweighted, > 0 otherwise
+   drand       : returns a uniform double in [0.0, 1.0) and takes arg as
+                 its parameter
+   rand_wt     : if wt_size > 0, writes a random weight to the block of
+                 size wt_size pointed to by its first parameter and takes
+                 arg as its second parameter; NULL otherwise
+   arg         : argument of drand and rand_wt (e.g. a generator state)
+*/
+void graph_chung_lu(graph_t *g,
+		    size_t n,
+		    size_t num_es,
+		    const double *degs,
+		    size_t wt_size,
+		    double (*drand)(void *),
+		    void (*rand_wt)(void *, void *),
+		    void *arg);
+
+/**
+   Sets the edges in the range [e_start, e_end) of a graph with allocated
+   edge arrays (e.g. by graph_es_init) according to the Chung-Lu model,
+   where cum_degs points to the num_vts inclusive prefix sums of the
+   expected degrees. An endpoint is found by a binary search in cum_degs.
+   Please see the parameter specification in graph_chung_lu. Calls on
+   disjoint ranges can be made concurrently with different arguments of
+   drand and rand_wt.
+*/
+void graph_chung_lu_range(graph_t *g,
+			  size_t e_start,
+			  size_t e_end,
+			  const double *cum_degs,
+			  double (*drand)(void *),
+			  void (*rand_wt)(void *, void *),
+			  void *arg);
+
 /**
    Initializes the adjacency list of a graph.
    a           : pointer to a preallocated block of size sizeof(adj_lst_t)
@@ -92,6 +288,96 @@ void adj_lst_dir_build(adj_lst_t *a, const graph_t *g);
 */
 void adj_lst_undir_build(adj_lst_t *a, const graph_t *g);
 
+/**
+   Initializes an adjacency list in CSR format with offsets and pairs
+   blocks that are allocated for the vertices of a graph and num_pairs
+   vertex weight pairs, but not set. Provides a basis for CSR builders,
+   including multithreaded builders outside graph.c, which set
+   offsets[0..num_vts] and the pairs.
+   a           : pointer to a preallocated block of size sizeof(adj_lst_t)
+   g           : pointer to a graph previously constructed with at least
+                 graph_base_init
+   num_pairs   : number of vertex weight pairs across all lists
+*/
+void adj_lst_csr_init(adj_lst_t *a, const graph_t *g, size_t num_pairs);
+
+/**
+   Initializes and builds the immutable adjacency list of a directed graph
+   in CSR format. The vertex weight pairs of each list are in the same
+   order as in the list built by adj_lst_dir_build. An edge is not added to
+   an adjacency list in CSR format.
+   a           : pointer to a preallocated block of size sizeof(adj_lst_t)
+   g           : pointer to a graph previously constructed with at least
+                 graph_base_init
+*/
+void adj_lst_csr_dir_build(adj_lst_t *a, const graph_t *g);
+
+/**
+   Initializes and builds the immutable adjacency list of an undirected
+   graph in CSR format. The vertex weight pairs of each list are in the
+   same order as in the list built by adj_lst_undir_build. An edge is not
+   added to an adjacency list in CSR format.
+*/
+void adj_lst_csr_undir_build(adj_lst_t *a, const graph_t *g);
+
+/**
+   Initializes and builds an immutable copy of an adjacency list in CSR
+   format, e.g. after the adjacency list was built by adj_lst_rand_dir or
+   adj_lst_rand_undir.
+   c           : pointer to a preallocated block of size sizeof(adj_lst_t)
+   a           : pointer to an adjacency list in either format
+*/
+void adj_lst_csr_copy(adj_lst_t *c, const adj_lst_t *a);
+
+/**
+   Returns a pointer to the first vertex weight pair in the list of a
+   vertex u, in either format.
+*/
+void *adj_lst_vt_pairs(const adj_lst_t *a, size_t u);
+
+/**
+   Returns the number of vertex weight pairs in the list of a vertex u, in
+   either format.
+*/
+size_t adj_lst_vt_num_pairs(const adj_lst_t *a, size_t u);
+
+/**
+   Sorts the list of each vertex of an adjacency list in either format by
+   neighbor in ascending order, in O(d log d) time for a list of d pairs.
+   The order of the pairs of multiple edges is unspecified. A list remains
+   sorted until an edge is added to the list (e.g. by a batch insertion).
+*/
+void adj_lst_sort(adj_lst_t *a);
+
+/**
+   Sorts the lists of the vertices in the range [vt_start, vt_end) as
+   adj_lst_sort. Calls on disjoint vertex ranges can be made concurrently.
+*/
+void adj_lst_sort_range(adj_lst_t *a, size_t vt_start, size_t vt_end);
+
+/**
+   Returns 1 if there is an edge (u, v) in an adjacency list with sorted
+   lists in either format, and 0 otherwise, in O(log d) time for a list of
+   d pairs.
+*/
+int adj_lst_has_edge(const adj_lst_t *a, size_t u, size_t v);
+
+/**
+   Returns a pointer to the weight of an edge (u, v) in a weighted
+   adjacency list with sorted lists in either format, or NULL if there is
+   no edge (u, v), in O(log d) time for a list of d pairs. If there are
+   multiple edges (u, v), it is unspecified which weight is returned.
+*/
+void *adj_lst_edge_wt(const adj_lst_t *a, size_t u, size_t v);
+
+/**
+   Returns the number of common neighbors of u and v in an adjacency list
+   with sorted lists in either format, by merging the lists in
+   O(d_u + d_v) time. The pairs of multiple edges are counted as in a
+   merge of multisets.
+*/
+size_t adj_lst_num_common(const adj_lst_t *a, size_t u, size_t v);
+
 /**
    Adds a directed edge (u, v) according to the Bernoulli distribution
    provided by bern that takes arg as its parameter. The edge is added if
@@ -140,4 +426,183 @@ void adj_lst_rand_undir(adj_lst_t *a,
 			int (*bern)(void *),
 			void *arg);
 
+/**
+   Builds the adjacency list of a directed unweighted graph with n vertices
+   in O(n + m) time, where m is the number of added edges, by skipping
+   over the n(n - 1) possible edges (u, v) in the order of u and then v
+   (Batagelj and Brandes). skip takes arg as its parameter and returns the
+   number of consecutive possible edges that are not added before the next
+   added edge. If skip is distributed geometrically as the number of
+   failures before the first success of Bernoulli trials with parameter p,
+   then each possible edge is added independently with probability p. The
+   list of each vertex is sorted in ascending order.
+*/
+void adj_lst_rand_dir_skip(adj_lst_t *a,
+			   size_t n,
+			   size_t (*skip)(void *),
+			   void *arg);
+
+/**
+   Builds the adjacency list of an undirected unweighted graph with n
+   vertices in O(n + m) time by skipping over the n(n - 1)/2 possible
+   edges (u, v), where u < v, in the order of u and then v. Please see
+   the specification of skip in adj_lst_rand_dir_skip. The list of each
+   vertex is sorted in ascending order.
+*/
+void adj_lst_rand_undir_skip(adj_lst_t *a,
+			     size_t n,
+			     size_t (*skip)(void *),
+			     void *arg);
+
+/**
+   Initializes a batch of edge updates from the edges of a batch graph,
+   where an undirected edge (u, v) yields the elements (u, v) and (v, u),
+   and sorts the elements by source, then target, and then edge index
+   with a sort function with the parameters of qsort (e.g. qsort or a
+   wrapper of a parallel sort). The sorted batch is applied to the list of
+   each source vertex in one pass.
+   bt          : pointer to a preallocated block of size sizeof(adj_batch_t)
+   g           : pointer to a batch graph with the vertices of an adjacency
+                 list and at least one edge; g is accessed until
+                 adj_batch_free is called
+   undir       : nonzero if the edges are undirected, 0 otherwise
+   sort        : sort function with the parameters of qsort
+*/
+void adj_batch_init(adj_batch_t *bt,
+		    const graph_t *g,
+		    int undir,
+		    void (*sort)(void *,
+				 size_t,
+				 size_t,
+				 int (*)(const void *, const void *)));
+
+/**
+   Frees the elements of a batch and leaves a block of size
+   sizeof(adj_batch_t) pointed to by the bt parameter.
+*/
+void adj_batch_free(adj_batch_t *bt);
+
+/**
+   Inserts the edges of the elements in the range [start, end) of a sorted
+   batch into an adjacency list that is not in CSR format, with the
+   weights of the batch graph if the graph is weighted. The pairs are
+   appended to the list of each source in the order of the elements.
+   Returns the number of inserted pairs, without updating a->num_es. If
+   each of the ranges of concurrent calls starts and ends at the boundaries
+   of the elements of a source vertex, the calls are performed on disjoint
+   lists and can be made concurrently.
+*/
+size_t adj_lst_insert_batch_range(adj_lst_t *a,
+				  const adj_batch_t *bt,
+				  size_t start,
+				  size_t end);
+
+/**
+   Deletes the edges of the elements in the range [start, end) of a sorted
+   batch from an adjacency list that is not in CSR format. All pairs with a
+   vertex v are deleted from the list of u for an element (u, v), and the
+   order of the remaining pairs is preserved. Weights are not compared.
+   Returns the number of deleted pairs, without updating a->num_es. Please
+   see adj_lst_insert_batch_range for concurrent calls.
+*/
+size_t adj_lst_delete_batch_range(adj_lst_t *a,
+				  const adj_batch_t *bt,
+				  size_t start,
+				  size_t end);
+
+/**
+   Inserts the edges of a batch graph into an adjacency list that is not
+   in CSR format, in O(k log k + k) time for k edges, without rebuilding
+   the adjacency list. If the adjacency list is weighted, the batch graph
+   has weights of the same size.
+   a           : pointer to an adjacency list initialized with
+                 adj_lst_init and not in CSR format
+   g           : pointer to a batch graph with the vertices of the
+                 adjacency list
+   undir       : nonzero if the edges are undirected, 0 otherwise
+*/
+void adj_lst_insert_batch(adj_lst_t *a, const graph_t *g, int undir);
+
+/**
+   Deletes the edges of a batch graph from an adjacency list that is not
+   in CSR format, in O(k log k) time for sorting k edges and O(d log k)
+   time for each source vertex with a list of d pairs, without rebuilding
+   the adjacency list. All pairs of an edge are deleted, including the
+   pairs of multiple edges. Please see adj_lst_insert_batch for the
+   parameters.
+*/
+void adj_lst_delete_batch(adj_lst_t *a, const graph_t *g, int undir);
+
+/**
+   Initializes and builds the immutable compressed adjacency list of a
+   directed or undirected graph. The neighbors of each list are sorted and
+   the weights of a weighted graph are not included. An uncompressed list
+   of vertices is temporarily allocated during a build.
+   c           : pointer to a preallocated block of size sizeof(adj_cmp_t)
+   g           : pointer to a graph previously constructed with at least
+                 graph_base_init
+*/
+void adj_cmp_dir_build(adj_cmp_t *c, const graph_t *g);
+void adj_cmp_undir_build(adj_cmp_t *c, const graph_t *g);
+
+/**
+   Initializes and builds an immutable compressed copy of the vertices of
+   an adjacency list in either format. The neighbors of each list are
+   sorted and the weights are not included.
+   c           : pointer to a preallocated block of size sizeof(adj_cmp_t)
+   a           : pointer to an adjacency list in either format
+*/
+void adj_cmp_copy(adj_cmp_t *c, const adj_lst_t *a);
+
+/**
+   Initializes an iterator across the list of a vertex u, and decodes the
+   next neighbor into the block pointed to by v. adj_cmp_iter_next returns
+   nonzero if a neighbor was decoded, and 0 if the list was exhausted. An
+   iterator is a small struct that can be copied, e.g. onto a stack in an
+   iterative DFS.
+*/
+void adj_cmp_iter_init(adj_cmp_iter_t *it, const adj_cmp_t *c, size_t u);
+int adj_cmp_iter_next(adj_cmp_iter_t *it, size_t *v);
+
+/**
+   Frees a compressed adjacency list and leaves a block of size
+   sizeof(adj_cmp_t) pointed to by the c parameter.
+*/
+void adj_cmp_free(adj_cmp_t *c);
+
+/**
+   Initializes and builds the immutable compact-id adjacency list of a
+   directed or undirected graph in CSR format. The vertex weight pairs of
+   each list are in the same order as in the list built by
+   adj_lst_csr_dir_build or adj_lst_csr_undir_build. Exits with an error
+   message if the number of vertices is greater than UINT_MAX.
+   u           : pointer to a preallocated block of size sizeof(adj_uint_t)
+   g           : pointer to a graph previously constructed with at least
+                 graph_base_init
+*/
+void adj_uint_dir_build(adj_uint_t *u, const graph_t *g);
+void adj_uint_undir_build(adj_uint_t *u, const graph_t *g);
+
+/**
+   Initializes and builds an immutable compact-id copy of an adjacency list
+   in either format, with the same order of vertex weight pairs. Exits with
+   an error message if the number of vertices is greater than UINT_MAX.
+   u           : pointer to a preallocated block of size sizeof(adj_uint_t)
+   a           : pointer to an adjacency list in either format
+*/
+void adj_uint_copy(adj_uint_t *u, const adj_lst_t *a);
+
+/**
+   Returns a pointer to the first vertex weight pair in the list of a
+   vertex v, and the number of vertex weight pairs in the list.
+*/
+void *adj_uint_vt_pairs(const adj_uint_t *u, size_t v);
+size_t adj_uint_vt_num_pairs(const adj_uint_t *u, size_t v);
+
+/**
+   Frees a compact-id adjacency list and leaves a block of size
+   sizeof(adj_uint_t) pointed to by the u parameter.
+*/
+void adj_uint_free(adj_uint_t *u);
+
 #endif
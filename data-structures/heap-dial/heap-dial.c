@@ -0,0 +1,169 @@
+/**
+   heap-dial.c
+
+   Implementation of a dynamically allocated monotone (min) bucket queue
+   with size_t priorities and elements that are indices in the range
+   [0, count).
+
+   The implementation provides the push, search, update, and pop
+   operations of a min heap under the monotonicity condition of
+   Dijkstra's algorithm with integer edge weights in [0, max_diff]: the
+   priority value of a pushed or updated element is in the range
+   [l, l + max_diff], where l is the priority value of the last popped
+   element. A circular array of max_diff + 1 buckets contains the elements
+   in doubly linked lists that are represented with arrays indexed by
+   elements. The push, search, and update operations run in O(1) time, and
+   a pop operation scans at most max_diff + 1 buckets, resulting in a
+   O(E + V * max_diff) running time of Dijkstra's algorithm without
+   comparisons of priority values and without a hash table.
+
+   The implementation does not use stdint.h and is portable under C89/C90
+   and C99.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "heap-dial.h"
+#include "utilities-mem.h"
+
+static const size_t C_NIL = (size_t)-1;
+
+static size_t bkt_ix(const heap_dial_t *h, size_t pty);
+static void bkt_add(heap_dial_t *h, size_t b, size_t elt);
+static void bkt_rem(heap_dial_t *h, size_t b, size_t elt);
+
+/**
+   Initializes a bucket queue.
+   h           : pointer to a preallocated block of size
+                 sizeof(heap_dial_t)
+   count       : > 0 number of element indices; each element is an index
+                 in the range [0, count)
+   max_diff    : < the maximal value of size_t; the maximal difference
+                 between a pushed or updated priority value and the
+                 priority value of the last popped element
+*/
+void heap_dial_init(heap_dial_t *h, size_t count, size_t max_diff){
+  size_t i;
+  h->count = count;
+  h->num_elts = 0;
+  h->num_bkts = add_sz_perror(max_diff, 1);
+  h->last = 0;
+  h->last_ix = 0;
+  h->ptys = malloc_perror(count, sizeof(size_t));
+  h->nexts = malloc_perror(count, sizeof(size_t));
+  h->prevs = malloc_perror(count, sizeof(size_t));
+  h->heads = malloc_perror(h->num_bkts, sizeof(size_t));
+  h->in_heap = calloc_perror(count, sizeof(unsigned char));
+  for (i = 0; i < h->num_bkts; i++){
+    h->heads[i] = C_NIL;
+  }
+}
+
+/**
+   Pushes an element that is not in a bucket queue with a priority value
+   in the range [l, l + max_diff], where l is the priority value of the
+   last popped element, or 0 if no element was popped.
+*/
+void heap_dial_push(heap_dial_t *h, size_t pty, size_t elt){
+  h->ptys[elt] = pty;
+  h->in_heap[elt] = 1;
+  bkt_add(h, bkt_ix(h, pty), elt);
+  h->num_elts++;
+}
+
+/**
+   Returns a pointer to the priority value of an element if the element is
+   in a bucket queue, otherwise returns NULL. The priority value is
+   modified only with heap_dial_update.
+*/
+const size_t *heap_dial_search(const heap_dial_t *h, size_t elt){
+  if (!h->in_heap[elt]) return NULL;
+  return &h->ptys[elt];
+}
+
+/**
+   Updates the priority value of an element that is in a bucket queue. The
+   new priority value is in the range [l, l + max_diff], where l is the
+   priority value of the last popped element, or 0 if no element was
+   popped.
+*/
+void heap_dial_update(heap_dial_t *h, size_t pty, size_t elt){
+  bkt_rem(h, bkt_ix(h, h->ptys[elt]), elt);
+  h->ptys[elt] = pty;
+  bkt_add(h, bkt_ix(h, pty), elt);
+}
+
+/**
+   Pops an element associated with a minimal priority value according to
+   a bucket queue. If the bucket queue is empty, the blocks pointed to by
+   pty and elt remain unchanged.
+*/
+void heap_dial_pop(heap_dial_t *h, size_t *pty, size_t *elt){
+  size_t u;
+  if (h->num_elts == 0) return;
+  /* at most num_bkts buckets are scanned due to monotonicity */
+  while (h->heads[h->last_ix] == C_NIL){
+    h->last++;
+    h->last_ix++;
+    if (h->last_ix == h->num_bkts) h->last_ix = 0;
+  }
+  u = h->heads[h->last_ix];
+  *pty = h->ptys[u];
+  *elt = u;
+  bkt_rem(h, h->last_ix, u);
+  h->in_heap[u] = 0;
+  h->num_elts--;
+}
+
+/**
+   Frees a bucket queue and leaves a block of size sizeof(heap_dial_t)
+   pointed to by the h parameter.
+*/
+void heap_dial_free(heap_dial_t *h){
+  free(h->ptys);
+  free(h->nexts);
+  free(h->prevs);
+  free(h->heads);
+  free(h->in_heap);
+  h->ptys = NULL;
+  h->nexts = NULL;
+  h->prevs = NULL;
+  h->heads = NULL;
+  h->in_heap = NULL;
+}
+
+/**
+   Computes the index of the bucket of a priority value in the circular
+   array of buckets, in an overflow-safe fashion.
+*/
+static size_t bkt_ix(const heap_dial_t *h, size_t pty){
+  size_t d = pty - h->last; /* < num_bkts */
+  if (d < h->num_bkts - h->last_ix) return h->last_ix + d;
+  return d - (h->num_bkts - h->last_ix);
+}
+
+/**
+   Inserts an element at the front of the list of a bucket.
+*/
+static void bkt_add(heap_dial_t *h, size_t b, size_t elt){
+  size_t head = h->heads[b];
+  h->nexts[elt] = head;
+  h->prevs[elt] = C_NIL;
+  if (head != C_NIL) h->prevs[head] = elt;
+  h->heads[b] = elt;
+}
+
+/**
+   Removes an element from the list of a bucket.
+*/
+static void bkt_rem(heap_dial_t *h, size_t b, size_t elt){
+  size_t next = h->nexts[elt];
+  size_t prev = h->prevs[elt];
+  if (prev == C_NIL){
+    h->heads[b] = next;
+  }else{
+    h->nexts[prev] = next;
+  }
+  if (next != C_NIL) h->prevs[next] = prev;
+}
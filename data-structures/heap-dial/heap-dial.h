@@ -0,0 +1,89 @@
+/**
+   heap-dial.h
+
+   Struct declarations and declarations of accessible functions of a
+   dynamically allocated monotone (min) bucket queue with size_t priorities
+   and elements that are indices in the range [0, count).
+
+   The implementation provides the push, search, update, and pop
+   operations of a min heap under the monotonicity condition of
+   Dijkstra's algorithm with integer edge weights in [0, max_diff]: the
+   priority value of a pushed or updated element is in the range
+   [l, l + max_diff], where l is the priority value of the last popped
+   element. A circular array of max_diff + 1 buckets contains the elements
+   in doubly linked lists that are represented with arrays indexed by
+   elements. The push, search, and update operations run in O(1) time, and
+   a pop operation scans at most max_diff + 1 buckets, resulting in a
+   O(E + V * max_diff) running time of Dijkstra's algorithm without
+   comparisons of priority values and without a hash table.
+
+   The implementation does not use stdint.h and is portable under C89/C90
+   and C99.
+*/
+
+#ifndef HEAP_DIAL_H
+#define HEAP_DIAL_H
+
+#include <stddef.h>
+
+typedef struct{
+  size_t count; /* number of element indices */
+  size_t num_elts;
+  size_t num_bkts; /* max_diff + 1 */
+  size_t last; /* priority value of the last popped element */
+  size_t last_ix; /* bucket index of last */
+  size_t *ptys; /* priority value of each element index */
+  size_t *nexts; /* next element in a bucket of each element */
+  size_t *prevs; /* previous element in a bucket of each element */
+  size_t *heads; /* first element in each bucket */
+  unsigned char *in_heap;
+} heap_dial_t;
+
+/**
+   Initializes a bucket queue.
+   h           : pointer to a preallocated block of size
+                 sizeof(heap_dial_t)
+   count       : > 0 number of element indices; each element is an index
+                 in the range [0, count)
+   max_diff    : < the maximal value of size_t; the maximal difference
+                 between a pushed or updated priority value and the
+                 priority value of the last popped element
+*/
+void heap_dial_init(heap_dial_t *h, size_t count, size_t max_diff);
+
+/**
+   Pushes an element that is not in a bucket queue with a priority value
+   in the range [l, l + max_diff], where l is the priority value of the
+   last popped element, or 0 if no element was popped.
+*/
+void heap_dial_push(heap_dial_t *h, size_t pty, size_t elt);
+
+/**
+   Returns a pointer to the priority value of an element if the element is
+   in a bucket queue, otherwise returns NULL. The priority value is
+   modified only with heap_dial_update.
+*/
+const size_t *heap_dial_search(const heap_dial_t *h, size_t elt);
+
+/**
+   Updates the priority value of an element that is in a bucket queue. The
+   new priority value is in the range [l, l + max_diff], where l is the
+   priority value of the last popped element, or 0 if no element was
+   popped.
+*/
+void heap_dial_update(heap_dial_t *h, size_t pty, size_t elt);
+
+/**
+   Pops an element associated with a minimal priority value according to
+   a bucket queue. If the bucket queue is empty, the blocks pointed to by
+   pty and elt remain unchanged.
+*/
+void heap_dial_pop(heap_dial_t *h, size_t *pty, size_t *elt);
+
+/**
+   Frees a bucket queue and leaves a block of size sizeof(heap_dial_t)
+   pointed to by the h parameter.
+*/
+void heap_dial_free(heap_dial_t *h);
+
+#endif
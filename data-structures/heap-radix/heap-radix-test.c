@@ -0,0 +1,231 @@
+/**
+   heap-radix-test.c
+
+   Tests of a monotone (min) radix heap with size_t priorities and
+   elements that are indices.
+
+   The following command line arguments can be used to customize tests:
+   heap-radix-test
+      [0, # bits in size_t - 1) : i s.t. # inserts = 2^i
+      [0, 1] : on/off push pop free test
+      [0, 1] : on/off interleaved update search test
+
+   usage examples:
+   ./heap-radix-test
+   ./heap-radix-test 21
+   ./heap-radix-test 20 0 1
+
+   heap-radix-test can be run with any subset of command line arguments in
+   the above-defined order. If the (i + 1)th argument is specified then the
+   ith argument must be specified for i >= 0. Default values are used for
+   the unspecified arguments according to the C_ARGS_DEF array.
+
+   The implementation of tests does not use stdint.h and is portable under
+   C89/C90 and C99 with the only requirement that CHAR_BIT * sizeof(size_t)
+   is greater or equal to 16 and is even.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include "heap-radix.h"
+#include "utilities-mem.h"
+#include "utilities-mod.h"
+
+#define RGENS_SEED() do{srand(time(NULL));}while (0)
+#define RANDOM() (rand()) /* [0, RAND_MAX] */
+#define TOLU(i) ((unsigned long int)(i)) /* printing size_t under C89/C90 */
+
+/* input handling */
+const char *C_USAGE =
+  "heap-radix-test\n"
+  "[0, # bits in size_t - 1) : i s.t. # inserts = 2^i\n"
+  "[0, 1] : on/off push pop free test\n"
+  "[0, 1] : on/off interleaved update search test\n";
+const int C_ARGC_MAX = 4;
+const size_t C_ARGS_DEF[3] = {14, 1, 1};
+const size_t C_FULL_BIT = CHAR_BIT * sizeof(size_t);
+
+/* tests */
+const size_t C_PTY_HIGH = (size_t)-1 >> 1;
+const size_t C_INCR_HIGH = 0xffffffff; /* 32-bit edge weights */
+
+size_t random_range(size_t high);
+void print_test_result(int res);
+
+/**
+   Run heap_radix_{push, pop, free} test on random priority values
+   across the range of size_t, including the pushing of elements after
+   pops with priority values that are equal to the priority value of the
+   last popped element.
+*/
+void run_push_pop_free_test(size_t log_ins){
+  int res = 1;
+  size_t i, n, pty, elt, prev_pty;
+  size_t *ptys = NULL;
+  char *popped = NULL;
+  clock_t t_push, t_pop;
+  heap_radix_t h;
+  n = pow_two_perror(log_ins);
+  ptys = malloc_perror(n, sizeof(size_t));
+  popped = calloc_perror(n, sizeof(char));
+  for (i = 0; i < n; i++){
+    ptys[i] = random_range(C_PTY_HIGH);
+  }
+  printf("Run heap_radix_{push, pop, free} test\n"
+	 "\tnumber of elements: %lu\n", TOLU(n));
+  heap_radix_init(&h, n);
+  t_push = clock();
+  for (i = 0; i < n; i++){
+    heap_radix_push(&h, ptys[i], i);
+  }
+  t_push = clock() - t_push;
+  res *= (h.num_elts == n);
+  prev_pty = 0;
+  t_pop = clock();
+  for (i = 0; i < n; i++){
+    heap_radix_pop(&h, &pty, &elt);
+    res *= (pty >= prev_pty && pty == ptys[elt] && !popped[elt]);
+    popped[elt] = 1;
+    prev_pty = pty;
+  }
+  t_pop = clock() - t_pop;
+  res *= (h.num_elts == 0);
+  /* push at the priority value of the last popped element */
+  for (i = 0; i < n; i++){
+    heap_radix_push(&h, prev_pty, i);
+  }
+  for (i = 0; i < n; i++){
+    heap_radix_pop(&h, &pty, &elt);
+    res *= (pty == prev_pty);
+  }
+  res *= (h.num_elts == 0);
+  heap_radix_pop(&h, &pty, &elt);
+  res *= (h.num_elts == 0);
+  heap_radix_free(&h);
+  printf("\t\tpush elements:                               "
+	 "%.4f seconds\n", (float)t_push / CLOCKS_PER_SEC);
+  printf("\t\tpop elements:                                "
+	 "%.4f seconds\n", (float)t_pop / CLOCKS_PER_SEC);
+  printf("\t\torder correctness:                           ");
+  print_test_result(res);
+  free(ptys);
+  free(popped);
+  ptys = NULL;
+  popped = NULL;
+}
+
+/**
+   Run heap_radix_{update, search} test with interleaved pops, where the
+   pushed and updated priority values are the priority value of the last
+   popped element incremented by a random 32-bit value, as in Dijkstra's
+   algorithm with 32-bit edge weights.
+*/
+void run_update_search_test(size_t log_ins){
+  int res = 1;
+  size_t i, n, pty, elt, prev_pty, num_pops = 0;
+  size_t *ptys = NULL;
+  const size_t *p = NULL;
+  clock_t t;
+  heap_radix_t h;
+  n = pow_two_perror(log_ins);
+  ptys = malloc_perror(n, sizeof(size_t));
+  printf("Run heap_radix_{update, search} test with interleaved pops\n"
+	 "\tnumber of elements: %lu\n", TOLU(n));
+  heap_radix_init(&h, n);
+  prev_pty = 0;
+  t = clock();
+  for (i = 0; i < n; i++){
+    ptys[i] = prev_pty + random_range(C_INCR_HIGH);
+    heap_radix_push(&h, ptys[i], i);
+    /* decrease the priority value of a random element in the heap */
+    elt = random_range(i);
+    p = heap_radix_search(&h, elt);
+    if (p != NULL){
+      res *= (*p == ptys[elt]);
+      pty = prev_pty + random_range(*p - prev_pty);
+      heap_radix_update(&h, pty, elt);
+      ptys[elt] = pty;
+      res *= (*heap_radix_search(&h, elt) == pty);
+    }
+    if (i & 1){
+      heap_radix_pop(&h, &pty, &elt);
+      res *= (pty >= prev_pty && pty == ptys[elt]);
+      res *= (heap_radix_search(&h, elt) == NULL);
+      prev_pty = pty;
+      num_pops++;
+    }
+  }
+  while (h.num_elts > 0){
+    heap_radix_pop(&h, &pty, &elt);
+    res *= (pty >= prev_pty && pty == ptys[elt]);
+    prev_pty = pty;
+    num_pops++;
+  }
+  t = clock() - t;
+  res *= (num_pops == n);
+  for (i = 0; i < n; i++){
+    res *= (heap_radix_search(&h, i) == NULL);
+  }
+  heap_radix_free(&h);
+  printf("\t\tpush update search pop elements:             "
+	 "%.4f seconds\n", (float)t / CLOCKS_PER_SEC);
+  printf("\t\torder correctness:                           ");
+  print_test_result(res);
+  free(ptys);
+  ptys = NULL;
+}
+
+/**
+   Returns a generator-uniform random size_t value in [0, high]. Random
+   bits are combined across calls to rand to cover high.
+*/
+size_t random_range(size_t high){
+  size_t ret = 0;
+  size_t rem = high;
+  while (rem > 0){
+    ret = (ret << (CHAR_BIT - 1)) ^ (size_t)RANDOM();
+    rem >>= CHAR_BIT - 1;
+  }
+  if (high == (size_t)-1) return ret;
+  return ret % (high + 1);
+}
+
+/**
+   Prints a test result.
+*/
+void print_test_result(int res){
+  if (res){
+    printf("SUCCESS\n");
+  }else{
+    printf("FAILURE\n");
+  }
+}
+
+int main(int argc, char *argv[]){
+  int i;
+  size_t *args = NULL;
+  RGENS_SEED();
+  if (argc > C_ARGC_MAX){
+    fprintf(stderr, "USAGE:\n%s", C_USAGE);
+    exit(EXIT_FAILURE);
+  }
+  args = malloc_perror(C_ARGC_MAX - 1, sizeof(size_t));
+  memcpy(args, C_ARGS_DEF, (C_ARGC_MAX - 1) * sizeof(size_t));
+  for (i = 1; i < argc; i++){
+    args[i - 1] = atoi(argv[i]);
+  }
+  if (args[0] > C_FULL_BIT - 2 ||
+      args[1] > 1 ||
+      args[2] > 1){
+    fprintf(stderr, "USAGE:\n%s", C_USAGE);
+    exit(EXIT_FAILURE);
+  }
+  if (args[1]) run_push_pop_free_test(args[0]);
+  if (args[2]) run_update_search_test(args[0]);
+  free(args);
+  args = NULL;
+  return 0;
+}
@@ -0,0 +1,218 @@
+/**
+   heap-radix.c
+
+   Implementation of a dynamically allocated monotone (min) radix heap with
+   size_t priorities and elements that are indices in the range [0, count).
+
+   The implementation provides the push, search, update, and pop
+   operations of a min heap under the monotonicity condition of
+   Dijkstra's algorithm: the priority value of a pushed or updated element
+   is greater or equal to the priority value of the last popped element.
+   An element is placed into one of CHAR_BIT * sizeof(size_t) + 1 buckets
+   according to the position of the most significant bit in which its
+   priority value differs from the priority value of the last popped
+   element. An element moves only to lower buckets, resulting in an
+   amortized O(log C) running time of a pop operation, where C is the
+   largest difference between the priority values in a heap, and an O(1)
+   running time of the push, search, and update operations.
+
+   The index-based representation of elements avoids a hash table
+   parameter. The space requirement is O(count) for the arrays indexed by
+   elements and O(n) for the buckets, where n is the maximal number of
+   simultaneously present elements.
+
+   The implementation does not use stdint.h and is portable under C89/C90
+   and C99.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "heap-radix.h"
+#include "utilities-mem.h"
+
+static const size_t C_FULL_BIT = CHAR_BIT * sizeof(size_t);
+static const size_t C_BKT_INIT_COUNT = 4;
+
+static size_t bkt_ix(const heap_radix_t *h, size_t pty);
+static void bkt_add(heap_radix_t *h, size_t b, size_t elt);
+static void bkt_rem(heap_radix_t *h, size_t elt);
+
+/**
+   Initializes a radix heap.
+   h           : pointer to a preallocated block of size
+                 sizeof(heap_radix_t)
+   count       : > 0 number of element indices; each element is an index
+                 in the range [0, count)
+*/
+void heap_radix_init(heap_radix_t *h, size_t count){
+  size_t i;
+  h->count = count;
+  h->num_elts = 0;
+  h->last = 0;
+  h->max_shift = 1;
+  while (2 * h->max_shift < C_FULL_BIT){
+    h->max_shift *= 2;
+  }
+  h->num_bkts = C_FULL_BIT + 1;
+  h->ptys = malloc_perror(count, sizeof(size_t));
+  h->bkt_ixs = malloc_perror(count, sizeof(size_t));
+  h->pos_ixs = malloc_perror(count, sizeof(size_t));
+  for (i = 0; i < count; i++){
+    h->bkt_ixs[i] = h->num_bkts;
+  }
+  h->bkt_counts = calloc_perror(h->num_bkts, sizeof(size_t));
+  h->bkt_num_elts = calloc_perror(h->num_bkts, sizeof(size_t));
+  h->bkts = malloc_perror(h->num_bkts, sizeof(size_t *));
+  for (i = 0; i < h->num_bkts; i++){
+    h->bkts[i] = NULL;
+  }
+}
+
+/**
+   Pushes an element that is not in a heap with a priority value that is
+   greater or equal to the priority value of the last popped element, or
+   any priority value if no element was popped.
+*/
+void heap_radix_push(heap_radix_t *h, size_t pty, size_t elt){
+  h->ptys[elt] = pty;
+  bkt_add(h, bkt_ix(h, pty), elt);
+  h->num_elts++;
+}
+
+/**
+   Returns a pointer to the priority value of an element if the element is
+   in a heap, otherwise returns NULL. The priority value is modified only
+   with heap_radix_update.
+*/
+const size_t *heap_radix_search(const heap_radix_t *h, size_t elt){
+  if (h->bkt_ixs[elt] == h->num_bkts) return NULL;
+  return &h->ptys[elt];
+}
+
+/**
+   Updates the priority value of an element that is in a heap. The new
+   priority value is greater or equal to the priority value of the last
+   popped element.
+*/
+void heap_radix_update(heap_radix_t *h, size_t pty, size_t elt){
+  size_t b = bkt_ix(h, pty);
+  h->ptys[elt] = pty;
+  if (b != h->bkt_ixs[elt]){
+    bkt_rem(h, elt);
+    bkt_add(h, b, elt);
+  }
+}
+
+/**
+   Pops an element associated with a minimal priority value according to
+   a heap. If the heap is empty, the blocks pointed to by pty and elt
+   remain unchanged.
+*/
+void heap_radix_pop(heap_radix_t *h, size_t *pty, size_t *elt){
+  size_t b, i, n, u;
+  size_t *bkt = NULL;
+  if (h->num_elts == 0) return;
+  if (h->bkt_num_elts[0] == 0){
+    /* redistribute the first nonempty bucket around its minimum */
+    b = 1;
+    while (h->bkt_num_elts[b] == 0) b++;
+    bkt = h->bkts[b];
+    n = h->bkt_num_elts[b];
+    h->last = h->ptys[bkt[0]];
+    for (i = 1; i < n; i++){
+      if (h->ptys[bkt[i]] < h->last) h->last = h->ptys[bkt[i]];
+    }
+    for (i = 0; i < n; i++){
+      /* each element moves to a lower bucket */
+      u = bkt[i];
+      bkt_add(h, bkt_ix(h, h->ptys[u]), u);
+    }
+    h->bkt_num_elts[b] = 0;
+  }
+  u = h->bkts[0][h->bkt_num_elts[0] - 1];
+  *pty = h->ptys[u];
+  *elt = u;
+  bkt_rem(h, u);
+  h->num_elts--;
+}
+
+/**
+   Frees a radix heap and leaves a block of size sizeof(heap_radix_t)
+   pointed to by the h parameter.
+*/
+void heap_radix_free(heap_radix_t *h){
+  size_t i;
+  for (i = 0; i < h->num_bkts; i++){
+    free(h->bkts[i]);
+    h->bkts[i] = NULL;
+  }
+  free(h->ptys);
+  free(h->bkt_ixs);
+  free(h->pos_ixs);
+  free(h->bkt_counts);
+  free(h->bkt_num_elts);
+  free(h->bkts);
+  h->ptys = NULL;
+  h->bkt_ixs = NULL;
+  h->pos_ixs = NULL;
+  h->bkt_counts = NULL;
+  h->bkt_num_elts = NULL;
+  h->bkts = NULL;
+}
+
+/**
+   Computes the bucket index of a priority value, which is 0 if the value
+   equals the priority value of the last popped element, and otherwise
+   1 + the position of the most significant bit in which the two values
+   differ.
+*/
+static size_t bkt_ix(const heap_radix_t *h, size_t pty){
+  size_t x = pty ^ h->last;
+  size_t s = h->max_shift;
+  size_t ix = 0;
+  if (x == 0) return 0;
+  while (s > 0){
+    if (x >> s){
+      x >>= s;
+      ix += s;
+    }
+    s >>= 1;
+  }
+  return ix + 1;
+}
+
+/**
+   Appends an element to a bucket, growing the bucket if necessary.
+*/
+static void bkt_add(heap_radix_t *h, size_t b, size_t elt){
+  if (h->bkt_num_elts[b] == h->bkt_counts[b]){
+    if (h->bkt_counts[b] == 0){
+      h->bkt_counts[b] = C_BKT_INIT_COUNT;
+    }else{
+      h->bkt_counts[b] = mul_sz_perror(2, h->bkt_counts[b]);
+    }
+    h->bkts[b] = realloc_perror(h->bkts[b],
+				h->bkt_counts[b],
+				sizeof(size_t));
+  }
+  h->bkts[b][h->bkt_num_elts[b]] = elt;
+  h->bkt_ixs[elt] = b;
+  h->pos_ixs[elt] = h->bkt_num_elts[b];
+  h->bkt_num_elts[b]++;
+}
+
+/**
+   Removes an element from its bucket by moving the last element of the
+   bucket into its position.
+*/
+static void bkt_rem(heap_radix_t *h, size_t elt){
+  size_t b = h->bkt_ixs[elt];
+  size_t i = h->pos_ixs[elt];
+  size_t last_elt = h->bkts[b][h->bkt_num_elts[b] - 1];
+  h->bkts[b][i] = last_elt;
+  h->pos_ixs[last_elt] = i;
+  h->bkt_num_elts[b]--;
+  h->bkt_ixs[elt] = h->num_bkts;
+}
@@ -0,0 +1,91 @@
+/**
+   heap-radix.h
+
+   Struct declarations and declarations of accessible functions of a
+   dynamically allocated monotone (min) radix heap with size_t priorities
+   and elements that are indices in the range [0, count).
+
+   The implementation provides the push, search, update, and pop
+   operations of a min heap under the monotonicity condition of
+   Dijkstra's algorithm: the priority value of a pushed or updated element
+   is greater or equal to the priority value of the last popped element.
+   An element is placed into one of CHAR_BIT * sizeof(size_t) + 1 buckets
+   according to the position of the most significant bit in which its
+   priority value differs from the priority value of the last popped
+   element. An element moves only to lower buckets, resulting in an
+   amortized O(log C) running time of a pop operation, where C is the
+   largest difference between the priority values in a heap, and an O(1)
+   running time of the push, search, and update operations.
+
+   The index-based representation of elements avoids a hash table
+   parameter. The space requirement is O(count) for the arrays indexed by
+   elements and O(n) for the buckets, where n is the maximal number of
+   simultaneously present elements.
+
+   The implementation does not use stdint.h and is portable under C89/C90
+   and C99.
+*/
+
+#ifndef HEAP_RADIX_H
+#define HEAP_RADIX_H
+
+#include <stddef.h>
+
+typedef struct{
+  size_t count; /* number of element indices */
+  size_t num_elts;
+  size_t last; /* priority value of the last popped element */
+  size_t max_shift; /* largest power of two < CHAR_BIT * sizeof(size_t) */
+  size_t num_bkts;
+  size_t *ptys; /* priority value of each element index */
+  size_t *bkt_ixs; /* bucket index of each element, num_bkts if absent */
+  size_t *pos_ixs; /* position of each element in its bucket */
+  size_t *bkt_counts;
+  size_t *bkt_num_elts;
+  size_t **bkts; /* arrays of element indices */
+} heap_radix_t;
+
+/**
+   Initializes a radix heap.
+   h           : pointer to a preallocated block of size
+                 sizeof(heap_radix_t)
+   count       : > 0 number of element indices; each element is an index
+                 in the range [0, count)
+*/
+void heap_radix_init(heap_radix_t *h, size_t count);
+
+/**
+   Pushes an element that is not in a heap with a priority value that is
+   greater or equal to the priority value of the last popped element, or
+   any priority value if no element was popped.
+*/
+void heap_radix_push(heap_radix_t *h, size_t pty, size_t elt);
+
+/**
+   Returns a pointer to the priority value of an element if the element is
+   in a heap, otherwise returns NULL. The priority value is modified only
+   with heap_radix_update.
+*/
+const size_t *heap_radix_search(const heap_radix_t *h, size_t elt);
+
+/**
+   Updates the priority value of an element that is in a heap. The new
+   priority value is greater or equal to the priority value of the last
+   popped element.
+*/
+void heap_radix_update(heap_radix_t *h, size_t pty, size_t elt);
+
+/**
+   Pops an element associated with a minimal priority value according to
+   a heap. If the heap is empty, the blocks pointed to by pty and elt
+   remain unchanged.
+*/
+void heap_radix_pop(heap_radix_t *h, size_t *pty, size_t *elt);
+
+/**
+   Frees a radix heap and leaves a block of size sizeof(heap_radix_t)
+   pointed to by the h parameter.
+*/
+void heap_radix_free(heap_radix_t *h);
+
+#endif
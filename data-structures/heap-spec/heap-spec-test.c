@@ -0,0 +1,382 @@
+/**
+   heap-spec-test.c
+
+   Tests of (min) heaps with a hash table parameter that are specialized at
+   compile time for a priority type and size_t elements, and comparisons
+   with the generic heap in heap.h.
+
+   The following command line arguments can be used to customize tests:
+   heap-spec-test
+      [0, # bits in size_t - 1) : i s.t. # inserts = 2^i
+      [0, 1] : on/off push pop free test
+      [0, 1] : on/off update search test
+
+   usage examples:
+   ./heap-spec-test
+   ./heap-spec-test 21
+   ./heap-spec-test 20 0 1
+
+   heap-spec-test can be run with any subset of command line arguments in
+   the above-defined order. If the (i + 1)th argument is specified then the
+   ith argument must be specified for i >= 0. Default values are used for
+   the unspecified arguments according to the C_ARGS_DEF array.
+
+   The implementation of tests does not use stdint.h and is portable under
+   C89/C90 and C99 with the only requirement that CHAR_BIT * sizeof(size_t)
+   is greater or equal to 16 and is even.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include "heap-spec.h"
+#include "heap.h"
+#include "utilities-mem.h"
+#include "utilities-mod.h"
+
+#define RGENS_SEED() do{srand(time(NULL));}while (0)
+#define RANDOM() (rand()) /* [0, RAND_MAX] */
+#define DRAND() ((double)rand() / RAND_MAX) /* [0.0, 1.0] */
+#define TOLU(i) ((unsigned long int)(i)) /* printing size_t under C89/C90 */
+
+/* input handling */
+const char *C_USAGE =
+  "heap-spec-test\n"
+  "[0, # bits in size_t - 1) : i s.t. # inserts = 2^i\n"
+  "[0, 1] : on/off push pop free test\n"
+  "[0, 1] : on/off update search test\n";
+const int C_ARGC_MAX = 4;
+const size_t C_ARGS_DEF[3] = {14, 1, 1};
+const size_t C_FULL_BIT = CHAR_BIT * sizeof(size_t);
+
+/* tests */
+const size_t C_INIT_COUNT = 1;
+
+/* index array hash table for size_t elements in [0, count) */
+
+typedef struct{
+  size_t count;
+} context_t;
+
+typedef struct{
+  size_t count;
+  char *key_present;
+  size_t *elts;
+} ht_ix_t;
+
+void ht_ix_init(ht_ix_t *ht,
+		size_t key_size,
+		size_t elt_size,
+		void (*free_elt)(void *),
+		void *context);
+void ht_ix_insert(ht_ix_t *ht, const size_t *key, const size_t *elt);
+void *ht_ix_search(const ht_ix_t *ht, const size_t *key);
+void ht_ix_remove(ht_ix_t *ht, const size_t *key, size_t *elt);
+void ht_ix_free(ht_ix_t *ht);
+
+size_t random_range(size_t high);
+unsigned int random_uint();
+unsigned long random_ulong();
+double random_double();
+int cmp_uint(const void *a, const void *b);
+int cmp_ulong(const void *a, const void *b);
+int cmp_double(const void *a, const void *b);
+void print_test_result(int res);
+
+/**
+   Defines a test of push, pop, and free operations of a specialized heap
+   without a hash table, in comparison with the generic heap.
+*/
+#define RUN_PUSH_POP_FREE_TEST(name, pty_type, tname)			\
+  void run_##name##_push_pop_free_test(size_t log_ins){			\
+    int res = 1;							\
+    size_t i, n, elt = 0, elt_gen;					\
+    pty_type pty = 0, pty_gen = 0;					\
+    pty_type *ptys = NULL;						\
+    char *popped = NULL;						\
+    clock_t t_spec, t_gen;						\
+    name##_t h;								\
+    heap_t h_gen;							\
+    n = pow_two_perror(log_ins);					\
+    ptys = malloc_perror(n, sizeof(pty_type));				\
+    popped = calloc_perror(n, sizeof(char));				\
+    for (i = 0; i < n; i++){						\
+      ptys[i] = random_##tname();					\
+    }									\
+    printf("Run " #name "_{push, pop, free} test\n"			\
+	   "\tnumber of elements: %lu\n", TOLU(n));			\
+    name##_init(&h, C_INIT_COUNT, NULL);				\
+    heap_init(&h_gen, C_INIT_COUNT, sizeof(pty_type), sizeof(size_t),	\
+	      NULL, cmp_##tname, NULL);				\
+    t_spec = clock();							\
+    for (i = 0; i < n; i++){						\
+      name##_push(&h, &ptys[i], &i);					\
+    }									\
+    for (i = 0; i < n; i++){						\
+      name##_pop(&h, &pty, &elt);					\
+      res *= (!popped[elt] && pty == ptys[elt]);			\
+      popped[elt] = 1;							\
+      if (i > 0) res *= (pty_gen <= pty);				\
+      pty_gen = pty;							\
+    }									\
+    t_spec = clock() - t_spec;						\
+    res *= (h.num_elts == 0);						\
+    name##_pop(&h, &pty, &elt);						\
+    res *= (h.num_elts == 0);						\
+    t_gen = clock();							\
+    for (i = 0; i < n; i++){						\
+      heap_push(&h_gen, &ptys[i], &i);					\
+    }									\
+    for (i = 0; i < n; i++){						\
+      heap_pop(&h_gen, &pty_gen, &elt_gen);				\
+    }									\
+    t_gen = clock() - t_gen;						\
+    name##_free(&h);							\
+    heap_free(&h_gen);							\
+    printf("\t\tspecialized heap push pop:                   "	\
+	   "%.4f seconds\n", (float)t_spec / CLOCKS_PER_SEC);		\
+    printf("\t\tgeneric heap push pop:                       "	\
+	   "%.4f seconds\n", (float)t_gen / CLOCKS_PER_SEC);		\
+    printf("\t\torder correctness:                           ");	\
+    print_test_result(res);						\
+    free(ptys);								\
+    free(popped);							\
+    ptys = NULL;							\
+    popped = NULL;							\
+  }
+
+/**
+   Defines a test of update and search operations of a specialized heap
+   with a hash table, where the priority value of each element is
+   decreased once, with interleaved pops.
+*/
+#define RUN_UPDATE_SEARCH_TEST(name, pty_type, tname)			\
+  void run_##name##_update_search_test(size_t log_ins){		\
+    int res = 1;							\
+    size_t i, n, elt = 0, num_pops = 0;				\
+    pty_type pty = 0, prev_pty;						\
+    pty_type *ptys = NULL;						\
+    pty_type *p = NULL;							\
+    clock_t t;								\
+    context_t context;							\
+    ht_ix_t ht;								\
+    heap_ht_t hht;							\
+    name##_t h;								\
+    n = pow_two_perror(log_ins);					\
+    ptys = malloc_perror(n, sizeof(pty_type));				\
+    for (i = 0; i < n; i++){						\
+      ptys[i] = random_##tname();					\
+    }									\
+    context.count = n;							\
+    hht.ht = &ht;							\
+    hht.context = &context;						\
+    hht.init = (heap_ht_init)ht_ix_init;				\
+    hht.insert = (heap_ht_insert)ht_ix_insert;				\
+    hht.search = (heap_ht_search)ht_ix_search;				\
+    hht.remove = (heap_ht_remove)ht_ix_remove;				\
+    hht.free = (heap_ht_free)ht_ix_free;				\
+    printf("Run " #name "_{update, search} test\n"			\
+	   "\tnumber of elements: %lu\n", TOLU(n));			\
+    name##_init(&h, C_INIT_COUNT, &hht);				\
+    t = clock();							\
+    for (i = 0; i < n; i++){						\
+      name##_push(&h, &ptys[i], &i);					\
+    }									\
+    for (i = 0; i < n; i++){						\
+      /* decrease the priority value if i was not popped */		\
+      p = name##_search(&h, &i);					\
+      if (p != NULL){							\
+	res *= (*p == ptys[i]);						\
+	ptys[i] /= 2;							\
+	name##_update(&h, &ptys[i], &i);				\
+	res *= (*name##_search(&h, &i) == ptys[i]);			\
+      }									\
+      if (i & 1){							\
+	name##_pop(&h, &pty, &elt);					\
+	res *= (pty == ptys[elt] && name##_search(&h, &elt) == NULL);	\
+	num_pops++;							\
+      }									\
+    }									\
+    prev_pty = 0;							\
+    while (h.num_elts > 0){						\
+      name##_pop(&h, &pty, &elt);					\
+      res *= (pty == ptys[elt] && prev_pty <= pty);			\
+      prev_pty = pty;							\
+      num_pops++;							\
+    }									\
+    t = clock() - t;							\
+    res *= (num_pops == n);						\
+    for (i = 0; i < n; i++){						\
+      res *= (name##_search(&h, &i) == NULL);				\
+    }									\
+    name##_free(&h);							\
+    printf("\t\tpush search update pop:                      "	\
+	   "%.4f seconds\n", (float)t / CLOCKS_PER_SEC);		\
+    printf("\t\tcorrectness:                                 ");	\
+    print_test_result(res);						\
+    free(ptys);								\
+    ptys = NULL;							\
+  }
+
+RUN_PUSH_POP_FREE_TEST(heap_uint, unsigned int, uint)
+RUN_PUSH_POP_FREE_TEST(heap_ulong, unsigned long, ulong)
+RUN_PUSH_POP_FREE_TEST(heap_double, double, double)
+RUN_UPDATE_SEARCH_TEST(heap_uint, unsigned int, uint)
+RUN_UPDATE_SEARCH_TEST(heap_ulong, unsigned long, ulong)
+RUN_UPDATE_SEARCH_TEST(heap_double, double, double)
+
+/**
+   Index array hash table operations.
+*/
+
+void ht_ix_init(ht_ix_t *ht,
+		size_t key_size,
+		size_t elt_size,
+		void (*free_elt)(void *),
+		void *context){
+  ht->count = ((context_t *)context)->count;
+  ht->key_present = calloc_perror(ht->count, sizeof(char));
+  ht->elts = malloc_perror(ht->count, elt_size);
+  (void)key_size;
+  (void)free_elt;
+}
+
+void ht_ix_insert(ht_ix_t *ht, const size_t *key, const size_t *elt){
+  ht->key_present[*key] = 1;
+  ht->elts[*key] = *elt;
+}
+
+void *ht_ix_search(const ht_ix_t *ht, const size_t *key){
+  if (ht->key_present[*key]) return &ht->elts[*key];
+  return NULL;
+}
+
+void ht_ix_remove(ht_ix_t *ht, const size_t *key, size_t *elt){
+  *elt = ht->elts[*key];
+  ht->key_present[*key] = 0;
+}
+
+void ht_ix_free(ht_ix_t *ht){
+  free(ht->key_present);
+  free(ht->elts);
+  ht->key_present = NULL;
+  ht->elts = NULL;
+}
+
+/**
+   Returns a generator-uniform random size_t value in [0, high]. Random
+   bits are combined across calls to rand to cover high.
+*/
+size_t random_range(size_t high){
+  size_t ret = 0;
+  size_t rem = high;
+  while (rem > 0){
+    ret = (ret << (CHAR_BIT - 1)) ^ (size_t)RANDOM();
+    rem >>= CHAR_BIT - 1;
+  }
+  if (high == (size_t)-1) return ret;
+  return ret % (high + 1);
+}
+
+/**
+   Return random priority values of the tested types.
+*/
+
+unsigned int random_uint(){
+  return random_range(UINT_MAX);
+}
+
+unsigned long random_ulong(){
+  unsigned long ret = 0;
+  unsigned long rem = ULONG_MAX;
+  while (rem > 0){
+    ret = (ret << (CHAR_BIT - 1)) ^ (unsigned long)RANDOM();
+    rem >>= CHAR_BIT - 1;
+  }
+  return ret;
+}
+
+double random_double(){
+  return DRAND() * random_uint();
+}
+
+/**
+   Compare priority values of the tested types in the generic heap.
+*/
+
+int cmp_uint(const void *a, const void *b){
+  if (*(const unsigned int *)a > *(const unsigned int *)b){
+    return 1;
+  }else if (*(const unsigned int *)a < *(const unsigned int *)b){
+    return -1;
+  }else{
+    return 0;
+  }
+}
+
+int cmp_ulong(const void *a, const void *b){
+  if (*(const unsigned long *)a > *(const unsigned long *)b){
+    return 1;
+  }else if (*(const unsigned long *)a < *(const unsigned long *)b){
+    return -1;
+  }else{
+    return 0;
+  }
+}
+
+int cmp_double(const void *a, const void *b){
+  if (*(const double *)a > *(const double *)b){
+    return 1;
+  }else if (*(const double *)a < *(const double *)b){
+    return -1;
+  }else{
+    return 0;
+  }
+}
+
+/**
+   Prints a test result.
+*/
+void print_test_result(int res){
+  if (res){
+    printf("SUCCESS\n");
+  }else{
+    printf("FAILURE\n");
+  }
+}
+
+int main(int argc, char *argv[]){
+  int i;
+  size_t *args = NULL;
+  RGENS_SEED();
+  if (argc > C_ARGC_MAX){
+    fprintf(stderr, "USAGE:\n%s", C_USAGE);
+    exit(EXIT_FAILURE);
+  }
+  args = malloc_perror(C_ARGC_MAX - 1, sizeof(size_t));
+  memcpy(args, C_ARGS_DEF, (C_ARGC_MAX - 1) * sizeof(size_t));
+  for (i = 1; i < argc; i++){
+    args[i - 1] = atoi(argv[i]);
+  }
+  if (args[0] > C_FULL_BIT - 2 ||
+      args[1] > 1 ||
+      args[2] > 1){
+    fprintf(stderr, "USAGE:\n%s", C_USAGE);
+    exit(EXIT_FAILURE);
+  }
+  if (args[1]){
+    run_heap_uint_push_pop_free_test(args[0]);
+    run_heap_ulong_push_pop_free_test(args[0]);
+    run_heap_double_push_pop_free_test(args[0]);
+  }
+  if (args[2]){
+    run_heap_uint_update_search_test(args[0]);
+    run_heap_ulong_update_search_test(args[0]);
+    run_heap_double_update_search_test(args[0]);
+  }
+  free(args);
+  args = NULL;
+  return 0;
+}
@@ -0,0 +1,164 @@
+/**
+   heap-spec.c
+
+   Implementation of dynamically allocated (min) heaps with a hash table
+   parameter that are specialized at compile time for a priority type and
+   size_t elements (e.g. vertices).
+
+   A specialized heap provides the init, push, search, update, pop, and
+   free operations of the generic heap in heap.h, with the same hash table
+   parameter and the same semantics, but without the cmp_pty indirection
+   and without memcpy calls of pair_size bytes: priority values are
+   compared with the < operator and priority-element pairs are moved
+   with struct assignments, which are inlined by a compiler into loads
+   and stores.
+
+   HEAP_SPEC_DEFINE(name, pty_type) defines the operations declared with
+   HEAP_SPEC_DECLARE(name, pty_type) in heap-spec.h. The heaps with
+   unsigned int, unsigned long, and double priority values are
+   instantiated as heap_uint_t, heap_ulong_t, and heap_double_t.
+
+   The implementation does not use stdint.h and is portable under C89/C90
+   and C99.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "heap-spec.h"
+#include "heap.h"
+#include "utilities-mem.h"
+
+static void fprintf_stderr_exit(const char *s, int line);
+
+#define HEAP_SPEC_DEFINE(name, pty_type)				\
+									\
+  static void name##_grow(name##_t *h);					\
+  static void name##_heapify_up(name##_t *h, size_t i);			\
+  static void name##_heapify_down(name##_t *h, size_t i);		\
+									\
+  void name##_init(name##_t *h, size_t init_count, const heap_ht_t *hht){ \
+    if (init_count > HEAP_COUNT_MAX){					\
+      fprintf_stderr_exit("init_count > count maximum", __LINE__);	\
+    }									\
+    h->count = init_count;						\
+    h->num_elts = 0;							\
+    h->pairs = malloc_perror(init_count, sizeof(name##_pair_t));	\
+    h->hht = hht;							\
+    if (hht != NULL){							\
+      hht->init(hht->ht, sizeof(size_t), sizeof(size_t), NULL,		\
+		hht->context);						\
+    }									\
+  }									\
+									\
+  void name##_push(name##_t *h, const pty_type *pty, const size_t *elt){ \
+    if (h->count == h->num_elts) name##_grow(h);			\
+    h->pairs[h->num_elts].pty = *pty;					\
+    h->pairs[h->num_elts].elt = *elt;					\
+    h->num_elts++;							\
+    name##_heapify_up(h, h->num_elts - 1);				\
+  }									\
+									\
+  pty_type *name##_search(const name##_t *h, const size_t *elt){	\
+    const size_t *ix_ptr = h->hht->search(h->hht->ht, elt);		\
+    if (ix_ptr != NULL){						\
+      return &h->pairs[*ix_ptr].pty;					\
+    }else{								\
+      return NULL;							\
+    }									\
+  }									\
+									\
+  void name##_update(name##_t *h, const pty_type *pty, const size_t *elt){ \
+    size_t ix = *(const size_t *)h->hht->search(h->hht->ht, elt);	\
+    h->pairs[ix].pty = *pty;						\
+    name##_heapify_up(h, ix);						\
+    name##_heapify_down(h, ix);						\
+  }									\
+									\
+  void name##_pop(name##_t *h, pty_type *pty, size_t *elt){		\
+    size_t ix_buf;							\
+    if (h->num_elts == 0) return;					\
+    *pty = h->pairs[0].pty;						\
+    *elt = h->pairs[0].elt;						\
+    if (h->hht != NULL) h->hht->remove(h->hht->ht, elt, &ix_buf);	\
+    h->num_elts--;							\
+    if (h->num_elts > 0){						\
+      h->pairs[0] = h->pairs[h->num_elts];				\
+      name##_heapify_down(h, 0);					\
+    }									\
+  }									\
+									\
+  void name##_free(name##_t *h){					\
+    free(h->pairs);							\
+    if (h->hht != NULL) h->hht->free(h->hht->ht);			\
+    h->pairs = NULL;							\
+  }									\
+									\
+  /* doubles the count of a heap upto HEAP_COUNT_MAX */			\
+  static void name##_grow(name##_t *h){					\
+    if (h->count == HEAP_COUNT_MAX){					\
+      fprintf_stderr_exit("tried to exceed the count maximum", __LINE__); \
+    }									\
+    if (HEAP_COUNT_MAX - h->count < h->count){				\
+      h->count = HEAP_COUNT_MAX;					\
+    }else{								\
+      h->count *= 2;							\
+    }									\
+    h->pairs = realloc_perror(h->pairs, h->count, sizeof(name##_pair_t)); \
+  }									\
+									\
+  /* moves the pair at index i upwards, mapping each moved element */	\
+  static void name##_heapify_up(name##_t *h, size_t i){			\
+    size_t ju;								\
+    name##_pair_t p = h->pairs[i];					\
+    while (i > 0){							\
+      ju = (i - 1) >> 1;						\
+      if (p.pty < h->pairs[ju].pty){					\
+	h->pairs[i] = h->pairs[ju];					\
+	if (h->hht != NULL){						\
+	  h->hht->insert(h->hht->ht, &h->pairs[i].elt, &i);		\
+	}								\
+	i = ju;								\
+      }else{								\
+	break;								\
+      }									\
+    }									\
+    h->pairs[i] = p;							\
+    if (h->hht != NULL) h->hht->insert(h->hht->ht, &p.elt, &i);	\
+  }									\
+									\
+  /* moves the pair at index i downwards, mapping each moved element */ \
+  static void name##_heapify_down(name##_t *h, size_t i){		\
+    size_t j;								\
+    name##_pair_t p = h->pairs[i];					\
+    /* i has a left child iff i <= (num_elts - 2) / 2 */		\
+    while (h->num_elts > 1 && i <= (h->num_elts - 2) >> 1){		\
+      j = 2 * i + 1;							\
+      if (j + 1 < h->num_elts &&					\
+	  h->pairs[j + 1].pty < h->pairs[j].pty){			\
+	j++;								\
+      }									\
+      if (h->pairs[j].pty < p.pty){					\
+	h->pairs[i] = h->pairs[j];					\
+	if (h->hht != NULL){						\
+	  h->hht->insert(h->hht->ht, &h->pairs[i].elt, &i);		\
+	}								\
+	i = j;								\
+      }else{								\
+	break;								\
+      }									\
+    }									\
+    h->pairs[i] = p;							\
+    if (h->hht != NULL) h->hht->insert(h->hht->ht, &p.elt, &i);	\
+  }
+
+HEAP_SPEC_DEFINE(heap_uint, unsigned int)
+HEAP_SPEC_DEFINE(heap_ulong, unsigned long)
+HEAP_SPEC_DEFINE(heap_double, double)
+
+/**
+   Prints an error message and exits.
+*/
+static void fprintf_stderr_exit(const char *s, int line){
+  fprintf(stderr, "%s in %s at line %d\n", s,  __FILE__, line);
+  exit(EXIT_FAILURE);
+}
@@ -0,0 +1,90 @@
+/**
+   heap-spec.h
+
+   Struct declarations and declarations of accessible functions of
+   dynamically allocated (min) heaps with a hash table parameter that are
+   specialized at compile time for a priority type and size_t elements
+   (e.g. vertices).
+
+   A specialized heap provides the init, push, search, update, pop, and
+   free operations of the generic heap in heap.h, with the same hash table
+   parameter and the same semantics, but without the cmp_pty indirection
+   and without memcpy calls of pair_size bytes: priority values are
+   compared with the < operator and priority-element pairs are moved
+   with struct assignments, which are inlined by a compiler into loads
+   and stores.
+
+   HEAP_SPEC_DECLARE(name, pty_type) declares a heap type name##_t and its
+   operations name##_{init, push, search, update, pop, free}, and
+   HEAP_SPEC_DEFINE(name, pty_type) in heap-spec.c defines the operations.
+   The heaps with unsigned int, unsigned long, and double priority values
+   are instantiated as heap_uint_t, heap_ulong_t, and heap_double_t. A
+   priority type is a basic type that is totally ordered by the < operator
+   (e.g. a floating point type without NaN values).
+
+   The implementation does not use stdint.h and is portable under C89/C90
+   and C99.
+*/
+
+#ifndef HEAP_SPEC_H
+#define HEAP_SPEC_H
+
+#include <stddef.h>
+#include "heap.h"
+
+#define HEAP_SPEC_DECLARE(name, pty_type)				\
+									\
+  typedef struct{							\
+    pty_type pty;							\
+    size_t elt;								\
+  } name##_pair_t;							\
+									\
+  typedef struct{							\
+    size_t count;							\
+    size_t num_elts;							\
+    name##_pair_t *pairs;						\
+    const heap_ht_t *hht;						\
+  } name##_t;								\
+									\
+  void name##_init(name##_t *h, size_t init_count, const heap_ht_t *hht); \
+  void name##_push(name##_t *h, const pty_type *pty, const size_t *elt); \
+  pty_type *name##_search(const name##_t *h, const size_t *elt);	\
+  void name##_update(name##_t *h, const pty_type *pty, const size_t *elt); \
+  void name##_pop(name##_t *h, pty_type *pty, size_t *elt);		\
+  void name##_free(name##_t *h)
+
+/**
+   Initializes a heap.
+   h           : pointer to a preallocated block of size sizeof(name##_t)
+   init_count  : > 0
+   hht         : - a non-NULL pointer to a set of parameters specifying a
+                 hash table for in-heap search and modifications; a hash
+                 key is a size_t element
+                 - NULL, if a heap is used without a hash table (e.g. with
+                 lazy deletion of stale elements after popping); then an
+                 element may be pushed more than once with different
+                 priority values, and search and update are not called
+
+   Pushes an element not in a heap and an associated priority value, if a
+   hash table is used.
+
+   Returns a pointer to the priority value of an element in a heap or NULL
+   if the element is not in the heap. The returned pointer is guaranteed to
+   point to the current priority value until another heap operation is
+   performed. Not called on a heap initialized without a hash table.
+
+   Updates the priority value of an element that is in a heap. Not called
+   on a heap initialized without a hash table.
+
+   Pops an element associated with a minimal priority value in a heap. If
+   the heap is empty, the memory blocks pointed to by elt and pty remain
+   unchanged.
+
+   Frees a heap and leaves a block of size sizeof(name##_t) pointed to by
+   an argument passed as the h parameter.
+*/
+HEAP_SPEC_DECLARE(heap_uint, unsigned int);
+HEAP_SPEC_DECLARE(heap_ulong, unsigned long);
+HEAP_SPEC_DECLARE(heap_double, double);
+
+#endif
@@ -16,6 +16,10 @@
       [0, 1] : on/off update search division hash table test
       [0, 1] : on/off push pop free multiplication hash table test
       [0, 1] : on/off update search multiplication hash table test
+      [0, 1] : on/off dary test
+      [0, 1] : on/off no ht test
+      [0, 1] : on/off batch test
+      [0, 1] : on/off stats test
 
    usage examples:
    ./heap-test
@@ -61,9 +65,13 @@ const char *C_USAGE =
   "[0, 1] : on/off push pop free division hash table test\n"
   "[0, 1] : on/off update search division hash table test\n"
   "[0, 1] : on/off push pop free multiplication hash table test\n"
-  "[0, 1] : on/off update search multiplication hash table test\n";
-const int C_ARGC_MAX = 10;
-const size_t C_ARGS_DEF[9] = {14, 1, 0, 341, 10, 1, 1, 1, 1};
+  "[0, 1] : on/off update search multiplication hash table test\n"
+  "[0, 1] : on/off dary test\n"
+  "[0, 1] : on/off no ht test\n"
+  "[0, 1] : on/off batch test\n"
+  "[0, 1] : on/off stats test\n";
+const int C_ARGC_MAX = 14;
+const size_t C_ARGS_DEF[13] = {14, 1, 0, 341, 10, 1, 1, 1, 1, 1, 1, 1, 1};
 const size_t C_FULL_BIT = CHAR_BIT * sizeof(size_t);
 
 /* tests */
@@ -87,8 +95,11 @@ void (*const C_NEW_PTY_ARR[3])(void *, size_t) = {new_uint,
 						  new_double,
 						  new_long_double};
 const size_t C_H_INIT_COUNT = 1;
+const int C_LOG_DEGS_COUNT = 3;
+const size_t C_LOG_DEGS[3] = {1, 2, 3}; /* binary, 4-ary, 8-ary */
 
 void push_pop_free(size_t num_ins,
+		   size_t log_deg,
 		   size_t pty_size,
 		   size_t elt_size,
 		   const heap_ht_t *hht,
@@ -98,6 +109,7 @@ void push_pop_free(size_t num_ins,
 		   void (*new_elt)(void *, size_t),
 		   void (*free_elt)(void *));
 void update_search(size_t num_ins,
+		   size_t log_deg,
 		   size_t pty_size,
 		   size_t elt_size,
 		   const heap_ht_t *hht,
@@ -106,6 +118,21 @@ void update_search(size_t num_ins,
 		   void (*new_pty)(void *, size_t),
 		   void (*new_elt)(void *, size_t),
 		   void (*free_elt)(void *));
+void build_push_batch(size_t num_ins,
+		      size_t log_deg,
+		      size_t pty_size,
+		      size_t elt_size,
+		      const heap_ht_t *hht,
+		      int (*cmp_pty)(const void *, const void *),
+		      int (*cmp_elt)(const void *, const void *),
+		      void (*new_pty)(void *, size_t),
+		      void (*new_elt)(void *, size_t));
+void update_search_dense_ix(size_t num_ins,
+			    size_t log_deg,
+			    size_t pty_size,
+			    int (*cmp_pty)(const void *, const void *),
+			    void (*new_pty)(void *, size_t));
+void stats(size_t num_ins, size_t log_deg, const heap_ht_t *hht);
 void *ptr(const void *block, size_t i, size_t size);
 void print_test_result(int res);
 
@@ -188,6 +215,8 @@ void ht_divchn_init_helper(ht_divchn_t *ht,
 		 0,
 		 c->alpha_n,
 		 c->log_alpha_d,
+		 NULL,
+		 NULL,
 		 free_elt);
 }
 
@@ -203,6 +232,7 @@ void ht_muloa_init_helper(ht_muloa_t *ht,
 		0,
 		c->alpha_n,
 		c->log_alpha_d,
+		NULL,
 		c->rdc_key,
 		free_elt);
 }
@@ -238,6 +268,7 @@ void run_push_pop_free_divchn_uint_test(size_t log_ins,
 	   TOLU(n),
 	   (float)alpha_n / pow_two_perror(log_alpha_d), C_PTY_TYPES[i]);
     push_pop_free(n,
+		  C_LOG_DEGS[0],
 		  C_PTY_SIZES[i],
 		  sizeof(size_t),
 		  &hht,
@@ -280,6 +311,7 @@ void run_update_search_divchn_uint_test(size_t log_ins,
 	   TOLU(n),
 	   (float)alpha_n / pow_two_perror(log_alpha_d), C_PTY_TYPES[i]);
     update_search(n,
+		  C_LOG_DEGS[0],
 		  C_PTY_SIZES[i],
 		  sizeof(size_t),
 		  &hht,
@@ -324,6 +356,7 @@ void run_push_pop_free_muloa_uint_test(size_t log_ins,
 	   (float)alpha_n / pow_two_perror(log_alpha_d),
 	   C_PTY_TYPES[i]);
     push_pop_free(n,
+		  C_LOG_DEGS[0],
 		  C_PTY_SIZES[i],
 		  sizeof(size_t),
 		  &hht,
@@ -368,6 +401,7 @@ void run_update_search_muloa_uint_test(size_t log_ins,
 	   (float)alpha_n / pow_two_perror(log_alpha_d),
 	   C_PTY_TYPES[i]);
     update_search(n,
+		  C_LOG_DEGS[0],
 		  C_PTY_SIZES[i],
 		  sizeof(size_t),
 		  &hht,
@@ -379,6 +413,200 @@ void run_update_search_muloa_uint_test(size_t log_ins,
   }
 }
 
+/**
+   Runs heap_{push, pop, free} and heap_{update, search} tests on d-ary
+   heaps with a ht_muloa_t hash table on size_t elements across priority
+   types.
+*/
+void run_dary_muloa_uint_test(size_t log_ins,
+			      size_t alpha_n,
+			      size_t log_alpha_d){
+  int i, j;
+  size_t n;
+  ht_muloa_t ht_muloa;
+  ht_muloa_context_t context;
+  heap_ht_t hht;
+  n = pow_two_perror(log_ins);
+  context.alpha_n = alpha_n;
+  context.log_alpha_d = log_alpha_d;
+  context.rdc_key = NULL;
+  hht.ht = &ht_muloa;
+  hht.context = &context;
+  hht.init = (heap_ht_init)ht_muloa_init_helper;
+  hht.insert = (heap_ht_insert)ht_muloa_insert;
+  hht.search = (heap_ht_search)ht_muloa_search;
+  hht.remove = (heap_ht_remove)ht_muloa_remove;
+  hht.free = (heap_ht_free)ht_muloa_free;
+  for (j = 1; j < C_LOG_DEGS_COUNT; j++){
+    printf("Run heap_{push, pop, free} and heap_{update, search} tests on "
+	   "a %lu-ary heap with a ht_muloa_t hash table on size_t "
+	   "elements\n", TOLU(pow_two_perror(C_LOG_DEGS[j])));
+    for (i = 0; i < C_PTY_TYPES_COUNT; i++){
+      printf("\tnumber of elements:      %lu\n"
+	     "\tload factor upper bound: %.4f\n"
+	     "\tpriority type:           %s\n",
+	     TOLU(n),
+	     (float)alpha_n / pow_two_perror(log_alpha_d),
+	     C_PTY_TYPES[i]);
+      push_pop_free(n,
+		    C_LOG_DEGS[j],
+		    C_PTY_SIZES[i],
+		    sizeof(size_t),
+		    &hht,
+		    C_CMP_PTY_ARR[i],
+		    cmp_uint,
+		    C_NEW_PTY_ARR[i],
+		    new_uint,
+		    NULL);
+      update_search(n,
+		    C_LOG_DEGS[j],
+		    C_PTY_SIZES[i],
+		    sizeof(size_t),
+		    &hht,
+		    C_CMP_PTY_ARR[i],
+		    cmp_uint,
+		    C_NEW_PTY_ARR[i],
+		    new_uint,
+		    NULL);
+    }
+  }
+}
+
+/**
+   Run a heap_{push, pop, free} test without a hash table, and a
+   heap_{update, search} test in the dense index mode, on binary and d-ary
+   heaps with size_t elements across priority types.
+*/
+void run_push_pop_free_no_ht_uint_test(size_t log_ins){
+  int i, j;
+  size_t n;
+  n = pow_two_perror(log_ins);
+  for (j = 0; j < C_LOG_DEGS_COUNT; j++){
+    printf("Run a heap_{push, pop, free} test without a hash table on "
+	   "a %lu-ary heap with size_t elements\n",
+	   TOLU(pow_two_perror(C_LOG_DEGS[j])));
+    for (i = 0; i < C_PTY_TYPES_COUNT; i++){
+      printf("\tnumber of elements:      %lu\n"
+	     "\tpriority type:           %s\n",
+	     TOLU(n),
+	     C_PTY_TYPES[i]);
+      push_pop_free(n,
+		    C_LOG_DEGS[j],
+		    C_PTY_SIZES[i],
+		    sizeof(size_t),
+		    NULL,
+		    C_CMP_PTY_ARR[i],
+		    cmp_uint,
+		    C_NEW_PTY_ARR[i],
+		    new_uint,
+		    NULL);
+      printf("\t\tdense index mode:\n");
+      update_search_dense_ix(n,
+			     C_LOG_DEGS[j],
+			     C_PTY_SIZES[i],
+			     C_CMP_PTY_ARR[i],
+			     C_NEW_PTY_ARR[i]);
+    }
+  }
+}
+
+/**
+   Run heap_{build, push_batch} tests with a ht_muloa_t hash table and
+   without a hash table on binary and d-ary heaps with size_t elements
+   across priority types.
+*/
+void run_build_muloa_uint_test(size_t log_ins,
+			       size_t alpha_n,
+			       size_t log_alpha_d){
+  int i, j;
+  size_t n;
+  ht_muloa_t ht_muloa;
+  ht_muloa_context_t context;
+  heap_ht_t hht;
+  n = pow_two_perror(log_ins);
+  context.alpha_n = alpha_n;
+  context.log_alpha_d = log_alpha_d;
+  context.rdc_key = NULL;
+  hht.ht = &ht_muloa;
+  hht.context = &context;
+  hht.init = (heap_ht_init)ht_muloa_init_helper;
+  hht.insert = (heap_ht_insert)ht_muloa_insert;
+  hht.search = (heap_ht_search)ht_muloa_search;
+  hht.remove = (heap_ht_remove)ht_muloa_remove;
+  hht.free = (heap_ht_free)ht_muloa_free;
+  for (j = 0; j < C_LOG_DEGS_COUNT; j++){
+    printf("Run heap_{build, push_batch} tests on a %lu-ary heap with "
+	   "a ht_muloa_t hash table and without a hash table on size_t "
+	   "elements\n", TOLU(pow_two_perror(C_LOG_DEGS[j])));
+    for (i = 0; i < C_PTY_TYPES_COUNT; i++){
+      printf("\tnumber of elements:      %lu\n"
+	     "\tload factor upper bound: %.4f\n"
+	     "\tpriority type:           %s\n",
+	     TOLU(n),
+	     (float)alpha_n / pow_two_perror(log_alpha_d),
+	     C_PTY_TYPES[i]);
+      build_push_batch(n,
+		       C_LOG_DEGS[j],
+		       C_PTY_SIZES[i],
+		       sizeof(size_t),
+		       &hht,
+		       C_CMP_PTY_ARR[i],
+		       cmp_uint,
+		       C_NEW_PTY_ARR[i],
+		       new_uint);
+      printf("\t\twithout a hash table:\n");
+      build_push_batch(n,
+		       C_LOG_DEGS[j],
+		       C_PTY_SIZES[i],
+		       sizeof(size_t),
+		       NULL,
+		       C_CMP_PTY_ARR[i],
+		       cmp_uint,
+		       C_NEW_PTY_ARR[i],
+		       new_uint);
+    }
+  }
+}
+
+/**
+   Run a test of the heap_{count_stats, stats} counters with a ht_muloa_t
+   hash table and without a hash table on binary and d-ary heaps with
+   size_t elements and size_t priority values.
+*/
+void run_stats_muloa_uint_test(size_t log_ins,
+			       size_t alpha_n,
+			       size_t log_alpha_d){
+  int j;
+  size_t n;
+  ht_muloa_t ht_muloa;
+  ht_muloa_context_t context;
+  heap_ht_t hht;
+  n = pow_two_perror(log_ins);
+  context.alpha_n = alpha_n;
+  context.log_alpha_d = log_alpha_d;
+  context.rdc_key = NULL;
+  hht.ht = &ht_muloa;
+  hht.context = &context;
+  hht.init = (heap_ht_init)ht_muloa_init_helper;
+  hht.insert = (heap_ht_insert)ht_muloa_insert;
+  hht.search = (heap_ht_search)ht_muloa_search;
+  hht.remove = (heap_ht_remove)ht_muloa_remove;
+  hht.free = (heap_ht_free)ht_muloa_free;
+  for (j = 0; j < C_LOG_DEGS_COUNT; j++){
+    printf("Run heap_{count_stats, stats} test on a %lu-ary heap with "
+	   "a ht_muloa_t hash table and without a hash table on size_t "
+	   "elements\n", TOLU(pow_two_perror(C_LOG_DEGS[j])));
+    printf("\tnumber of elements:      %lu\n"
+	   "\tload factor upper bound: %.4f\n"
+	   "\tpriority type:           size_t\n",
+	   TOLU(n),
+	   (float)alpha_n / pow_two_perror(log_alpha_d));
+    stats(n, C_LOG_DEGS[j], &hht);
+    printf("\t\twithout a hash table:\n");
+    stats(n, C_LOG_DEGS[j], NULL);
+  }
+}
+
 /**
    Run heap_{push, pop, free} and heap_{update, search} tests with division-
    and mutliplication-based hash tables on noncontiguous uint_ptr_t
@@ -449,6 +677,7 @@ void run_push_pop_free_divchn_uint_ptr_test(size_t log_ins,
 	   TOLU(n),
 	   (float)alpha_n / pow_two_perror(log_alpha_d), C_PTY_TYPES[i]);
     push_pop_free(n,
+		  C_LOG_DEGS[0],
 		  C_PTY_SIZES[i],
 		  sizeof(uint_ptr_t *),
 		  &hht,
@@ -491,6 +720,7 @@ void run_update_search_divchn_uint_ptr_test(size_t log_ins,
 	   TOLU(n),
 	   (float)alpha_n / pow_two_perror(log_alpha_d), C_PTY_TYPES[i]);
     update_search(n,
+		  C_LOG_DEGS[0],
 		  C_PTY_SIZES[i],
 		  sizeof(uint_ptr_t *),
 		  &hht,
@@ -535,6 +765,7 @@ void run_push_pop_free_muloa_uint_ptr_test(size_t log_ins,
 	   (float)alpha_n / pow_two_perror(log_alpha_d),
 	   C_PTY_TYPES[i]);
     push_pop_free(n,
+		  C_LOG_DEGS[0],
 		  C_PTY_SIZES[i],
 		  sizeof(uint_ptr_t *),
 		  &hht,
@@ -561,6 +792,7 @@ void run_update_search_muloa_uint_ptr_test(size_t log_ins,
   n = pow_two_perror(log_ins);
   context.alpha_n = alpha_n;
   context.log_alpha_d = log_alpha_d;
+  context.rdc_key = NULL;
   hht.ht = &ht_muloa;
   hht.context = &context;
   hht.init = (heap_ht_init)ht_muloa_init_helper;
@@ -578,6 +810,7 @@ void run_update_search_muloa_uint_ptr_test(size_t log_ins,
 	   (float)alpha_n / pow_two_perror(log_alpha_d),
 	   C_PTY_TYPES[i]);
     update_search(n,
+		  C_LOG_DEGS[0],
 		  C_PTY_SIZES[i],
 		  sizeof(uint_ptr_t *),
 		  &hht,
@@ -791,6 +1024,7 @@ void search_ptys_elts(const heap_t *h,
 */
 
 void push_pop_free(size_t num_ins,
+		   size_t log_deg,
 		   size_t pty_size,
 		   size_t elt_size,
 		   const heap_ht_t *hht,
@@ -811,6 +1045,7 @@ void push_pop_free(size_t num_ins,
     new_elt((char *)ptr(pty_elts, i, pair_size) + pty_size, i);
   }
   heap_init(&h, C_H_INIT_COUNT, pty_size, elt_size, hht, cmp_pty, free_elt);
+  heap_dary(&h, log_deg);
   push_ptys_elts(&h, pty_elts, num_ins, &res);
   pop_ptys_elts(&h, pty_elts, num_ins, cmp_pty, cmp_elt, &res);
   push_rev_ptys_elts(&h, pty_elts, num_ins, &res);
@@ -824,6 +1059,7 @@ void push_pop_free(size_t num_ins,
 }
 
 void update_search(size_t num_ins,
+		   size_t log_deg,
 		   size_t pty_size,
 		   size_t elt_size,
 		   const heap_ht_t *hht,
@@ -853,6 +1089,8 @@ void update_search(size_t num_ins,
 	   elt_size);
   }
   heap_init(&h, C_H_INIT_COUNT, pty_size, elt_size, hht, cmp_pty, free_elt);
+  heap_huge_page(&h);
+  heap_dary(&h, log_deg);
   push_ptys_elts(&h, pty_rev_elts, num_ins, &res);
   update_ptys_elts(&h, pty_elts, num_ins, &res);
   search_ptys_elts(&h, pty_elts, not_heap_elts, num_ins, &res);
@@ -874,6 +1112,189 @@ void update_search(size_t num_ins,
   not_heap_elts = NULL;
 }
 
+/**
+   Runs heap_build and heap_push_batch on elements in the reverse
+   priority order, along the bulk and per-element paths of
+   heap_push_batch, and tests the order of popped elements and, if a
+   hash table is used, the in-heap search.
+*/
+void build_push_batch(size_t num_ins,
+		      size_t log_deg,
+		      size_t pty_size,
+		      size_t elt_size,
+		      const heap_ht_t *hht,
+		      int (*cmp_pty)(const void *, const void *),
+		      int (*cmp_elt)(const void *, const void *),
+		      void (*new_pty)(void *, size_t),
+		      void (*new_elt)(void *, size_t)){
+  int res = 1;
+  size_t i, half_count;
+  size_t pair_size = add_sz_perror(pty_size, elt_size);
+  void *pty_elts = NULL, *not_heap_elts = NULL;
+  void *ptys = NULL, *elts = NULL;
+  heap_t h;
+  clock_t t_build, t_batch;
+  /* num_ins > 0 */
+  half_count = num_ins >> 1;
+  pty_elts = malloc_perror(num_ins, pair_size);
+  not_heap_elts = malloc_perror(num_ins, elt_size);
+  ptys = malloc_perror(num_ins, pty_size);
+  elts = malloc_perror(num_ins, elt_size);
+  for (i = 0; i < num_ins; i++){
+    new_pty(ptr(pty_elts, i, pair_size), i); /* no decrease with i */
+    new_elt((char *)ptr(pty_elts, i, pair_size) + pty_size, i);
+    new_elt(ptr(not_heap_elts, i, elt_size), num_ins + i);
+    new_pty(ptr(ptys, num_ins - 1 - i, pty_size), i);
+    new_elt(ptr(elts, num_ins - 1 - i, elt_size), i);
+  }
+  heap_init(&h, C_H_INIT_COUNT, pty_size, elt_size, hht, cmp_pty, NULL);
+  heap_dary(&h, log_deg);
+  t_build = clock();
+  heap_build(&h, ptys, elts, half_count);
+  t_build = clock() - t_build;
+  t_batch = clock();
+  heap_push_batch(&h,
+		  ptr(ptys, half_count, pty_size),
+		  ptr(elts, half_count, elt_size),
+		  num_ins - half_count);
+  t_batch = clock() - t_batch;
+  printf("\t\tbuild 1/2 elements:                          "
+	 "%.4f seconds\n", (float)t_build / CLOCKS_PER_SEC);
+  printf("\t\tpush batch of residual elements:             "
+	 "%.4f seconds\n", (float)t_batch / CLOCKS_PER_SEC);
+  res *= (h.num_elts == num_ins);
+  if (hht != NULL){
+    search_ptys_elts(&h, pty_elts, not_heap_elts, num_ins, &res);
+  }
+  pop_ptys_elts(&h, pty_elts, num_ins, cmp_pty, cmp_elt, &res);
+  heap_push_batch(&h, ptys, elts, half_count);
+  for (i = half_count; i < num_ins; i++){
+    heap_push_batch(&h, ptr(ptys, i, pty_size), ptr(elts, i, elt_size), 1);
+  }
+  res *= (h.num_elts == num_ins);
+  pop_ptys_elts(&h, pty_elts, num_ins, cmp_pty, cmp_elt, &res);
+  free_heap(&h);
+  printf("\t\torder correctness:                           ");
+  print_test_result(res);
+  free(pty_elts);
+  free(not_heap_elts);
+  free(ptys);
+  free(elts);
+  pty_elts = NULL;
+  not_heap_elts = NULL;
+  ptys = NULL;
+  elts = NULL;
+}
+
+/**
+   Runs a heap_{update, search} test on a heap in the dense index mode with
+   size_t elements in [0, num_ins) and a position array of 2 * num_ins
+   indices, where the elements in [num_ins, 2 * num_ins) are not pushed.
+*/
+void update_search_dense_ix(size_t num_ins,
+			    size_t log_deg,
+			    size_t pty_size,
+			    int (*cmp_pty)(const void *, const void *),
+			    void (*new_pty)(void *, size_t)){
+  int res = 1;
+  size_t i;
+  size_t elt_size = sizeof(size_t);
+  size_t pair_size = add_sz_perror(pty_size, elt_size);
+  void *pty_elts = NULL, *pty_rev_elts = NULL, *not_heap_elts = NULL;
+  heap_t h;
+  /* num_ins > 0 */
+  pty_elts = malloc_perror(num_ins, pair_size);
+  pty_rev_elts = malloc_perror(num_ins, pair_size);
+  not_heap_elts = malloc_perror(num_ins, elt_size);
+  for (i = 0; i < num_ins; i++){
+    new_pty(ptr(pty_elts, i, pair_size), i);  /* no decrease with i */
+    new_uint((char *)ptr(pty_elts, i, pair_size) + pty_size, i);
+    new_uint(ptr(not_heap_elts, i, elt_size), num_ins + i);
+  }
+  for (i = 0; i < num_ins; i++){
+    new_pty(ptr(pty_rev_elts, i, pair_size), i);  /* no decrease with i */
+    memcpy((char *)ptr(pty_rev_elts, i, pair_size) + pty_size,
+	   (char *)ptr(pty_elts, num_ins - 1 - i, pair_size) + pty_size,
+	   elt_size);
+  }
+  heap_init(&h, C_H_INIT_COUNT, pty_size, elt_size, NULL, cmp_pty, NULL);
+  heap_dary(&h, log_deg);
+  heap_dense_ix(&h, mul_sz_perror(2, num_ins));
+  push_ptys_elts(&h, pty_rev_elts, num_ins, &res);
+  update_ptys_elts(&h, pty_elts, num_ins, &res);
+  search_ptys_elts(&h, pty_elts, not_heap_elts, num_ins, &res);
+  pop_ptys_elts(&h, pty_elts, num_ins, cmp_pty, cmp_uint, &res);
+  free_heap(&h);
+  printf("\t\torder correctness:                           ");
+  print_test_result(res);
+  free(pty_elts);
+  free(pty_rev_elts);
+  free(not_heap_elts);
+  pty_elts = NULL;
+  pty_rev_elts = NULL;
+  not_heap_elts = NULL;
+}
+
+/**
+   Pushes num_ins elements with random priority values into a heap with
+   counted operations, searches each element if a hash table is used,
+   pops all elements, and tests and prints the counters.
+*/
+void stats(size_t num_ins, size_t log_deg, const heap_ht_t *hht){
+  int res = 1;
+  size_t i, pty, elt, num_grows = 0, count = C_H_INIT_COUNT;
+  heap_stats_t st;
+  heap_t h;
+  heap_init(&h, C_H_INIT_COUNT, sizeof(size_t), sizeof(size_t), hht,
+	    cmp_uint, NULL);
+  heap_dary(&h, log_deg);
+  heap_count_stats(&h);
+  for (i = 0; i < num_ins; i++){
+    pty = rand();
+    heap_push(&h, &pty, &i);
+  }
+  if (hht != NULL){
+    for (i = 0; i < num_ins; i++){
+      res *= (heap_search(&h, &i) != NULL);
+    }
+  }
+  for (i = 0; i < num_ins; i++){
+    heap_pop(&h, &pty, &elt);
+  }
+  heap_stats(&h, &st);
+  heap_free(&h);
+  while (count < num_ins){
+    count *= 2;
+    num_grows++;
+  }
+  res *= (st.max_num_elts == num_ins && st.num_grows == num_grows);
+  if (hht != NULL){
+    res *= (st.num_ht_inserts >= num_ins &&
+	    st.num_ht_searches == num_ins &&
+	    st.num_ht_removes == num_ins);
+  }else{
+    res *= (st.num_ht_inserts == 0 &&
+	    st.num_ht_searches == 0 &&
+	    st.num_ht_removes == 0);
+  }
+  printf("\t\tcmp_pty calls:            %lu\n"
+	 "\t\tpair moves:               %lu\n"
+	 "\t\tht inserts:               %lu\n"
+	 "\t\tht searches:              %lu\n"
+	 "\t\tht removes:               %lu\n"
+	 "\t\tgrowth steps:             %lu\n"
+	 "\t\tpeak number of elements:  %lu\n",
+	 TOLU(st.num_cmps),
+	 TOLU(st.num_moves),
+	 TOLU(st.num_ht_inserts),
+	 TOLU(st.num_ht_searches),
+	 TOLU(st.num_ht_removes),
+	 TOLU(st.num_grows),
+	 TOLU(st.max_num_elts));
+  printf("\t\tcounter correctness:      ");
+  print_test_result(res);
+}
+
 /**
    Computes a pointer to the ith element in the block of elements.
 */
@@ -913,7 +1334,11 @@ int main(int argc, char *argv[]){
       args[5] > 1 ||
       args[6] > 1 ||
       args[7] > 1 ||
-      args[8] > 1){
+      args[8] > 1 ||
+      args[9] > 1 ||
+      args[10] > 1 ||
+      args[11] > 1 ||
+      args[12] > 1){
     fprintf(stderr, "USAGE:\n%s", C_USAGE);
     exit(EXIT_FAILURE);
   }
@@ -933,6 +1358,10 @@ int main(int argc, char *argv[]){
     run_update_search_muloa_uint_test(args[0], args[3], args[4]);
     run_update_search_muloa_uint_ptr_test(args[0], args[3], args[4]);
   }
+  if (args[9]) run_dary_muloa_uint_test(args[0], args[3], args[4]);
+  if (args[10]) run_push_pop_free_no_ht_uint_test(args[0]);
+  if (args[11]) run_build_muloa_uint_test(args[0], args[3], args[4]);
+  if (args[12]) run_stats_muloa_uint_test(args[0], args[3], args[4]);
   free(args);
   args = NULL;
   return 0;
@@ -34,12 +34,28 @@
 #include <string.h>
 #include "heap.h"
 #include "utilities-mem.h"
+#include "utilities-mem-huge.h"
+
+static const size_t C_NIL = (size_t)-1; /* not in heap as position */
+static const size_t C_CACHE_LINE_SIZE = 64; /* power of two */
 
 static void swap(heap_t *h, size_t i, size_t j);
 static void half_swap(heap_t *h, size_t t, size_t s);
 static void heap_grow(heap_t *h);
+static void pty_elts_new(heap_t *h);
+static void pty_elts_realloc(heap_t *h, size_t prev_count);
+static void pty_elts_free(heap_t *h);
+static void *align_ptr(void *p);
+static void copy_ptys_elts(heap_t *h,
+			   const void *ptys,
+			   const void *elts,
+			   size_t n);
+static void build(heap_t *h);
 static void heapify_up(heap_t *h, size_t i);
 static void heapify_down(heap_t *h, size_t i);
+static void heapify_down_dary(heap_t *h, size_t i);
+static void map_ix(const heap_t *h, size_t i);
+static int cmp(const heap_t *h, const void *a, const void *b);
 static void *pty_ptr(const heap_t *h, size_t i);
 static void *elt_ptr(const heap_t *h, size_t i);
 static void fprintf_stderr_exit(const char *s, int line);
@@ -54,10 +70,16 @@ static void fprintf_stderr_exit(const char *s, int line);
                  - size of a pointer to an element, if the element is within
                  a noncontiguous memory block or a pointer to a contiguous
                  element is inserted
-   hht         : a non-NULL pointer to a set of parameters specifying a
+   hht         : - a non-NULL pointer to a set of parameters specifying a
                  hash table for in-heap search and modifications; a hash
                  key has the size and bit pattern of the block of size
                  elt_size pointed to by elt in heap_push
+                 - NULL, if a heap is used without a hash table (e.g. with
+                 lazy deletion of stale elements after popping); then an
+                 element may be pushed more than once with different
+                 priority values, heap_search and heap_update are not
+                 called, and the hash table maintenance is avoided in all
+                 heap operations
    cmp_pty     : comparison function which returns a negative integer value
                  if the priority value pointed to by the first argument is
                  less than the priority value pointed to by the second, a
@@ -90,47 +112,191 @@ void heap_init(heap_t *h,
   h->pty_size = pty_size;
   h->elt_size = elt_size;
   h->pair_size = add_sz_perror(pty_size, elt_size);
-  h->pty_elts = malloc_perror(init_count, h->pair_size);
+  h->log_deg = 1;
+  h->ix_offset = 0;
+  h->huge_page = 0;
+  pty_elts_new(h);
   h->buf = malloc_perror(2, h->pair_size); /* 1st heapify, 2nd swap */
   h->hht = hht;
+  h->num_ixs = 0;
+  h->pos_ixs = NULL;
+  h->stats = NULL;
   h->cmp_pty = cmp_pty;
   h->free_elt = free_elt;
-  h->hht->init(hht->ht, elt_size, sizeof(size_t), NULL, hht->context);
+  if (hht != NULL){
+    h->hht->init(hht->ht, elt_size, sizeof(size_t), NULL, hht->context);
+  }
+}
+
+/**
+   Backs the priority-element array of a heap with huge pages if the array
+   is at least as large as a huge page and huge pages are available on a
+   given system, thereby reducing TLB misses in heap operations on a large
+   heap. Otherwise regular pages are used. The operation is optionally
+   called after heap_init is completed and before any other operation is
+   called.
+   h           : pointer to an initialized heap
+*/
+void heap_huge_page(heap_t *h){
+  pty_elts_free(h);
+  h->huge_page = 1;
+  pty_elts_new(h);
+}
+
+/**
+   Sets the number of children of a node in a heap to 2**log_deg (e.g. 4 or
+   8). The children of a node are contiguous in the priority-element array
+   and, due to an offset of 2**log_deg - 1 pairs before the root, begin at a
+   multiple of 2**log_deg * pair_size bytes from the start of the array,
+   which is aligned to 64 bytes. If pair_size is 16 bytes, the children of
+   a node in a 4-ary heap are within a 64-byte cache line, and the depth of
+   the heap is halved relative to a binary heap, which reduces cache misses
+   in heap_pop. The hash table parameter is maintained as in a binary heap.
+   The operation is optionally called after heap_init is completed and
+   before any other operation, except heap_huge_page, is called.
+   h           : pointer to an initialized heap
+   log_deg     : > 0 and < CHAR_BIT * sizeof(size_t) - 1; 1 for a binary
+                 heap (default), 2 for a 4-ary heap, and 3 for an 8-ary heap
+*/
+void heap_dary(heap_t *h, size_t log_deg){
+  pty_elts_free(h);
+  h->log_deg = log_deg;
+  h->ix_offset = ((size_t)1 << log_deg) - 1;
+  pty_elts_new(h);
+}
+
+/**
+   Sets a heap initialized without a hash table to the dense index mode,
+   where each element is a size_t index in the range [0, num_ixs) (e.g. a
+   vertex) and elt_size is sizeof(size_t). The position of each element in
+   the heap is maintained in a built-in array of num_ixs indices, which is
+   updated inline with each move of an element, without hash table calls.
+   In the dense index mode an element is pushed at most once until it is
+   popped, and heap_search and heap_update are called as with a hash
+   table. The operation is optionally called after heap_init is completed
+   with NULL as hht, and before any other operation, except heap_huge_page,
+   heap_dary, and heap_count_stats, is called.
+   h           : pointer to an initialized heap
+   num_ixs     : > 0 number of element indices
+*/
+void heap_dense_ix(heap_t *h, size_t num_ixs){
+  size_t i;
+  h->num_ixs = num_ixs;
+  h->pos_ixs = malloc_perror(num_ixs, sizeof(size_t));
+  for (i = 0; i < num_ixs; i++){
+    h->pos_ixs[i] = C_NIL;
+  }
+}
+
+/**
+   Enables the counting of cmp_pty calls, pair moves, hash table insert,
+   search, and remove calls, and reallocations of the priority-element
+   array, as well as the tracking of the peak number of elements in a
+   heap. If the operation is not called, only a NULL pointer test is
+   performed where a counter would be updated. The operation is optionally
+   called after heap_init is completed and before any other operation,
+   except heap_huge_page and heap_dary, is called.
+   h           : pointer to an initialized heap
+*/
+void heap_count_stats(heap_t *h){
+  h->stats = calloc_perror(1, sizeof(heap_stats_t));
+}
+
+/**
+   Copies the counters of a heap, on which heap_count_stats was called, to
+   a preallocated block of size sizeof(heap_stats_t) pointed to by the
+   stats parameter.
+*/
+void heap_stats(const heap_t *h, heap_stats_t *stats){
+  *stats = *h->stats;
 }
 
 /**
    Pushes an element not in a heap and an associated priority value. 
    Prior to pushing, the membership of an element can be tested, if 
    necessary, with heap_search in O(1) time in expectation under the
-   uniformity assumptions suitable for the used hash table.
+   uniformity assumptions suitable for the used hash table. If a heap
+   was initialized without a hash table, the element may be in the heap.
    h           : pointer to an initialized heap
    pty         : pointer to a block of size pty_size that is an object of
                  basic type (e.g. char, int, long, double)
    elt         : pointer to a block of size elt_size that is either a
                  contiguous element object or a pointer to a contiguous or
                  non-contiguous element; the block must have a unique
-                 bit pattern for each pushed element
+                 bit pattern for each pushed element if a hash table
+                 is used
 */
 void heap_push(heap_t *h, const void *pty, const void *elt){
   size_t ix = h->num_elts;
   if (h->count == ix) heap_grow(h);
   memcpy(pty_ptr(h, ix), pty, h->pty_size);
   memcpy(elt_ptr(h, ix), elt, h->elt_size);
-  h->hht->insert(h->hht->ht, elt, &ix);
   h->num_elts++;
+  if (h->stats != NULL && h->stats->max_num_elts < h->num_elts){
+    h->stats->max_num_elts = h->num_elts;
+  }
   heapify_up(h, ix);
 }
 
+/**
+   Builds a heap from n priority values and n elements in O(n) time by
+   bottom-up heapifying, instead of n heap_push operations in O(n log n)
+   time. The heap is empty prior to the operation. The hash table is
+   populated in one pass after the heap structure is built, and is not
+   updated during heapifying. If a hash table is used, each element is
+   not in the heap and has a unique bit pattern as specified in heap_push.
+   h           : pointer to an initialized empty heap
+   ptys        : pointer to an array of n contiguous priority objects, each
+                 of size pty_size
+   elts        : pointer to an array of n contiguous blocks, each of size
+                 elt_size, as specified for elt in heap_push
+   n           : number of priority values and elements
+*/
+void heap_build(heap_t *h, const void *ptys, const void *elts, size_t n){
+  copy_ptys_elts(h, ptys, elts, n);
+  build(h);
+}
+
+/**
+   Pushes n elements and their associated priority values. If n is greater
+   or equal to the number of elements in the heap, the heap is rebuilt
+   bottom-up in O(n) time and the hash table is populated in one pass.
+   Otherwise each element is heapified upwards in O(log n) time. Please
+   see the parameter specification in heap_build.
+*/
+void heap_push_batch(heap_t *h,
+		     const void *ptys,
+		     const void *elts,
+		     size_t n){
+  size_t i, m = h->num_elts;
+  copy_ptys_elts(h, ptys, elts, n);
+  if (n >= m){
+    build(h);
+  }else{
+    for (i = m; i < h->num_elts; i++){
+      heapify_up(h, i);
+    }
+  }
+}
+
 /** 
    Returns a pointer to the priority of an element in a heap or NULL if the
    element is not in the heap in O(1) time in expectation under the
    uniformity assumptions suitable for the used hash table. The returned
    pointer is guaranteed to point to the current priority value until another
-   heap operation is performed. Please see the parameter specification in
-   heap_push.
+   heap operation is performed. Not called on a heap initialized without
+   a hash table, unless the heap is in the dense index mode. Please see the
+   parameter specification in heap_push.
 */
 void *heap_search(const heap_t *h, const void *elt){
-  const size_t *ix_ptr = h->hht->search(h->hht->ht, elt);
+  const size_t *ix_ptr = NULL;
+  if (h->pos_ixs != NULL){
+    ix_ptr = &h->pos_ixs[*(const size_t *)elt];
+    if (*ix_ptr == C_NIL) ix_ptr = NULL;
+  }else{
+    ix_ptr = h->hht->search(h->hht->ht, elt);
+    if (h->stats != NULL) h->stats->num_ht_searches++;
+  }
   if (ix_ptr != NULL){
     return pty_ptr(h, *ix_ptr);
   }else{
@@ -142,11 +308,18 @@ void *heap_search(const heap_t *h, const void *elt){
    Updates the priority value of an element that is in a heap. Prior
    to updating, the membership of an element can be tested, if necessary, 
    with heap_search in O(1) time in expectation under the uniformity
-   assumptions suitable for the used hash table. Please see the parameter
-   specification in heap_push.
+   assumptions suitable for the used hash table. Not called on a heap
+   initialized without a hash table, unless the heap is in the dense
+   index mode. Please see the parameter specification in heap_push.
 */
 void heap_update(heap_t *h, const void *pty, const void *elt){
-  size_t ix = *(const size_t *)h->hht->search(h->hht->ht, elt);
+  size_t ix;
+  if (h->pos_ixs != NULL){
+    ix = h->pos_ixs[*(const size_t *)elt];
+  }else{
+    ix = *(const size_t *)h->hht->search(h->hht->ht, elt);
+    if (h->stats != NULL) h->stats->num_ht_searches++;
+  }
   memcpy(pty_ptr(h, ix), pty, h->pty_size);
   heapify_up(h, ix);
   heapify_down(h, ix);
@@ -164,11 +337,27 @@ void heap_pop(heap_t *h, void *pty, void *elt){
   memcpy(pty, pty_ptr(h, ix), h->pty_size);
   memcpy(elt, elt_ptr(h, ix), h->elt_size);
   swap(h, ix, h->num_elts - 1);
-  h->hht->remove(h->hht->ht, elt, &ix_buf);
+  if (h->pos_ixs != NULL){
+    h->pos_ixs[*(const size_t *)elt] = C_NIL;
+  }else if (h->hht != NULL){
+    h->hht->remove(h->hht->ht, elt, &ix_buf);
+    if (h->stats != NULL) h->stats->num_ht_removes++;
+  }
   h->num_elts--;
   if (h->num_elts > 0) heapify_down(h, ix);
 }
 
+/**
+   Returns a pointer to a minimal priority value in a heap according to
+   cmp_pty, or NULL if the heap is empty, without modifying the heap. The
+   returned pointer is guaranteed to point to the minimal priority value
+   until another heap operation is performed.
+*/
+void *heap_peek(const heap_t *h){
+  if (h->num_elts == 0) return NULL;
+  return pty_ptr(h, 0);
+}
+
 /**
    Frees a heap and leaves a block of size sizeof(heap_t) pointed to by
    an argument passed as the h parameter.
@@ -180,11 +369,14 @@ void heap_free(heap_t *h){
       h->free_elt(elt_ptr(h, i));
     } 
   }
-  free(h->pty_elts);
+  pty_elts_free(h);
   free(h->buf);
-  h->hht->free(h->hht->ht);
-  h->pty_elts = NULL;
+  free(h->pos_ixs);
+  free(h->stats);
+  if (h->hht != NULL) h->hht->free(h->hht->ht);
   h->buf = NULL;
+  h->pos_ixs = NULL;
+  h->stats = NULL;
 }
 
 /** Helper functions */
@@ -196,11 +388,12 @@ void heap_free(heap_t *h){
 static void swap(heap_t *h, size_t i, size_t j){
   void *buf = (char *)h->buf + h->pair_size; /* second subbuffer */
   if (i == j) return;
+  if (h->stats != NULL) h->stats->num_moves += 3;
   memcpy(buf, pty_ptr(h, i), h->pair_size);
   memcpy(pty_ptr(h, i), pty_ptr(h, j), h->pair_size);
   memcpy(pty_ptr(h, j), buf, h->pair_size);
-  h->hht->insert(h->hht->ht, elt_ptr(h, i), &i);
-  h->hht->insert(h->hht->ht, elt_ptr(h, j), &j);
+  map_ix(h, i);
+  map_ix(h, j);
 }
 
 /**
@@ -209,8 +402,9 @@ static void swap(heap_t *h, size_t i, size_t j){
 */
 static void half_swap(heap_t *h, size_t t, size_t s){
   if (s == t) return;
+  if (h->stats != NULL) h->stats->num_moves++;
   memcpy(pty_ptr(h, t), pty_ptr(h, s), h->pair_size);
-  h->hht->insert(h->hht->ht, elt_ptr(h, t), &t);
+  map_ix(h, t);
 }
 
 /**
@@ -219,6 +413,7 @@ static void half_swap(heap_t *h, size_t t, size_t s){
    search of the memory heap.
 */
 static void heap_grow(heap_t *h){
+  size_t prev_count = h->count;
   if (h->count == h->count_max){
     fprintf_stderr_exit("tried to exceed the count maximum", __LINE__);
   }
@@ -227,7 +422,117 @@ static void heap_grow(heap_t *h){
   }else{
     h->count *= 2;
   }
-  h->pty_elts = realloc_perror(h->pty_elts, h->count, h->pair_size);
+  if (h->stats != NULL) h->stats->num_grows++;
+  pty_elts_realloc(h, prev_count);
+}
+
+/**
+   Allocates, reallocates, and frees the priority-element array of a heap
+   with ix_offset pairs before the root and count pairs, according to
+   huge_page. The array is aligned to C_CACHE_LINE_SIZE bytes within a
+   block that is larger by C_CACHE_LINE_SIZE - 1 bytes, and is realigned
+   after the block is reallocated.
+*/
+
+static void pty_elts_new(heap_t *h){
+  size_t n = mul_sz_perror(add_sz_perror(h->count, h->ix_offset),
+			   h->pair_size);
+  n = add_sz_perror(n, C_CACHE_LINE_SIZE - 1);
+  if (h->huge_page){
+    h->pty_elts_block = malloc_huge_perror(n, 1);
+  }else{
+    h->pty_elts_block = malloc_perror(n, 1);
+  }
+  h->pty_elts = align_ptr(h->pty_elts_block);
+}
+
+static void pty_elts_realloc(heap_t *h, size_t prev_count){
+  size_t n, prev_n, prev_shift;
+  char *prev_pty_elts = NULL;
+  n = mul_sz_perror(add_sz_perror(h->count, h->ix_offset), h->pair_size);
+  n = add_sz_perror(n, C_CACHE_LINE_SIZE - 1);
+  prev_n = (prev_count + h->ix_offset) * h->pair_size;
+  prev_shift = (char *)h->pty_elts - (char *)h->pty_elts_block;
+  if (h->huge_page){
+    h->pty_elts_block = realloc_huge_perror(h->pty_elts_block, n, 1);
+  }else{
+    h->pty_elts_block = realloc_perror(h->pty_elts_block, n, 1);
+  }
+  prev_pty_elts = (char *)h->pty_elts_block + prev_shift;
+  h->pty_elts = align_ptr(h->pty_elts_block);
+  if (h->pty_elts != prev_pty_elts){
+    memmove(h->pty_elts, prev_pty_elts, prev_n);
+  }
+}
+
+static void pty_elts_free(heap_t *h){
+  if (h->huge_page){
+    free_huge(h->pty_elts_block);
+  }else{
+    free(h->pty_elts_block);
+  }
+  h->pty_elts_block = NULL;
+  h->pty_elts = NULL;
+}
+
+/**
+   Returns the lowest address at or above p that is a multiple of
+   C_CACHE_LINE_SIZE.
+*/
+static void *align_ptr(void *p){
+  size_t rem = (size_t)((unsigned long)p & (C_CACHE_LINE_SIZE - 1));
+  return (char *)p + ((C_CACHE_LINE_SIZE - rem) & (C_CACHE_LINE_SIZE - 1));
+}
+
+/**
+   Copies n priority values and elements after the last element of a heap,
+   growing the heap if necessary, without heapifying.
+*/
+static void copy_ptys_elts(heap_t *h,
+			   const void *ptys,
+			   const void *elts,
+			   size_t n){
+  size_t i;
+  while (h->count - h->num_elts < n) heap_grow(h);
+  for (i = 0; i < n; i++){
+    memcpy(pty_ptr(h, h->num_elts + i),
+	   (const char *)ptys + i * h->pty_size,
+	   h->pty_size);
+    memcpy(elt_ptr(h, h->num_elts + i),
+	   (const char *)elts + i * h->elt_size,
+	   h->elt_size);
+  }
+  h->num_elts += n;
+  if (h->stats != NULL && h->stats->max_num_elts < h->num_elts){
+    h->stats->max_num_elts = h->num_elts;
+  }
+}
+
+/**
+   Heapifies all elements of a heap bottom-up in O(num_elts) time, and
+   maps each element to its index in the hash table in one pass after
+   heapifying.
+*/
+static void build(heap_t *h){
+  size_t i;
+  size_t *pos_ixs = h->pos_ixs;
+  const heap_ht_t *hht = h->hht;
+  if (h->num_elts > 1){
+    /* no hash table and position updates during heapifying */
+    h->hht = NULL;
+    h->pos_ixs = NULL;
+    i = ((h->num_elts - 2) >> h->log_deg) + 1; /* last parent + 1 */
+    while (i-- > 0){
+      heapify_down(h, i);
+    }
+    h->hht = hht;
+    h->pos_ixs = pos_ixs;
+  }
+  if (h->hht != NULL || h->pos_ixs != NULL){
+    for (i = 0; i < h->num_elts; i++){
+      map_ix(h, i);
+    }
+  }
 }
 
 /**
@@ -237,8 +542,8 @@ static void heapify_up(heap_t *h, size_t i){
   size_t ju;
   memcpy(h->buf, pty_ptr(h, i), h->pair_size);
   while(i > 0){
-    ju = (i - 1) >> 1; /* divide by 2 */;
-    if (h->cmp_pty(pty_ptr(h, ju), h->buf) > 0){
+    ju = (i - 1) >> h->log_deg; /* divide by 2**log_deg */
+    if (cmp(h, pty_ptr(h, ju), h->buf) > 0){
       half_swap(h, i, ju);
       i = ju;
     }else{
@@ -246,7 +551,7 @@ static void heapify_up(heap_t *h, size_t i){
     }
   }
   memcpy(pty_ptr(h, i), h->buf, h->pair_size);
-  h->hht->insert(h->hht->ht, elt_ptr(h, i), &i);
+  map_ix(h, i);
 }
 
 /**
@@ -255,17 +560,21 @@ static void heapify_up(heap_t *h, size_t i){
 */
 static void heapify_down(heap_t *h, size_t i){
   size_t jl, jr;
+  if (h->log_deg > 1){
+    heapify_down_dary(h, i);
+    return;
+  }
   memcpy(h->buf, pty_ptr(h, i), h->pair_size);
   /* 0 <= i <= num_elts - 1 <= SIZE_MAX - 2 */
   while (i + 2 <= h->num_elts - 1 - i){
     /* both next left and next right indices have elements */
     jl = 2 * i + 1;
     jr = 2 * i + 2;
-    if (h->cmp_pty(h->buf, pty_ptr(h, jl)) > 0 &&
-	h->cmp_pty(pty_ptr(h, jl), pty_ptr(h, jr)) <= 0){
+    if (cmp(h, h->buf, pty_ptr(h, jl)) > 0 &&
+	cmp(h, pty_ptr(h, jl), pty_ptr(h, jr)) <= 0){
       half_swap(h, i, jl);
       i = jl;
-    }else if (h->cmp_pty(h->buf, pty_ptr(h, jr)) > 0){
+    }else if (cmp(h, h->buf, pty_ptr(h, jr)) > 0){
       /* jr has min pty relative to jl and the ith pty is greater */
       half_swap(h, i, jr);
       i = jr;
@@ -275,27 +584,86 @@ static void heapify_down(heap_t *h, size_t i){
   }
   if (i + 1 == h->num_elts - 1 - i){
     jl = 2 * i + 1;
-    if (h->cmp_pty(h->buf, pty_ptr(h, jl)) > 0){
+    if (cmp(h, h->buf, pty_ptr(h, jl)) > 0){
       half_swap(h, i, jl);
       i = jl;
     }
   }
   memcpy(pty_ptr(h, i), h->buf, h->pair_size);
-  h->hht->insert(h->hht->ht, elt_ptr(h, i), &i);
+  map_ix(h, i);
+}
+
+/**
+   Heapifies the heap structure with at least one element and more than
+   two children per node from the ith element downwards. The children of
+   the ith element are at indices 2**log_deg * i + 1 to 2**log_deg * i +
+   2**log_deg, and are contiguous in memory.
+*/
+static void heapify_down_dary(heap_t *h, size_t i){
+  size_t j, jmin, jlast;
+  memcpy(h->buf, pty_ptr(h, i), h->pair_size);
+  /* 0 <= i <= num_elts - 1 <= SIZE_MAX - 2 */
+  while (h->num_elts > 1 && i <= (h->num_elts - 2) >> h->log_deg){
+    /* the first child index j has an element */
+    j = (i << h->log_deg) + 1;
+    if (h->num_elts - 1 - j < h->ix_offset){
+      jlast = h->num_elts - 1;
+    }else{
+      jlast = j + h->ix_offset;
+    }
+    jmin = j;
+    for (j++; j <= jlast; j++){
+      if (cmp(h, pty_ptr(h, j), pty_ptr(h, jmin)) < 0) jmin = j;
+    }
+    if (cmp(h, h->buf, pty_ptr(h, jmin)) > 0){
+      half_swap(h, i, jmin);
+      i = jmin;
+    }else{
+      break;
+    }
+  }
+  memcpy(pty_ptr(h, i), h->buf, h->pair_size);
+  map_ix(h, i);
+}
+
+/**
+   Maps the element at index i to i in the position array, if a heap is in
+   the dense index mode, or in the hash table, if a hash table is used.
+*/
+static void map_ix(const heap_t *h, size_t i){
+  size_t elt;
+  if (h->pos_ixs != NULL){
+    memcpy(&elt, elt_ptr(h, i), sizeof(size_t)); /* pty_size alignment */
+    h->pos_ixs[elt] = i;
+  }else if (h->hht != NULL){
+    h->hht->insert(h->hht->ht, elt_ptr(h, i), &i);
+    if (h->stats != NULL) h->stats->num_ht_inserts++;
+  }
+}
+
+/**
+   Compares two priority values with cmp_pty, and counts the call if
+   operations are counted.
+*/
+static int cmp(const heap_t *h, const void *a, const void *b){
+  if (h->stats != NULL) h->stats->num_cmps++;
+  return h->cmp_pty(a, b);
 }
 
 /**
    Computes a pointer to an element in the element-priority array of a heap.
 */
 static void *pty_ptr(const heap_t *h, size_t i){
-  return (void *)((char *)h->pty_elts + i * h->pair_size);
+  return (void *)((char *)h->pty_elts + (i + h->ix_offset) * h->pair_size);
 }
 
 /**
    Computes a pointer to a priority in the element-priority array of a heap.
 */
 static void *elt_ptr(const heap_t *h, size_t i){
-  return (void *)((char *)h->pty_elts + i * h->pair_size + h->pty_size);
+  return (void *)((char *)h->pty_elts +
+		  (i + h->ix_offset) * h->pair_size +
+		  h->pty_size);
 }
 
 /**
@@ -47,6 +47,16 @@ typedef struct{
   heap_ht_free free;
 } heap_ht_t;
 
+typedef struct{
+  size_t num_cmps; /* cmp_pty calls */
+  size_t num_moves; /* pair moves in heapifying and popping */
+  size_t num_ht_inserts;
+  size_t num_ht_searches;
+  size_t num_ht_removes;
+  size_t num_grows; /* reallocations of the priority-element array */
+  size_t max_num_elts; /* peak number of elements */
+} heap_stats_t;
+
 typedef struct{
   size_t count;
   size_t count_max;
@@ -54,9 +64,16 @@ typedef struct{
   size_t pty_size;
   size_t elt_size;
   size_t pair_size; /* pty_size + elt_size */
-  void *pty_elts;
+  size_t log_deg; /* log base 2 of the number of children of a node */
+  size_t ix_offset; /* number of pairs before the root */
+  int huge_page; /* non-zero if pty_elts is backed by huge pages */
+  void *pty_elts; /* aligned to 64 bytes within pty_elts_block */
+  void *pty_elts_block;
   void *buf; /* only used by heap operations internally */
   const heap_ht_t *hht;
+  size_t num_ixs; /* number of dense element indices */
+  size_t *pos_ixs; /* NULL if not in the dense index mode */
+  heap_stats_t *stats; /* NULL if operations are not counted */
   int (*cmp_pty)(const void *, const void *);
   void (*free_elt)(void *);
 } heap_t;
@@ -71,10 +88,16 @@ typedef struct{
                  - size of a pointer to an element, if the element is within
                  a noncontiguous memory block or a pointer to a contiguous
                  element is inserted
-   hht         : a non-NULL pointer to a set of parameters specifying a
+   hht         : - a non-NULL pointer to a set of parameters specifying a
                  hash table for in-heap search and modifications; a hash
                  key has the size and bit pattern of the block of size
                  elt_size pointed to by elt in heap_push
+                 - NULL, if a heap is used without a hash table (e.g. with
+                 lazy deletion of stale elements after popping); then an
+                 element may be pushed more than once with different
+                 priority values, heap_search and heap_update are not
+                 called, and the hash table maintenance is avoided in all
+                 heap operations
    cmp_pty     : comparison function which returns a negative integer value
                  if the priority value pointed to by the first argument is
                  less than the priority value pointed to by the second, a
@@ -99,28 +122,122 @@ void heap_init(heap_t *h,
 	       int (*cmp_pty)(const void *, const void *),
 	       void (*free_elt)(void *));
 
+/**
+   Backs the priority-element array of a heap with huge pages if the array
+   is at least as large as a huge page and huge pages are available on a
+   given system, thereby reducing TLB misses in heap operations on a large
+   heap. Otherwise regular pages are used. The operation is optionally
+   called after heap_init is completed and before any other operation is
+   called.
+   h           : pointer to an initialized heap
+*/
+void heap_huge_page(heap_t *h);
+
+/**
+   Sets the number of children of a node in a heap to 2**log_deg (e.g. 4 or
+   8). The children of a node are contiguous in the priority-element array
+   and, due to an offset of 2**log_deg - 1 pairs before the root, begin at a
+   multiple of 2**log_deg * pair_size bytes from the start of the array,
+   which is aligned to 64 bytes. If pair_size is 16 bytes, the children of
+   a node in a 4-ary heap are within a 64-byte cache line, and the depth of
+   the heap is halved relative to a binary heap, which reduces cache misses
+   in heap_pop. The hash table parameter is maintained as in a binary heap.
+   The operation is optionally called after heap_init is completed and
+   before any other operation, except heap_huge_page, is called.
+   h           : pointer to an initialized heap
+   log_deg     : > 0 and < CHAR_BIT * sizeof(size_t) - 1; 1 for a binary
+                 heap (default), 2 for a 4-ary heap, and 3 for an 8-ary heap
+*/
+void heap_dary(heap_t *h, size_t log_deg);
+
+/**
+   Sets a heap initialized without a hash table to the dense index mode,
+   where each element is a size_t index in the range [0, num_ixs) (e.g. a
+   vertex) and elt_size is sizeof(size_t). The position of each element in
+   the heap is maintained in a built-in array of num_ixs indices, which is
+   updated inline with each move of an element, without hash table calls.
+   In the dense index mode an element is pushed at most once until it is
+   popped, and heap_search and heap_update are called as with a hash
+   table. The operation is optionally called after heap_init is completed
+   with NULL as hht, and before any other operation, except heap_huge_page,
+   heap_dary, and heap_count_stats, is called.
+   h           : pointer to an initialized heap
+   num_ixs     : > 0 number of element indices
+*/
+void heap_dense_ix(heap_t *h, size_t num_ixs);
+
+/**
+   Enables the counting of cmp_pty calls, pair moves, hash table insert,
+   search, and remove calls, and reallocations of the priority-element
+   array, as well as the tracking of the peak number of elements in a
+   heap. If the operation is not called, only a NULL pointer test is
+   performed where a counter would be updated. The operation is optionally
+   called after heap_init is completed and before any other operation,
+   except heap_huge_page and heap_dary, is called.
+   h           : pointer to an initialized heap
+*/
+void heap_count_stats(heap_t *h);
+
+/**
+   Copies the counters of a heap, on which heap_count_stats was called, to
+   a preallocated block of size sizeof(heap_stats_t) pointed to by the
+   stats parameter.
+*/
+void heap_stats(const heap_t *h, heap_stats_t *stats);
+
 /**
    Pushes an element not in a heap and an associated priority value. 
    Prior to pushing, the membership of an element can be tested, if 
    necessary, with heap_search in O(1) time in expectation under the
-   uniformity assumptions suitable for the used hash table.
+   uniformity assumptions suitable for the used hash table. If a heap
+   was initialized without a hash table, the element may be in the heap.
    h           : pointer to an initialized heap
    pty         : pointer to a block of size pty_size that is an object of
                  basic type (e.g. char, int, long, double)
    elt         : pointer to a block of size elt_size that is either a
                  contiguous element object or a pointer to a contiguous or
                  non-contiguous element; the block must have a unique
-                 bit pattern for each pushed element
+                 bit pattern for each pushed element if a hash table
+                 is used
 */
 void heap_push(heap_t *h, const void *pty, const void *elt);
 
+/**
+   Builds a heap from n priority values and n elements in O(n) time by
+   bottom-up heapifying, instead of n heap_push operations in O(n log n)
+   time. The heap is empty prior to the operation. The hash table is
+   populated in one pass after the heap structure is built, and is not
+   updated during heapifying. If a hash table is used, each element is
+   not in the heap and has a unique bit pattern as specified in heap_push.
+   h           : pointer to an initialized empty heap
+   ptys        : pointer to an array of n contiguous priority objects, each
+                 of size pty_size
+   elts        : pointer to an array of n contiguous blocks, each of size
+                 elt_size, as specified for elt in heap_push
+   n           : number of priority values and elements
+*/
+void heap_build(heap_t *h, const void *ptys, const void *elts, size_t n);
+
+/**
+   Pushes n elements and their associated priority values. If n is greater
+   or equal to the number of elements in the heap, the heap is rebuilt
+   bottom-up in O(n) time and the hash table is populated in one pass.
+   Otherwise each element is heapified upwards in O(log n) time. Please
+   see the parameter specification in heap_build.
+*/
+void heap_push_batch(heap_t *h,
+		     const void *ptys,
+		     const void *elts,
+		     size_t n);
+
 /** 
    Returns a pointer to the priority of an element in a heap or NULL if the
    element is not in the heap in O(1) time in expectation under the
    uniformity assumptions suitable for the used hash table. The returned
    pointer is guaranteed to point to the current priority value until another
-   heap operation is performed. Please see the parameter specification in
-   heap_push.
+   heap operation is performed. Not called on a heap initialized without
+   a hash table, unless the heap is in the dense index mode. Please see the
+   parameter specification in heap_push.
 */
 void *heap_search(const heap_t *h, const void *elt);
 
@@ -128,8 +245,9 @@ void *heap_search(const heap_t *h, const void *elt);
    Updates the priority value of an element that is in a heap. Prior
    to updating, the membership of an element can be tested, if necessary, 
    with heap_search in O(1) time in expectation under the uniformity
-   assumptions suitable for the used hash table. Please see the parameter
-   specification in heap_push.
+   assumptions suitable for the used hash table. Not called on a heap
+   initialized without a hash table, unless the heap is in the dense
+   index mode. Please see the parameter specification in heap_push.
 */
 void heap_update(heap_t *h, const void *pty, const void *elt);
 
@@ -141,6 +259,14 @@ void heap_update(heap_t *h, const void *pty, const void *elt);
 */
 void heap_pop(heap_t *h, void *pty, void *elt);
 
+/**
+   Returns a pointer to a minimal priority value in a heap according to
+   cmp_pty, or NULL if the heap is empty, without modifying the heap. The
+   returned pointer is guaranteed to point to the minimal priority value
+   until another heap operation is performed.
+*/
+void *heap_peek(const heap_t *h);
+
 /**
    Frees a heap and leaves a block of size sizeof(heap_t) pointed to by
    an argument passed as the h parameter.
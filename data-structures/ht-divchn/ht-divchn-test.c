@@ -403,6 +403,37 @@ void search_in_ht(const ht_divchn_t *ht,
   *res *= (ht->num_elts == n);
 }
 
+void search_mru_in_ht(ht_divchn_t *ht,
+		      const unsigned char *keys,
+		      const void *elts,
+		      size_t count,
+		      size_t (*val_elt)(const void *),
+		      int *res){
+  size_t i;
+  size_t n = ht->num_elts;
+  const unsigned char *k = NULL;
+  const char *e = NULL;
+  const void *elt = NULL;
+  clock_t t;
+  k = keys;
+  e = elts;
+  t = clock();
+  for (i = 0; i < count; i++){
+    /* the second search finds the key at the front of its chain */
+    elt = ht_divchn_search_mru(ht, k);
+    *res *= (val_elt(e) == val_elt(elt));
+    elt = ht_divchn_search_mru(ht, k);
+    *res *= (val_elt(e) == val_elt(elt));
+    k += ht->key_size;
+    e += ht->elt_size;
+  }
+  t = clock() - t;
+  printf("\t\tin ht search mru x2 time:       "
+	 "%.4f seconds\n", (float)t / CLOCKS_PER_SEC);
+  search_in_ht(ht, keys, elts, count, val_elt, res);
+  *res *= (ht->num_elts == n);
+}
+
 void search_nin_ht(const ht_divchn_t *ht,
 		   const unsigned char *nin_keys,
 		   size_t count,
@@ -478,6 +509,7 @@ void insert_search_free(size_t num_ins,
 		 NULL,
 		 NULL,
 		 NULL);
+  ht_divchn_huge_page(&ht);
   insert_keys_elts(&ht, keys, elts, num_ins, &res); /* no dereferencing */
   free_ht(&ht);
   ht_divchn_init(&ht,
@@ -492,6 +524,7 @@ void insert_search_free(size_t num_ins,
   ht_divchn_align_elt(&ht, elt_alignment);
   insert_keys_elts(&ht, keys, elts, num_ins, &res);
   search_in_ht(&ht, keys, elts, num_ins, val_elt, &res);
+  search_mru_in_ht(&ht, keys, elts, num_ins, val_elt, &res);
   for (i = 0; i < num_ins; i++){
     key = ptr(nin_keys, i, key_size);
     val = i + num_ins;
@@ -43,6 +43,7 @@
 #include "ht-divchn.h"
 #include "dll.h"
 #include "utilities-mem.h"
+#include "utilities-mem-huge.h"
 #include "utilities-mod.h"
 
 /**
@@ -120,6 +121,8 @@ static const size_t C_SIZE_MAX = (size_t)-1;
 static size_t hash(const ht_divchn_t *ht, const void *key);
 static size_t mul_alpha_sz_max(size_t n, size_t alpha_n, size_t log_alpha_d);
 static void ht_grow(ht_divchn_t *ht);
+static dll_node_t **key_elts_new(ht_divchn_t *ht);
+static void key_elts_free(const ht_divchn_t *ht, dll_node_t **key_elts);
 static int incr_count(ht_divchn_t *ht);
 static int is_overflow(size_t start, size_t count);
 static size_t build_prime(size_t start, size_t count);
@@ -173,7 +176,6 @@ void ht_divchn_init(ht_divchn_t *ht,
 		    int (*cmp_key)(const void *, const void *),
 		    size_t (*rdc_key)(const void *, size_t),
 		    void (*free_elt)(void *)){
-  size_t i;
   ht->key_size = key_size;
   ht->elt_size = elt_size;
   ht->elt_alignment = 1;
@@ -186,11 +188,9 @@ void ht_divchn_init(ht_divchn_t *ht,
   ht->num_elts = 0;
   ht->alpha_n = alpha_n;
   ht->log_alpha_d = log_alpha_d;
+  ht->huge_page = 0;
   ht->ll = malloc_perror(1, sizeof(dll_t));
-  ht->key_elts = malloc_perror(ht->count, sizeof(dll_node_t *));
-  for (i = 0; i < ht->count; i++){
-    dll_init(ht->ll, &ht->key_elts[i], ht->key_size);
-  }
+  ht->key_elts = key_elts_new(ht);
   ht->cmp_key = cmp_key;
   ht->rdc_key = rdc_key;
   ht->free_elt = free_elt;
@@ -217,6 +217,21 @@ void ht_divchn_align_elt(ht_divchn_t *ht, size_t alignment){
   dll_align_elt(ht->ll, alignment);
 }
 
+/**
+   Backs the array of slots of a hash table with huge pages if the array is
+   at least as large as a huge page and huge pages are available on a given
+   system, thereby reducing TLB misses when accessing the slots of a large
+   hash table. Otherwise regular pages are used. The operation is
+   optionally called after ht_divchn_init is completed and before any other
+   operation, except ht_divchn_align_elt, is called.
+   ht          : pointer to an initialized ht_divchn_t struct
+*/
+void ht_divchn_huge_page(ht_divchn_t *ht){
+  key_elts_free(ht, ht->key_elts);
+  ht->huge_page = 1;
+  ht->key_elts = key_elts_new(ht);
+}
+
 /**
    Inserts a key and an associated element into a hash table. If the key is
    in the hash table, associates the key with the new element. The key and 
@@ -263,6 +278,35 @@ void *ht_divchn_search(const ht_divchn_t *ht, const void *key){
   }
 }
 
+/**
+   If a key is present in a hash table, moves the key and its associated
+   element to the front of the chain of the key's slot, and returns a
+   pointer to the associated element, otherwise returns NULL. Under a
+   skewed access pattern frequently searched keys are found after fewer
+   comparisons, which is beneficial at high load factors. The operation
+   modifies the order of keys in a chain, but does not modify the set of
+   keys and elements in a hash table and does not move any key or element
+   in memory; pointers returned by prior search operations remain valid.
+   The key parameter is not NULL and points to a block of size key_size.
+   The returned pointer can be dereferenced according to ht_divchn_init
+   and ht_divchn_align_elt.
+*/
+void *ht_divchn_search_mru(ht_divchn_t *ht, const void *key){
+  dll_node_t **head = &ht->key_elts[hash(ht, key)];
+  dll_node_t *node = dll_search_key(ht->ll,
+				    head,
+				    key,
+				    ht->key_size,
+				    ht->cmp_key);
+  if (node == NULL){
+    return NULL;
+  }else{
+    dll_remove(head, node);
+    dll_prepend(head, node);
+    return dll_elt_ptr(ht->ll, node);
+  }
+}
+
 /**
    Removes a key and its associated element from a hash table by copying 
    the element or its pointer into a block of size elt_size pointed to
@@ -307,7 +351,7 @@ void ht_divchn_free(ht_divchn_t *ht){
     dll_free(ht->ll, &ht->key_elts[i], ht->free_elt);
   }
   free(ht->ll);
-  free(ht->key_elts);
+  key_elts_free(ht, ht->key_elts);
   ht->ll = NULL;
   ht->key_elts = NULL;
 }
@@ -334,6 +378,10 @@ void *ht_divchn_search_helper(const void *ht, const void *key){
   return ht_divchn_search(ht, key);
 }
 
+void *ht_divchn_search_mru_helper(void *ht, const void *key){
+  return ht_divchn_search_mru(ht, key);
+}
+
 void ht_divchnn_remove_helper(void *ht, const void *key, void *elt){
   ht_divchn_remove(ht, key, elt);
 }
@@ -422,11 +470,7 @@ static void ht_grow(ht_divchn_t *ht){
   dll_node_t **head = NULL, *node = NULL;
   while (ht->num_elts > ht->max_num_elts && incr_count(ht));
   if (prev_count == ht->count) return; /* load factor not lowered */
-  ht->key_elts = malloc_perror(ht->count, sizeof(dll_node_t *));
-  for (i = 0; i < ht->count; i++){
-    dll_init(ht->ll, &ht->key_elts[i], ht->key_size);
-  }
-  if (ht->elt_alignment > 1) dll_align_elt(ht->ll, ht->elt_alignment);
+  ht->key_elts = key_elts_new(ht);
   for (i = 0; i < prev_count; i++){
     head = &prev_key_elts[i];
     while (*head != NULL){
@@ -435,10 +479,38 @@ static void ht_grow(ht_divchn_t *ht){
       dll_prepend(&ht->key_elts[hash(ht, dll_key_ptr(ht->ll, node))], node);
     }
   }
-  free(prev_key_elts);
+  key_elts_free(ht, prev_key_elts);
   prev_key_elts = NULL;
 }
 
+/**
+   Allocates an array of count pointers to nodes, each initialized as an
+   empty list, according to huge_page, and frees such an array.
+*/
+
+static dll_node_t **key_elts_new(ht_divchn_t *ht){
+  size_t i;
+  dll_node_t **key_elts = NULL;
+  if (ht->huge_page){
+    key_elts = malloc_huge_perror(ht->count, sizeof(dll_node_t *));
+  }else{
+    key_elts = malloc_perror(ht->count, sizeof(dll_node_t *));
+  }
+  for (i = 0; i < ht->count; i++){
+    dll_init(ht->ll, &key_elts[i], ht->key_size);
+  }
+  if (ht->elt_alignment > 1) dll_align_elt(ht->ll, ht->elt_alignment);
+  return key_elts;
+}
+
+static void key_elts_free(const ht_divchn_t *ht, dll_node_t **key_elts){
+  if (ht->huge_page){
+    free_huge(key_elts);
+  }else{
+    free(key_elts);
+  }
+}
+
 /**
    Attempts to increase the count of a hash table. Returns 1 if the count
    was increased. Otherwise returns 0. Updates count_ix, group_ix, count,
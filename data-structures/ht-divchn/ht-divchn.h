@@ -54,6 +54,7 @@ typedef struct{
   size_t num_elts;
   size_t alpha_n;
   size_t log_alpha_d; 
+  int huge_page; /* non-zero if key_elts is backed by huge pages */
   dll_t *ll;
   dll_node_t **key_elts; /* array of pointers to nodes */
   int (*cmp_key)(const void *, const void *);
@@ -129,6 +130,17 @@ void ht_divchn_init(ht_divchn_t *ht,
 */
 void ht_divchn_align_elt(ht_divchn_t *ht, size_t alignment);
 
+/**
+   Backs the array of slots of a hash table with huge pages if the array is
+   at least as large as a huge page and huge pages are available on a given
+   system, thereby reducing TLB misses when accessing the slots of a large
+   hash table. Otherwise regular pages are used. The operation is
+   optionally called after ht_divchn_init is completed and before any other
+   operation, except ht_divchn_align_elt, is called.
+   ht          : pointer to an initialized ht_divchn_t struct
+*/
+void ht_divchn_huge_page(ht_divchn_t *ht);
+
 /**
    Inserts a key and an associated element into a hash table. If the key is
    in the hash table, associates the key with the new element. The key and 
@@ -145,6 +157,21 @@ void ht_divchn_insert(ht_divchn_t *ht, const void *key, const void *elt);
 */
 void *ht_divchn_search(const ht_divchn_t *ht, const void *key);
 
+/**
+   If a key is present in a hash table, moves the key and its associated
+   element to the front of the chain of the key's slot, and returns a
+   pointer to the associated element, otherwise returns NULL. Under a
+   skewed access pattern frequently searched keys are found after fewer
+   comparisons, which is beneficial at high load factors. The operation
+   modifies the order of keys in a chain, but does not modify the set of
+   keys and elements in a hash table and does not move any key or element
+   in memory; pointers returned by prior search operations remain valid.
+   The key parameter is not NULL and points to a block of size key_size.
+   The returned pointer can be dereferenced according to ht_divchn_init
+   and ht_divchn_align_elt.
+*/
+void *ht_divchn_search_mru(ht_divchn_t *ht, const void *key);
+
 /**
    Removes a key and its associated element from a hash table by copying 
    the element or its pointer into a block of size elt_size pointed to
@@ -183,6 +210,8 @@ void ht_divchn_insert_helper(void *ht, const void *key, const void *elt);
 
 void *ht_divchn_search_helper(const void *ht, const void *key);
 
+void *ht_divchn_search_mru_helper(void *ht, const void *key);
+
 void ht_divchnn_remove_helper(void *ht, const void *key, void *elt);
 
 void ht_divchn_delete_helper(void *ht, const void *key);
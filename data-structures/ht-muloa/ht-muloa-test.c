@@ -19,6 +19,7 @@
       [0, 1] : on/off insert search uint_ptr test
       [0, 1] : on/off remove delete uint_ptr test
       [0, 1] : on/off corner cases test
+      [0, 1] : on/off merge test
 
    usage examples:
    ./ht-muloa-test
@@ -26,6 +27,7 @@
    ./ht-muloa-test 17 5 6 
    ./ht-muloa-test 19 0 2 3000 4000 15 10
    ./ht-muloa-test 19 0 2 3000 4000 15 10 1 1 0 0 0
+   ./ht-muloa-test 19 0 2 3000 4000 15 10 0 0 0 0 0 1
 
    ht-muloa-test can be run with any subset of command line arguments in the
    above-defined order. If the (i + 1)th argument is specified then the ith
@@ -67,15 +69,17 @@ const char *C_USAGE =
   "[0, # bits in size_t) : b s.t. k * 2**a <= key size <= k * 2**b\n"
   "> 0 : c\n"
   "> 0 : d\n"
-  "> 0 : e log base 2 s.t. c <= d <= 2**e\n"
+  "> 0 : e log base 2\n"
   "> 0 : f s.t. c / 2**e <= alpha <= d / 2**e, in f steps\n"
   "[0, 1] : on/off insert search uint test\n"
   "[0, 1] : on/off remove delete uint test\n"
   "[0, 1] : on/off insert search uint_ptr test\n"
   "[0, 1] : on/off remove delete uint_ptr test\n"
-  "[0, 1] : on/off corner cases test\n";
-const int C_ARGC_MAX = 13;
-const size_t C_ARGS_DEF[12] = {14, 0, 2, 3277, 32768u, 15, 8, 1, 1, 1, 1, 1};
+  "[0, 1] : on/off corner cases test\n"
+  "[0, 1] : on/off merge test\n";
+const int C_ARGC_MAX = 14;
+const size_t C_ARGS_DEF[13] = {14, 0, 2, 3277, 32768u, 15, 8, 1, 1, 1, 1, 1,
+			       1};
 const size_t C_SIZE_MAX = (size_t)-1;
 const size_t C_FULL_BIT = CHAR_BIT * sizeof(size_t);
 
@@ -105,6 +109,10 @@ void remove_delete(size_t num_ins,
 		   void (*new_elt)(void *, size_t),
 		   size_t (*val_elt)(const void *),
 		   void (*free_elt)(void *));
+void merge(size_t num_ins,
+	   size_t key_size,
+	   size_t alpha_n,
+	   size_t log_alpha_d);
 void *ptr(const void *block, size_t i, size_t size);
 void print_test_result(int res);
 
@@ -678,6 +686,25 @@ void remove_delete(size_t num_ins,
   insert_keys_elts(&ht, keys, elts, num_ins, &res);
   delete_key_elts(&ht, keys, elts, num_ins, val_elt, &res);
   free_ht(&ht);
+  for (i = 0; i < num_ins; i++){
+    new_elt(ptr(elts, i, elt_size), i); /* elements were deleted */
+  }
+  ht_muloa_init(&ht,
+		key_size,
+		elt_size,
+		0,
+		alpha_n,
+		log_alpha_d,
+		NULL,
+		NULL,
+		free_elt);
+  ht_muloa_align_elt(&ht, elt_alignment);
+  ht_muloa_fval_array(&ht);
+  insert_keys_elts(&ht, keys, elts, num_ins, &res);
+  remove_key_elts(&ht, keys, elts, num_ins, val_elt, &res);
+  insert_keys_elts(&ht, keys, elts, num_ins, &res);
+  delete_key_elts(&ht, keys, elts, num_ins, val_elt, &res);
+  free_ht(&ht);
   printf("\t\tremove and delete correctness:  ");
   print_test_result(res);
   free(keys);
@@ -734,6 +761,136 @@ void run_corner_cases_test(int log_ins){
   free_ht(&ht);
 }
 
+/**
+   Runs a ht_muloa_merge test on overlapping sets of keys and size_t
+   elements across key sizes >= sizeof(size_t) and load factor upper
+   bounds.
+*/
+void run_merge_uint_test(size_t log_ins,
+			 size_t log_key_start,
+			 size_t log_key_end,
+			 size_t alpha_n_start,
+			 size_t alpha_n_end,
+			 size_t log_alpha_d,
+			 size_t num_alpha_steps){
+  size_t i, j;
+  size_t num_ins;
+  size_t key_size;
+  size_t step, rem;
+  size_t alpha_n;
+  num_ins = pow_two_perror(log_ins);
+  step = (alpha_n_end - alpha_n_start) / num_alpha_steps;
+  for (i = log_key_start; i <= log_key_end; i++){
+    alpha_n = alpha_n_start;
+    rem = alpha_n_end - alpha_n_start - step * num_alpha_steps;
+    key_size = sizeof(size_t) * pow_two_perror(i);
+    printf("Run a ht_muloa_merge test on overlapping sets of "
+	   "%lu-byte keys and size_t elements\n", TOLU(key_size));
+    for (j = 0; j <= num_alpha_steps; j++){
+      printf("\tnumber of inserts: %lu, load factor upper bound: %.4f\n",
+	     TOLU(num_ins), (float)alpha_n / pow_two_perror(log_alpha_d));
+      merge(num_ins, key_size, alpha_n, log_alpha_d);
+      alpha_n += (j < num_alpha_steps) * step + (rem > 0 && rem--);
+    }
+  }
+}
+
+/**
+   Helper functions for the ht_muloa_merge test. The keys of the
+   destination hash table are keys[0, num_ins) and the keys of the source
+   hash table are keys[num_ins / 2, num_ins / 2 + num_ins), and the element
+   of each key is its index in keys.
+*/
+
+void add_uint(void *a, const void *b, size_t elt_size){
+  size_t sa, sb;
+  memcpy(&sa, a, elt_size);
+  memcpy(&sb, b, elt_size);
+  sa += sb;
+  memcpy(a, &sa, elt_size);
+}
+
+void merge_key_elts(ht_muloa_t *dst,
+		    ht_muloa_t *src,
+		    const unsigned char *keys,
+		    size_t num_ins,
+		    void (*rdc_elt)(void *, const void *, size_t),
+		    int *res){
+  size_t i;
+  size_t half = num_ins / 2;
+  size_t elt;
+  const unsigned char *k = NULL;
+  clock_t t;
+  for (i = 0; i < num_ins; i++){
+    elt = i;
+    ht_muloa_insert(dst, ptr(keys, i, dst->key_size), &elt);
+    elt = half + i;
+    ht_muloa_insert(src, ptr(keys, half + i, src->key_size), &elt);
+  }
+  t = clock();
+  ht_muloa_merge(dst, src, rdc_elt);
+  t = clock() - t;
+  *res *= (dst->num_elts == half + num_ins &&
+	   src->num_elts == 0 &&
+	   src->key_elts == NULL);
+  k = keys;
+  for (i = 0; i < half + num_ins; i++){
+    if (i >= half && i < num_ins && rdc_elt != NULL){
+      *res *= (*(size_t *)ht_muloa_search(dst, k) == 2 * i);
+    }else{
+      *res *= (*(size_t *)ht_muloa_search(dst, k) == i);
+    }
+    k += dst->key_size;
+  }
+  printf("\t\tmerge time:                     "
+	 "%.4f seconds\n", (float)t / CLOCKS_PER_SEC);
+}
+
+void merge(size_t num_ins,
+	   size_t key_size,
+	   size_t alpha_n,
+	   size_t log_alpha_d){
+  int res = 1;
+  size_t i, j;
+  size_t num_keys = num_ins + num_ins / 2;
+  unsigned char key_buf[sizeof(size_t)];
+  unsigned char *key = NULL;
+  unsigned char *keys = NULL;
+  ht_muloa_t dst, src;
+  keys = malloc_perror(num_keys, key_size);
+  for (i = 0; i < num_keys; i++){
+    key = ptr(keys, i, key_size);
+    for (j = 0; j < key_size - sizeof(size_t); j++){
+      *(unsigned char *)ptr(key, j, 1) = RANDOM(); /* mod 2**CHAR_BIT */
+    }
+    memcpy(key_buf, &i, sizeof(size_t)); /* eff. type in key unchanged */
+    memcpy(ptr(key, key_size - sizeof(size_t), 1), key_buf, sizeof(size_t));
+  }
+  ht_muloa_init(&dst, key_size, sizeof(size_t), 0, alpha_n, log_alpha_d,
+		NULL, NULL, NULL);
+  ht_muloa_init(&src, key_size, sizeof(size_t), 0, alpha_n, log_alpha_d,
+		NULL, NULL, NULL);
+  ht_muloa_align_elt(&dst, sizeof(size_t));
+  ht_muloa_align_elt(&src, sizeof(size_t));
+  merge_key_elts(&dst, &src, keys, num_ins, add_uint, &res);
+  free_ht(&dst);
+  ht_muloa_init(&dst, key_size, sizeof(size_t), 0, alpha_n, log_alpha_d,
+		NULL, NULL, NULL);
+  ht_muloa_init(&src, key_size, sizeof(size_t), num_ins, alpha_n,
+		log_alpha_d, NULL, NULL, NULL);
+  ht_muloa_align_elt(&dst, sizeof(size_t));
+  ht_muloa_align_elt(&src, sizeof(size_t));
+  ht_muloa_fval_array(&dst);
+  ht_muloa_huge_page(&dst);
+  ht_muloa_huge_page(&src);
+  merge_key_elts(&dst, &src, keys, num_ins, NULL, &res);
+  free_ht(&dst);
+  printf("\t\tmerge correctness:              ");
+  print_test_result(res);
+  free(keys);
+  keys = NULL;
+}
+
 /**
    Helper functions.
 */
@@ -780,11 +937,12 @@ int main(int argc, char *argv[]){
       args[3] > pow_two_perror(args[5]) ||
       args[4] > pow_two_perror(args[5]) ||
       args[6] < 1 ||
-      args[7] < 1 ||
+      args[7] > 1 ||
       args[8] > 1 ||
       args[9] > 1 ||
       args[10] > 1 ||
-      args[11] > 1){
+      args[11] > 1 ||
+      args[12] > 1){
     fprintf(stderr, "USAGE:\n%s", C_USAGE);
     exit(EXIT_FAILURE);
   };
@@ -817,6 +975,13 @@ int main(int argc, char *argv[]){
 						args[5],
 						args[6]);
   if (args[11]) run_corner_cases_test(args[0]);
+  if (args[12]) run_merge_uint_test(args[0],
+				    args[1],
+				    args[2],
+				    args[3],
+				    args[4],
+				    args[5],
+				    args[6]);
   free(args);
   args = NULL;
   return 0;
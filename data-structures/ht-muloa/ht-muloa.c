@@ -47,6 +47,7 @@
 #include <limits.h>
 #include "ht-muloa.h"
 #include "utilities-mem.h"
+#include "utilities-mem-huge.h"
 #include "utilities-mod.h"
 
 static const size_t C_FIRST_PRIME_PARTS[1 + 8 * (2 + 3 + 4)] =
@@ -139,11 +140,21 @@ static size_t adjust_dist(size_t dist);
 
 /* hash table operations and maintenance*/
 static ke_t **search(const ht_muloa_t *ht, const void *key);
+static int fval_eq(const ht_muloa_t *ht, ke_t * const *ke, size_t fval);
+static void slot_set(ht_muloa_t *ht, ke_t **ke, ke_t *val);
 static size_t mul_alpha(size_t n, size_t alpha_n, size_t log_alpha_d);
 static int incr_count(ht_muloa_t *ht);
 static void ht_grow(ht_muloa_t *ht);
 static void ht_clean(ht_muloa_t *ht);
 static void reinsert(ht_muloa_t *ht, const ke_t *prev_ke);
+static ke_t **key_elts_new(const ht_muloa_t *ht);
+static void key_elts_free(const ht_muloa_t *ht, ke_t **key_elts);
+static size_t *fvals_new(const ht_muloa_t *ht);
+static void fvals_free(const ht_muloa_t *ht, size_t *fvals);
+static void merge_ke(ht_muloa_t *dst,
+		     const ht_muloa_t *src,
+		     ke_t *src_ke,
+		     void (*rdc_elt)(void *, const void *, size_t));
 
 /* integer constant construction */
 static size_t find_build_prime(const size_t *parts);
@@ -198,7 +209,7 @@ void ht_muloa_init(ht_muloa_t *ht,
 		   int (*cmp_key)(const void *, const void *),
 		   size_t (*rdc_key)(const void *, size_t),
 		   void (*free_elt)(void *)){
-  size_t i, rem;
+  size_t rem;
   ht->key_size = key_size;
   ht->elt_size = elt_size;
   /* align ke_t relative to a malloc's pointer */
@@ -226,11 +237,10 @@ void ht_muloa_init(ht_muloa_t *ht,
   ht->sprime = find_build_prime(C_SECOND_PRIME_PARTS);
   ht->alpha_n = alpha_n;
   ht->log_alpha_d = log_alpha_d;
+  ht->huge_page = 0;
   ht->ph = ph_new();
-  ht->key_elts = malloc_perror(ht->count, sizeof(ke_t *));
-  for (i = 0; i < ht->count; i++){
-    ht->key_elts[i] = NULL;
-  }
+  ht->key_elts = key_elts_new(ht);
+  ht->fvals = NULL;
   ht->cmp_key = cmp_key;
   ht->rdc_key = rdc_key;
   ht->free_elt = free_elt;
@@ -266,6 +276,41 @@ void ht_muloa_align_elt(ht_muloa_t *ht, size_t alignment){
   }
 }
 
+/**
+   Backs the array of slots of a hash table with huge pages if the array is
+   at least as large as a huge page and huge pages are available on a given
+   system, thereby reducing TLB misses when probing a large hash table.
+   Otherwise regular pages are used. The operation is optionally called
+   after ht_muloa_init is completed and before any other operation is
+   called.
+   ht          : pointer to an initialized ht_muloa_t struct
+*/
+void ht_muloa_huge_page(ht_muloa_t *ht){
+  key_elts_free(ht, ht->key_elts);
+  ht->huge_page = 1;
+  ht->key_elts = key_elts_new(ht);
+  if (ht->fvals != NULL){
+    free(ht->fvals); /* allocated before huge_page was set */
+    ht->fvals = fvals_new(ht);
+  }
+}
+
+/**
+   Maintains a dense array of the first hash values of the slots of a hash
+   table alongside the array of slots, in a structure of arrays layout.
+   A probe then only accesses the dense arrays, unless the first hash value
+   of the slot is equal to the first hash value of the searched key, in
+   which case the key and, if the key is found, its associated element are
+   accessed. The alignment of elements according to ht_muloa_align_elt is
+   preserved. The operation is optionally called after ht_muloa_init is
+   completed and before any other operation, except ht_muloa_align_elt and
+   ht_muloa_huge_page, is called.
+   ht          : pointer to an initialized ht_muloa_t struct
+*/
+void ht_muloa_fval_array(ht_muloa_t *ht){
+  ht->fvals = fvals_new(ht);
+}
+
 /**
    Inserts a key and an associated element into a hash table. If the key is
    in the hash table, associates the key with the new element. The key and 
@@ -281,17 +326,18 @@ void ht_muloa_insert(ht_muloa_t *ht, const void *key, const void *elt){
   std_key = convert_std_key(ht, key);
   fval = ht->fprime * std_key; /* mod 2**C_FULL_BIT */
   sval = ht->sprime * std_key; /* mod 2**C_FULL_BIT */
+  fval -= fval & 1; /* 1st bit not used in hashing => 1 as ph identifier */
   ix = fval >> (C_FULL_BIT - ht->log_count);
   dist = adjust_dist(sval >> (C_FULL_BIT - ht->log_count));
   ke = &ht->key_elts[ix];
   while (*ke != NULL){
     if (ht->cmp_key != NULL && /* loop invariant */
-	!is_ph(*ke) &&
+	fval_eq(ht, ke, fval) &&
 	ht->cmp_key(ke_key_ptr(ht, *ke), key) == 0){
       ke_elt_update(ht, *ke, elt);
       return;
     }else if (ht->cmp_key == NULL && /* loop invariant */
-	      !is_ph(*ke) &&
+	      fval_eq(ht, ke, fval) &&
 	      memcmp(ke_key_ptr(ht, *ke), key, ht->key_size) == 0){
       ke_elt_update(ht, *ke, elt);
       return;
@@ -301,8 +347,7 @@ void ht_muloa_insert(ht_muloa_t *ht, const void *key, const void *elt){
     num_probes++;
     if (num_probes > ht->max_num_probes) ht->max_num_probes++;
   }
-  fval -= fval & 1; /* 1st bit not used in hashing => 1 as ph identifier */
-  *ke = ke_new(ht, fval, sval, key, elt);
+  slot_set(ht, ke, ke_new(ht, fval, sval, key, elt));
   ht->num_elts++;
   /* max_sum < count; grow ht after ensuring it was insertion, not update */
   if (ht->num_elts + ht->num_phs > ht->max_sum){
@@ -342,7 +387,7 @@ void ht_muloa_remove(ht_muloa_t *ht, const void *key, void *elt){
     memcpy(elt, ke_elt_ptr(ht, *ke), ht->elt_size);
     /* if an element is noncontiguous, only the pointer to it is deleted */
     free(ke_key_ptr(ht, *ke));
-    *ke = ht->ph;
+    slot_set(ht, ke, ht->ph);
     ht->num_elts--;
     ht->num_phs++;
   }
@@ -357,12 +402,57 @@ void ht_muloa_delete(ht_muloa_t *ht, const void *key){
   ke_t **ke = search(ht, key);
   if (ke != NULL){
     ke_free(ht, *ke);
-    *ke = ht->ph;
+    slot_set(ht, ke, ht->ph);
     ht->num_elts--;
     ht->num_phs++;
   }
 }
 
+/**
+   Merges a source hash table into a destination hash table. If a key of
+   the source hash table is not in the destination hash table, the key and
+   its associated element are moved into the destination hash table
+   without reallocation and without recomputing hash values. Otherwise, the
+   element in the destination hash table is updated or reduced according to
+   rdc_elt. After the operation, the source hash table is freed and leaves
+   a block of size sizeof(ht_muloa_t) pointed to by the src parameter.
+   dst         : pointer to an initialized ht_muloa_t struct
+   src         : pointer to an initialized ht_muloa_t struct other than
+                 dst with the same key_size, elt_size, cmp_key, rdc_key,
+                 and elt_size block alignment as dst; the load factor upper
+                 bounds and counts of dst and src may differ
+   rdc_elt     : - NULL, if a key of src is in dst, the key-associated
+                 element in dst is updated to the element of src according
+                 to free_elt of dst, as in ht_muloa_insert
+                 - non-NULL, if a key of src is in dst, performs a
+                 reduction of the element in dst and the element of src;
+                 the result of the reduction is associated with the key in
+                 dst; the first argument points to an elt_size block in dst,
+                 the second argument points to an elt_size block in src,
+                 and the third argument is equal to elt_size; the element
+                 of src is then deleted according to free_elt of src
+*/
+void ht_muloa_merge(ht_muloa_t *dst,
+		    ht_muloa_t *src,
+		    void (*rdc_elt)(void *, const void *, size_t)){
+  size_t i;
+  ke_t * const *ke = NULL;
+  for (i = 0; i < src->count; i++){
+    ke = &src->key_elts[i];
+    if (*ke != NULL && !is_ph(*ke)){
+      merge_ke(dst, src, *ke, rdc_elt);
+    }
+  }
+  ph_free(src->ph);
+  key_elts_free(src, src->key_elts);
+  fvals_free(src, src->fvals);
+  src->num_elts = 0;
+  src->num_phs = 0;
+  src->ph = NULL;
+  src->key_elts = NULL;
+  src->fvals = NULL;
+}
+
 /**
    Frees a hash table and leaves a block of size sizeof(ht_muloa_t)
    pointed to by the ht parameter.
@@ -377,9 +467,11 @@ void ht_muloa_free(ht_muloa_t *ht){
     }
   }
   ph_free(ht->ph);
-  free(ht->key_elts);
+  key_elts_free(ht, ht->key_elts);
+  fvals_free(ht, ht->fvals);
   ht->ph = NULL;
   ht->key_elts = NULL;
+  ht->fvals = NULL;
 }
 
 /**
@@ -540,16 +632,17 @@ static ke_t **search(const ht_muloa_t *ht, const void *key){
   std_key = convert_std_key(ht, key);
   fval = ht->fprime * std_key; /* mod 2**FULL_BIT */
   sval = ht->sprime * std_key; /* mod 2**FULL_BIT */
+  fval -= fval & 1;
   ix = fval >> (C_FULL_BIT - ht->log_count);
   dist = adjust_dist(sval >> (C_FULL_BIT - ht->log_count));
   ke = &ht->key_elts[ix];
   while (*ke != NULL){
     if (ht->cmp_key != NULL && /* loop invariant */
-	!is_ph(*ke) &&
+	fval_eq(ht, ke, fval) &&
 	ht->cmp_key(ke_key_ptr(ht, *ke), key) == 0){
       return (ke_t **)ke;
     }else if (ht->cmp_key == NULL && /* loop invariant */
-	      !is_ph(*ke) &&
+	      fval_eq(ht, ke, fval) &&
 	      memcmp(ke_key_ptr(ht, *ke), key, ht->key_size) == 0){
       return (ke_t **)ke;
     }else if (num_probes == ht->max_num_probes){
@@ -563,6 +656,29 @@ static ke_t **search(const ht_muloa_t *ht, const void *key){
   return NULL;
 }
 
+/**
+   Tests if the non-NULL slot pointed to by ke holds a key element with
+   the first hash value fval, the first bit of which is cleared. Returns 0
+   if the slot holds a placeholder. If the fvals array is maintained, the
+   key element block is not accessed.
+*/
+static int fval_eq(const ht_muloa_t *ht, ke_t * const *ke, size_t fval){
+  if (ht->fvals != NULL){
+    return (ht->fvals[ke - ht->key_elts] == fval);
+  }else{
+    return ((*ke)->fval == fval);
+  }
+}
+
+/**
+   Sets the slot pointed to by ke to a key element or a placeholder, and
+   updates the fvals array if it is maintained.
+*/
+static void slot_set(ht_muloa_t *ht, ke_t **ke, ke_t *val){
+  *ke = val;
+  if (ht->fvals != NULL) ht->fvals[ke - ht->key_elts] = val->fval;
+}
+
 /**
    Multiplies an unsigned integer n by a load factor upper bound, represented
    by a numerator and log base 2 of a denominator. The denominator is a
@@ -589,23 +705,24 @@ static size_t mul_alpha(size_t n, size_t alpha_n, size_t log_alpha_d){
 */
 static void ht_grow(ht_muloa_t *ht){
   size_t i, prev_count = ht->count;
+  size_t *prev_fvals = ht->fvals;
   ke_t **prev_key_elts = ht->key_elts;
   ke_t * const *ke = NULL;
   while (ht->num_elts + ht->num_phs > ht->max_sum && incr_count(ht));
   ht->max_num_probes = 1;
   ht->num_phs = 0;
-  ht->key_elts = malloc_perror(ht->count, sizeof(ke_t *));
-  for (i = 0; i < ht->count; i++){
-    ht->key_elts[i] = NULL;
-  }
+  ht->key_elts = key_elts_new(ht);
+  if (prev_fvals != NULL) ht->fvals = fvals_new(ht);
   for (i = 0; i < prev_count; i++){
     ke = &prev_key_elts[i];
     if (*ke != NULL && !is_ph(*ke)){
       reinsert(ht, *ke);
     }
   }
-  free(prev_key_elts);
+  key_elts_free(ht, prev_key_elts);
+  fvals_free(ht, prev_fvals);
   prev_key_elts = NULL;
+  prev_fvals = NULL;
 }
 		      
 /**
@@ -632,22 +749,23 @@ static int incr_count(ht_muloa_t *ht){
 */
 static void ht_clean(ht_muloa_t *ht){
   size_t i;
+  size_t *prev_fvals = ht->fvals;
   ke_t **prev_key_elts = ht->key_elts;
   ke_t * const *ke = NULL;
   ht->max_num_probes = 1;
   ht->num_phs = 0;
-  ht->key_elts = malloc_perror(ht->count, sizeof(ke_t *));
-  for (i = 0; i < ht->count; i++){
-    ht->key_elts[i] = NULL;
-  }
+  ht->key_elts = key_elts_new(ht);
+  if (prev_fvals != NULL) ht->fvals = fvals_new(ht);
   for (i = 0; i < ht->count; i++){
     ke = &prev_key_elts[i];
     if (*ke != NULL && !is_ph(*ke)){
       reinsert(ht, *ke);
     }
   }
-  free(prev_key_elts);
+  key_elts_free(ht, prev_key_elts);
+  fvals_free(ht, prev_fvals);
   prev_key_elts = NULL;
+  prev_fvals = NULL;
 }
 
 /**
@@ -668,7 +786,108 @@ static void reinsert(ht_muloa_t *ht, const ke_t *prev_ke){
     num_probes++;
     if (num_probes > ht->max_num_probes) ht->max_num_probes++;
   }
-  *ke = (ke_t *)prev_ke;
+  slot_set(ht, ke, (ke_t *)prev_ke);
+}
+
+/**
+   Allocates an array of count pointers to ke_t, each set to NULL, according
+   to huge_page, and frees such an array.
+*/
+
+static ke_t **key_elts_new(const ht_muloa_t *ht){
+  size_t i;
+  ke_t **key_elts = NULL;
+  if (ht->huge_page){
+    key_elts = malloc_huge_perror(ht->count, sizeof(ke_t *));
+  }else{
+    key_elts = malloc_perror(ht->count, sizeof(ke_t *));
+  }
+  for (i = 0; i < ht->count; i++){
+    key_elts[i] = NULL;
+  }
+  return key_elts;
+}
+
+static void key_elts_free(const ht_muloa_t *ht, ke_t **key_elts){
+  if (ht->huge_page){
+    free_huge(key_elts);
+  }else{
+    free(key_elts);
+  }
+}
+
+/**
+   Allocates an array of count first hash values according to huge_page,
+   and frees such an array or NULL. A value in the array is only read if
+   the corresponding slot is not NULL.
+*/
+
+static size_t *fvals_new(const ht_muloa_t *ht){
+  if (ht->huge_page){
+    return malloc_huge_perror(ht->count, sizeof(size_t));
+  }else{
+    return malloc_perror(ht->count, sizeof(size_t));
+  }
+}
+
+static void fvals_free(const ht_muloa_t *ht, size_t *fvals){
+  if (ht->huge_page){
+    free_huge(fvals);
+  }else{
+    free(fvals);
+  }
+}
+
+/**
+   Merges a key element of a source hash table into a destination hash
+   table during a ht_muloa_merge operation. The hash values of the key
+   element are reused because the multiplication constants are the same
+   across hash tables on a given system. If the key is not in the
+   destination hash table, the key element block is moved, otherwise the
+   key element block is freed after the update or reduction of the element
+   in the destination hash table.
+*/
+static void merge_ke(ht_muloa_t *dst,
+		     const ht_muloa_t *src,
+		     ke_t *src_ke,
+		     void (*rdc_elt)(void *, const void *, size_t)){
+  size_t num_probes = 1;
+  size_t ix, dist;
+  const void *key = ke_key_ptr(src, src_ke);
+  ke_t **ke = NULL;
+  ix = src_ke->fval >> (C_FULL_BIT - dst->log_count);
+  dist = adjust_dist(src_ke->sval >> (C_FULL_BIT - dst->log_count));
+  ke = &dst->key_elts[ix];
+  while (*ke != NULL){
+    if (fval_eq(dst, ke, src_ke->fval) &&
+	((dst->cmp_key != NULL && /* loop invariant */
+	  dst->cmp_key(ke_key_ptr(dst, *ke), key) == 0) ||
+	 (dst->cmp_key == NULL && /* loop invariant */
+	  memcmp(ke_key_ptr(dst, *ke), key, dst->key_size) == 0))){
+      if (rdc_elt != NULL){
+	rdc_elt(ke_elt_ptr(dst, *ke), ke_elt_ptr(src, src_ke), dst->elt_size);
+	ke_free(src, src_ke);
+      }else{
+	ke_elt_update(dst, *ke, ke_elt_ptr(src, src_ke));
+	/* if an element is noncontiguous, only the pointer to it is freed */
+	free(ke_key_ptr(src, src_ke));
+      }
+      return;
+    }
+    ix = sum_mod(dist, ix, dst->count);
+    ke = &dst->key_elts[ix];
+    num_probes++;
+    if (num_probes > dst->max_num_probes) dst->max_num_probes++;
+  }
+  slot_set(dst, ke, src_ke);
+  dst->num_elts++;
+  if (dst->num_elts + dst->num_phs > dst->max_sum){
+    if (dst->num_elts < dst->num_phs){
+      ht_clean(dst);
+    }else if (dst->log_count < C_LOG_COUNT_MAX){
+      ht_grow(dst);
+    }
+  }
 }
 
 /**
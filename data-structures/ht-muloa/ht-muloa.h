@@ -71,8 +71,10 @@ typedef struct{
   size_t sprime; /* >2**(n - 1), <2**n, n = CHAR_BIT * sizeof(size_t) */
   size_t alpha_n;
   size_t log_alpha_d;
+  int huge_page; /* non-zero if key_elts is backed by huge pages */
   ke_t *ph;
   ke_t **key_elts;
+  size_t *fvals; /* NULL or fval of each non-NULL slot, ph's fval is 1 */
   int (*cmp_key)(const void *, const void *);
   size_t (*rdc_key)(const void *, size_t);
   void (*free_elt)(void *);
@@ -147,6 +149,31 @@ void ht_muloa_init(ht_muloa_t *ht,
 */
 void ht_muloa_align_elt(ht_muloa_t *ht, size_t alignment);
 
+/**
+   Backs the array of slots of a hash table with huge pages if the array is
+   at least as large as a huge page and huge pages are available on a given
+   system, thereby reducing TLB misses when probing a large hash table.
+   Otherwise regular pages are used. The operation is optionally called
+   after ht_muloa_init is completed and before any other operation is
+   called.
+   ht          : pointer to an initialized ht_muloa_t struct
+*/
+void ht_muloa_huge_page(ht_muloa_t *ht);
+
+/**
+   Maintains a dense array of the first hash values of the slots of a hash
+   table alongside the array of slots, in a structure of arrays layout.
+   A probe then only accesses the dense arrays, unless the first hash value
+   of the slot is equal to the first hash value of the searched key, in
+   which case the key and, if the key is found, its associated element are
+   accessed. The alignment of elements according to ht_muloa_align_elt is
+   preserved. The operation is optionally called after ht_muloa_init is
+   completed and before any other operation, except ht_muloa_align_elt and
+   ht_muloa_huge_page, is called.
+   ht          : pointer to an initialized ht_muloa_t struct
+*/
+void ht_muloa_fval_array(ht_muloa_t *ht);
+
 /**
    Inserts a key and an associated element into a hash table. If the key is
    in the hash table, associates the key with the new element. The key and 
@@ -179,6 +206,34 @@ void ht_muloa_remove(ht_muloa_t *ht, const void *key, void *elt);
 */
 void ht_muloa_delete(ht_muloa_t *ht, const void *key);
 
+/**
+   Merges a source hash table into a destination hash table. If a key of
+   the source hash table is not in the destination hash table, the key and
+   its associated element are moved into the destination hash table
+   without reallocation and without recomputing hash values. Otherwise, the
+   element in the destination hash table is updated or reduced according to
+   rdc_elt. After the operation, the source hash table is freed and leaves
+   a block of size sizeof(ht_muloa_t) pointed to by the src parameter.
+   dst         : pointer to an initialized ht_muloa_t struct
+   src         : pointer to an initialized ht_muloa_t struct other than
+                 dst with the same key_size, elt_size, cmp_key, rdc_key,
+                 and elt_size block alignment as dst; the load factor upper
+                 bounds and counts of dst and src may differ
+   rdc_elt     : - NULL, if a key of src is in dst, the key-associated
+                 element in dst is updated to the element of src according
+                 to free_elt of dst, as in ht_muloa_insert
+                 - non-NULL, if a key of src is in dst, performs a
+                 reduction of the element in dst and the element of src;
+                 the result of the reduction is associated with the key in
+                 dst; the first argument points to an elt_size block in dst,
+                 the second argument points to an elt_size block in src,
+                 and the third argument is equal to elt_size; the element
+                 of src is then deleted according to free_elt of src
+*/
+void ht_muloa_merge(ht_muloa_t *dst,
+		    ht_muloa_t *src,
+		    void (*rdc_elt)(void *, const void *, size_t));
+
 /**
    Frees a hash table and leaves a block of size sizeof(ht_muloa_t)
    pointed to by the ht parameter.
@@ -14,7 +14,7 @@
      [0, 1] : on/off for small graph tests
      [0, 1] : on/off for max edges test
      [0, 1] : on/off for no edges test
-     [0, 1] : on/off for random graph test
+     [0, 1] : on/off for random graph test (adj_lst, csr, cmp, uint)
 
    usage examples: 
    ./bfs-test
@@ -34,6 +34,7 @@
 #include <string.h>
 #include <limits.h>
 #include <time.h>
+#include <math.h>
 #include "bfs.h"
 #include "graph.h"
 #include "stack.h"
@@ -63,7 +64,7 @@ const char *C_USAGE =
   "[0, 1] : on/off for small graph tests \n"
   "[0, 1] : on/off for max edges test \n"
   "[0, 1] : on/off for no edges test \n"
-  "[0, 1] : on/off for random graph test \n";
+  "[0, 1] : on/off for random graph test (adj_lst, csr, cmp, uint) \n";
 const int C_ARGC_MAX = 11;
 const size_t C_ARGS_DEF[10] = {0, 14, 0, 14, 0, 14, 1, 1, 1, 1};
 const size_t C_FULL_BIT = CHAR_BIT * sizeof(size_t);
@@ -136,6 +137,7 @@ const double C_PROB_ZERO = 0.0;
 const size_t C_SIZE_MAX = (size_t)-1;
 
 int cmp_arr(const size_t *a, const size_t *b, size_t n);
+int cmp_arr_uint(const size_t *a, const unsigned int *b, size_t n);
 size_t pow_two(int k);
 void print_test_result(int res);
 
@@ -251,14 +253,27 @@ void small_graph_helper(const graph_t *g,
 
 typedef struct{
   double p;
-} bern_arg_t;
+  double log_q; /* log(1 - p) if 0 < p < 1 */
+} geom_arg_t;
 
-int bern(void *arg){
-  bern_arg_t *b = arg;
-  if (b->p >= C_PROB_ONE) return 1;
-  if (b->p <= C_PROB_ZERO) return 0;
-  if (b->p > DRAND()) return 1;
-  return 0;
+void geom_arg_init(geom_arg_t *g, double p){
+  g->p = p;
+  g->log_q = (p > C_PROB_ZERO && p < C_PROB_ONE) ? log(1.0 - p) : 0.0;
+}
+
+/**
+   Returns a geometric random variate as the number of failures before
+   the first success of Bernoulli trials with parameter p, i.e. the number
+   of possible edges skipped by adj_lst_rand_dir_skip.
+*/
+size_t geom(void *arg){
+  double x;
+  geom_arg_t *g = arg;
+  if (g->p >= C_PROB_ONE) return 0;
+  if (g->p <= C_PROB_ZERO) return C_SIZE_MAX;
+  x = floor(log((RANDOM() + 1.0) / (RAND_MAX + 1.0)) / g->log_q);
+  if (x >= (double)C_SIZE_MAX) return C_SIZE_MAX;
+  return x;
 }
 
 /**
@@ -269,17 +284,17 @@ void run_max_edges_graph_test(int pow_start, int pow_end){
   int i;
   size_t j, n, start;
   size_t *dist = NULL, *prev = NULL;
-  bern_arg_t b;
+  geom_arg_t b;
   adj_lst_t a;
   dist = malloc_perror(pow_two(pow_end), sizeof(size_t));
   prev = malloc_perror(pow_two(pow_end), sizeof(size_t));
-  b.p = C_PROB_ONE;
+  geom_arg_init(&b, C_PROB_ONE);
   printf("Run a bfs test on graphs with n vertices, where "
 	 "2^%d <= n <= 2^%d, and n(n - 1) edges --> ", pow_start, pow_end);
   fflush(stdout);
   for (i = pow_start; i <= pow_end; i++){
     n = pow_two(i); /* 0 < n */
-    adj_lst_rand_dir(&a, n, bern, &b);
+    adj_lst_rand_dir_skip(&a, n, geom, &b);
     start =  RANDOM() % n;
     bfs(&a, start, dist, prev);
     for (j = 0; j < n; j++){
@@ -307,17 +322,17 @@ void run_no_edges_graph_test(int pow_start, int pow_end){
   int i;
   size_t j, n, start;
   size_t *dist = NULL, *prev = NULL;
-  bern_arg_t b;
+  geom_arg_t b;
   adj_lst_t a;
   dist = malloc_perror(pow_two(pow_end), sizeof(size_t));
   prev = malloc_perror(pow_two(pow_end), sizeof(size_t));
-  b.p = C_PROB_ZERO;
+  geom_arg_init(&b, C_PROB_ZERO);
   printf("Run a bfs test on graphs with n vertices, where "
 	 "2^%d <= n <= 2^%d, and no edges --> ", pow_start, pow_end);
   fflush(stdout);
   for (i = pow_start; i <= pow_end; i++){
     n = pow_two(i); /* 0 < n */
-    adj_lst_rand_dir(&a, n, bern, &b);
+    adj_lst_rand_dir_skip(&a, n, geom, &b);
     start =  RANDOM() % n;
     bfs(&a, start, dist, prev);
     for (j = 0; j < n; j++){
@@ -338,28 +353,45 @@ void run_no_edges_graph_test(int pow_start, int pow_end){
 }
 
 /**
-   Runs a bfs test on random directed graphs.
+   Runs a bfs test on random directed graphs, on the adjacency list of each
+   graph, on its copy in CSR format, on its compressed copy, and on its
+   compact-id copy.
 */
 void run_random_dir_graph_test(int pow_start, int pow_end){
+  int res = 1;
   int i, j, k;
   size_t n;
   size_t *start = NULL;
   size_t *dist = NULL, *prev = NULL;
-  bern_arg_t b;
-  adj_lst_t a;
-  clock_t t;
+  size_t *dist_csr = NULL, *prev_csr = NULL;
+  size_t *dist_cmp = NULL, *prev_cmp = NULL;
+  unsigned int *dist_uint = NULL, *prev_uint = NULL;
+  geom_arg_t b;
+  adj_lst_t a, a_csr;
+  adj_cmp_t c;
+  adj_uint_t a_uint;
+  clock_t t, t_csr, t_cmp, t_uint;
   start = malloc_perror(C_ITER, sizeof(size_t));
   dist = malloc_perror(pow_two(pow_end), sizeof(size_t));
   prev = malloc_perror(pow_two(pow_end), sizeof(size_t));
+  dist_csr = malloc_perror(pow_two(pow_end), sizeof(size_t));
+  prev_csr = malloc_perror(pow_two(pow_end), sizeof(size_t));
+  dist_cmp = malloc_perror(pow_two(pow_end), sizeof(size_t));
+  prev_cmp = malloc_perror(pow_two(pow_end), sizeof(size_t));
+  dist_uint = malloc_perror(pow_two(pow_end), sizeof(unsigned int));
+  prev_uint = malloc_perror(pow_two(pow_end), sizeof(unsigned int));
   printf("Run a bfs test on random directed graphs, from %d random "
 	 "start vertices in each graph \n", C_ITER);
   fflush(stdout);
   for (i = 0; i < C_PROBS_COUNT; i++){
-    b.p = C_PROBS[i];
+    geom_arg_init(&b, C_PROBS[i]);
     printf("\tP[an edge is in a graph] = %.2f\n", b.p);
     for (j = pow_start; j <= pow_end; j++){
       n = pow_two(j); /* 0 < n */
-      adj_lst_rand_dir(&a, n, bern, &b);
+      adj_lst_rand_dir_skip(&a, n, geom, &b);
+      adj_lst_csr_copy(&a_csr, &a);
+      adj_cmp_copy(&c, &a);
+      adj_uint_copy(&a_uint, &a);
       for (k = 0; k < C_ITER; k++){
 	start[k] =  RANDOM() % n;
       }
@@ -368,19 +400,65 @@ void run_random_dir_graph_test(int pow_start, int pow_end){
 	bfs(&a, start[k], dist, prev);
       }
       t = clock() - t;
-      printf("\t\tvertices: %lu, E[# of directed edges]: %.1f, "
-	     "average runtime: %.6f seconds\n",
-	     TOLU(n), b.p * n * (n - 1), (float)t / C_ITER / CLOCKS_PER_SEC);
+      t_csr = clock();
+      for (k = 0; k < C_ITER; k++){
+	bfs(&a_csr, start[k], dist_csr, prev_csr);
+      }
+      t_csr = clock() - t_csr;
+      t_cmp = clock();
+      for (k = 0; k < C_ITER; k++){
+	bfs_cmp(&c, start[k], dist_cmp, prev_cmp);
+      }
+      t_cmp = clock() - t_cmp;
+      t_uint = clock();
+      for (k = 0; k < C_ITER; k++){
+	bfs_uint(&a_uint, start[k], dist_uint, prev_uint);
+      }
+      t_uint = clock() - t_uint;
+      /* the last start vertex */
+      res *= cmp_arr(dist, dist_csr, n);
+      res *= cmp_arr(prev, prev_csr, n);
+      res *= cmp_arr(dist, dist_cmp, n);
+      res *= cmp_arr(prev, prev_cmp, n);
+      res *= cmp_arr_uint(dist, dist_uint, n);
+      res *= cmp_arr_uint(prev, prev_uint, n);
+      printf("\t\tvertices: %lu, E[# of directed edges]: %.1f\n"
+	     "\t\t\tadj_lst ave runtime:     %.6f seconds\n"
+	     "\t\t\tadj_lst csr ave runtime: %.6f seconds\n"
+	     "\t\t\tadj_cmp ave runtime:     %.6f seconds\n"
+	     "\t\t\tadj_uint ave runtime:    %.6f seconds\n",
+	     TOLU(n), b.p * n * (n - 1),
+	     (float)t / C_ITER / CLOCKS_PER_SEC,
+	     (float)t_csr / C_ITER / CLOCKS_PER_SEC,
+	     (float)t_cmp / C_ITER / CLOCKS_PER_SEC,
+	     (float)t_uint / C_ITER / CLOCKS_PER_SEC);
       fflush(stdout);
       adj_lst_free(&a);
+      adj_lst_free(&a_csr);
+      adj_cmp_free(&c);
+      adj_uint_free(&a_uint);
     }
   }
+  printf("\tcorrectness of csr, cmp, and uint across all tests --> ");
+  print_test_result(res);
   free(start);
   free(dist);
   free(prev);
+  free(dist_csr);
+  free(prev_csr);
+  free(dist_cmp);
+  free(prev_cmp);
+  free(dist_uint);
+  free(prev_uint);
   start = NULL;
   dist = NULL;
   prev = NULL;
+  dist_csr = NULL;
+  prev_csr = NULL;
+  dist_cmp = NULL;
+  prev_cmp = NULL;
+  dist_uint = NULL;
+  prev_uint = NULL;
 }
 
 /**
@@ -399,6 +477,19 @@ int cmp_arr(const size_t *a, const size_t *b, size_t n){
   return res;
 }
 
+/**
+   Compares the elements of a size_t array and an unsigned int array, where
+   the maximal values of the types are equal.
+*/
+int cmp_arr_uint(const size_t *a, const unsigned int *b, size_t n){
+  int res = 1;
+  size_t i;
+  for (i = 0; i < n; i++){
+    res *= (a[i] == ((b[i] == UINT_MAX) ? (size_t)-1 : b[i]));
+  }
+  return res;
+}
+
 /**
    Returns the kth power of 2, where 0 <= k <= CHAR_BIT * sizeof(size_t) - 1.
 */
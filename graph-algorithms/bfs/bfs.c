@@ -14,6 +14,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 #include "bfs.h"
 #include "graph.h"
 #include "queue.h"
@@ -48,8 +49,8 @@ void bfs(const adj_lst_t *a, size_t start, size_t *dist, size_t *prev){
   queue_push(&q, &start);
   while (q.num_elts > 0){
     queue_pop(&q, &u);
-    p_start = a->vt_wts[u]->elts;
-    p_end = p_start + a->vt_wts[u]->num_elts * a->pair_size;
+    p_start = adj_lst_vt_pairs(a, u);
+    p_end = p_start + adj_lst_vt_num_pairs(a, u) * a->pair_size;
     for (p = p_start; p != p_end; p += a->pair_size){
       v = *(const size_t *)p;
       if (prev[v] == NR){
@@ -61,3 +62,66 @@ void bfs(const adj_lst_t *a, size_t start, size_t *dist, size_t *prev){
   }
   queue_free(&q);
 }
+
+/**
+   Runs bfs on a compressed adjacency list, visiting the neighbors of each
+   vertex in the increasing order. The parameters are specified in bfs.
+*/
+void bfs_cmp(const adj_cmp_t *c, size_t start, size_t *dist, size_t *prev){
+  size_t u, v;
+  size_t vt_size = sizeof(size_t);
+  adj_cmp_iter_t it;
+  queue_t q;
+  memset(dist, 0, c->num_vts * vt_size);
+  memset(prev, 0xff, c->num_vts * vt_size); /* initialize to NR */
+  queue_init(&q, QUEUE_INIT_COUNT, vt_size, NULL);
+  prev[start] = start;
+  queue_push(&q, &start);
+  while (q.num_elts > 0){
+    queue_pop(&q, &u);
+    adj_cmp_iter_init(&it, c, u);
+    while (adj_cmp_iter_next(&it, &v)){
+      if (prev[v] == NR){
+	dist[v] = dist[u] + 1;
+	prev[v] = u;
+	queue_push(&q, &v);
+      }
+    }
+  }
+  queue_free(&q);
+}
+
+/**
+   Runs bfs on a compact-id adjacency list with unsigned int dist and prev
+   arrays, and UINT_MAX in the prev array for unreached vertices. The
+   parameters are specified in bfs.
+*/
+void bfs_uint(const adj_uint_t *a,
+	      size_t start,
+	      unsigned int *dist,
+	      unsigned int *prev){
+  const char *p = NULL, *p_start = NULL, *p_end = NULL;
+  unsigned int u, v;
+  size_t vt_size = sizeof(unsigned int);
+  queue_t q;
+  memset(dist, 0, a->num_vts * vt_size);
+  memset(prev, 0xff, a->num_vts * vt_size); /* initialize to UINT_MAX */
+  queue_init(&q, QUEUE_INIT_COUNT, vt_size, NULL);
+  u = start;
+  prev[u] = u;
+  queue_push(&q, &u);
+  while (q.num_elts > 0){
+    queue_pop(&q, &u);
+    p_start = adj_uint_vt_pairs(a, u);
+    p_end = p_start + adj_uint_vt_num_pairs(a, u) * a->pair_size;
+    for (p = p_start; p != p_end; p += a->pair_size){
+      v = *(const unsigned int *)p;
+      if (prev[v] == UINT_MAX){
+	dist[v] = dist[u] + 1;
+	prev[v] = u;
+	queue_push(&q, p);
+      }
+    }
+  }
+  queue_free(&q);
+}
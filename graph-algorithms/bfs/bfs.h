@@ -26,4 +26,20 @@
 */
 void bfs(const adj_lst_t *a, size_t start, size_t *dist, size_t *prev);
 
+/**
+   Runs bfs on a compressed adjacency list, visiting the neighbors of each
+   vertex in the increasing order. The parameters are specified in bfs.
+*/
+void bfs_cmp(const adj_cmp_t *c, size_t start, size_t *dist, size_t *prev);
+
+/**
+   Runs bfs on a compact-id adjacency list with unsigned int dist and prev
+   arrays, and UINT_MAX in the prev array for unreached vertices. The
+   parameters are specified in bfs.
+*/
+void bfs_uint(const adj_uint_t *a,
+	      size_t start,
+	      unsigned int *dist,
+	      unsigned int *prev);
+
 #endif
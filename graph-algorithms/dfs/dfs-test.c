@@ -14,7 +14,7 @@
      [0, 1] : on/off for small graph tests
      [0, 1] : on/off for max edges test
      [0, 1] : on/off for no edges test
-     [0, 1] : on/off for random graph test
+     [0, 1] : on/off for random graph test (adj_lst, csr, cmp, uint)
 
    usage examples: 
    ./dfs-test
@@ -51,7 +51,7 @@ const char *C_USAGE =
   "[0, 1] : on/off for small graph tests \n"
   "[0, 1] : on/off for max edges test \n"
   "[0, 1] : on/off for no edges test \n"
-  "[0, 1] : on/off for random graph test \n";
+  "[0, 1] : on/off for random graph test (adj_lst, csr, cmp, uint) \n";
 const int C_ARGC_MAX = 11;
 const size_t C_ARGS_DEF[10] = {0, 14, 0, 14, 0, 14, 1, 1, 1, 1};
 const size_t C_FULL_BIT = CHAR_BIT * sizeof(size_t);
@@ -97,6 +97,7 @@ const double C_PROB_ZERO = 0.0;
 #define TOLU(i) ((unsigned long int)(i)) /* printing size_t under C89/C90 */
 
 int cmp_arr(const size_t *a, const size_t *b, size_t n);
+int cmp_arr_uint(const size_t *a, const unsigned int *b, size_t n);
 size_t pow_two(int k);
 void print_test_result(int res);
 
@@ -306,28 +307,45 @@ void run_no_edges_graph_test(int pow_start, int pow_end){
 }
 
 /**
-   Runs a dfs test on random directed graphs.
+   Runs a dfs test on random directed graphs, on the adjacency list of each
+   graph, on its copy in CSR format, on its compressed copy, and on its
+   compact-id copy.
 */
 void run_random_dir_graph_test(int pow_start, int pow_end){
+  int res = 1;
   int i, j, k;
   size_t n;
   size_t *start = NULL;
   size_t *pre = NULL, *post = NULL;
+  size_t *pre_csr = NULL, *post_csr = NULL;
+  size_t *pre_cmp = NULL, *post_cmp = NULL;
+  unsigned int *pre_uint = NULL, *post_uint = NULL;
   bern_arg_t b;
-  adj_lst_t a;
-  clock_t t;
+  adj_lst_t a, a_csr;
+  adj_cmp_t c;
+  adj_uint_t a_uint;
+  clock_t t, t_csr, t_cmp, t_uint;
   printf("Run a dfs test on random directed graphs from %d random "
 	 "start vertices in each graph \n", C_ITER);
   fflush(stdout);
   start = malloc_perror(C_ITER, sizeof(size_t));
   pre = malloc_perror(pow_two(pow_end), sizeof(size_t));
   post = malloc_perror(pow_two(pow_end), sizeof(size_t));
+  pre_csr = malloc_perror(pow_two(pow_end), sizeof(size_t));
+  post_csr = malloc_perror(pow_two(pow_end), sizeof(size_t));
+  pre_cmp = malloc_perror(pow_two(pow_end), sizeof(size_t));
+  post_cmp = malloc_perror(pow_two(pow_end), sizeof(size_t));
+  pre_uint = malloc_perror(pow_two(pow_end), sizeof(unsigned int));
+  post_uint = malloc_perror(pow_two(pow_end), sizeof(unsigned int));
   for (i = 0; i < C_PROBS_COUNT; i++){
     b.p = C_PROBS[i];
     printf("\tP[an edge is in a graph] = %.2f\n", b.p);
     for (j = pow_start; j <= pow_end; j++){
       n = pow_two(j);
       adj_lst_rand_dir(&a, n, bern, &b);
+      adj_lst_csr_copy(&a_csr, &a);
+      adj_cmp_copy(&c, &a);
+      adj_uint_copy(&a_uint, &a);
       for (k = 0; k < C_ITER; k++){
 	start[k] =  RANDOM() % n;
       }
@@ -336,19 +354,65 @@ void run_random_dir_graph_test(int pow_start, int pow_end){
 	dfs(&a, start[k], pre, post);
       }
       t = clock() - t;
-      printf("\t\tvertices: %lu, E[# of directed edges]: %.1f, "
-	     "average runtime: %.6f seconds\n",
-	     TOLU(n), b.p * n * (n - 1), (float)t / C_ITER / CLOCKS_PER_SEC);
+      t_csr = clock();
+      for (k = 0; k < C_ITER; k++){
+	dfs(&a_csr, start[k], pre_csr, post_csr);
+      }
+      t_csr = clock() - t_csr;
+      t_cmp = clock();
+      for (k = 0; k < C_ITER; k++){
+	dfs_cmp(&c, start[k], pre_cmp, post_cmp);
+      }
+      t_cmp = clock() - t_cmp;
+      t_uint = clock();
+      for (k = 0; k < C_ITER; k++){
+	dfs_uint(&a_uint, start[k], pre_uint, post_uint);
+      }
+      t_uint = clock() - t_uint;
+      /* the last start vertex */
+      res *= cmp_arr(pre, pre_csr, n);
+      res *= cmp_arr(post, post_csr, n);
+      res *= cmp_arr(pre, pre_cmp, n);
+      res *= cmp_arr(post, post_cmp, n);
+      res *= cmp_arr_uint(pre, pre_uint, n);
+      res *= cmp_arr_uint(post, post_uint, n);
+      printf("\t\tvertices: %lu, E[# of directed edges]: %.1f\n"
+	     "\t\t\tadj_lst ave runtime:     %.6f seconds\n"
+	     "\t\t\tadj_lst csr ave runtime: %.6f seconds\n"
+	     "\t\t\tadj_cmp ave runtime:     %.6f seconds\n"
+	     "\t\t\tadj_uint ave runtime:    %.6f seconds\n",
+	     TOLU(n), b.p * n * (n - 1),
+	     (float)t / C_ITER / CLOCKS_PER_SEC,
+	     (float)t_csr / C_ITER / CLOCKS_PER_SEC,
+	     (float)t_cmp / C_ITER / CLOCKS_PER_SEC,
+	     (float)t_uint / C_ITER / CLOCKS_PER_SEC);
       fflush(stdout);
       adj_lst_free(&a);
+      adj_lst_free(&a_csr);
+      adj_cmp_free(&c);
+      adj_uint_free(&a_uint);
     }
   }
+  printf("\tcorrectness of csr, cmp, and uint across all tests --> ");
+  print_test_result(res);
   free(start);
   free(pre);
   free(post);
+  free(pre_csr);
+  free(post_csr);
+  free(pre_cmp);
+  free(post_cmp);
+  free(pre_uint);
+  free(post_uint);
   start = NULL;
   pre = NULL;
   post = NULL;
+  pre_csr = NULL;
+  post_csr = NULL;
+  pre_cmp = NULL;
+  post_cmp = NULL;
+  pre_uint = NULL;
+  post_uint = NULL;
 }
 
 
@@ -368,6 +432,19 @@ int cmp_arr(const size_t *a, const size_t *b, size_t n){
   return res;
 }
 
+/**
+   Compares the elements of a size_t array and an unsigned int array, where
+   the maximal values of the types are equal.
+*/
+int cmp_arr_uint(const size_t *a, const unsigned int *b, size_t n){
+  int res = 1;
+  size_t i;
+  for (i = 0; i < n; i++){
+    res *= (a[i] == ((b[i] == UINT_MAX) ? (size_t)-1 : b[i]));
+  }
+  return res;
+}
+
 /**
    Returns the kth power of 2, where 0 <= k <= CHAR_BIT * sizeof(size_t) - 1.
 */
@@ -11,6 +11,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 #include "dfs.h"
 #include "graph.h"
 #include "stack.h"
@@ -21,6 +22,17 @@ typedef struct{
   const char *vp_end; /* pointer to the end of u's stack */
 } uvp_t;
 
+typedef struct{
+  size_t u;
+  adj_cmp_iter_t it; /* iterator across u's list in a compressed list */
+} uvi_t;
+
+typedef struct{
+  unsigned int u;
+  const char *vp; /* vp is pointer to v in u's list in a compact-id list */
+  const char *vp_end;
+} uvp_uint_t;
+
 static void search(const adj_lst_t *a,
 		   stack_t *s,
 		   size_t u,
@@ -28,6 +40,18 @@ static void search(const adj_lst_t *a,
 		   size_t *pre,
 		   size_t *post);
 static void move_uvp(const adj_lst_t *a, uvp_t *uvp, const size_t *pre);
+static void search_cmp(const adj_cmp_t *c,
+		       stack_t *s,
+		       size_t u,
+		       size_t *cnt,
+		       size_t *pre,
+		       size_t *post);
+static void search_uint(const adj_uint_t *a,
+			stack_t *s,
+			unsigned int u,
+			unsigned int *c,
+			unsigned int *pre,
+			unsigned int *post);
 
 static const size_t NR = (size_t)-1; /* not reached as index */
 static const size_t STACK_INIT_COUNT = 1;
@@ -64,6 +88,64 @@ void dfs(const adj_lst_t *a, size_t start, size_t *pre, size_t *post){
   stack_free(&s);
 }
 
+/**
+   Runs dfs on a compressed adjacency list, visiting the neighbors of each
+   vertex in the increasing order. The parameters are specified in dfs.
+*/
+void dfs_cmp(const adj_cmp_t *c, size_t start, size_t *pre, size_t *post){
+  size_t cnt = 0; /* counter */
+  size_t vt_size = sizeof(size_t);
+  size_t i;
+  stack_t s;
+  memset(pre, 0xff, c->num_vts * vt_size); /* initialize both arrays to NR */
+  memset(post, 0xff, c->num_vts * vt_size);
+  stack_init(&s, STACK_INIT_COUNT, sizeof(uvi_t), NULL);
+  for (i = start; i < c->num_vts; i++){
+    if (pre[i] == NR){
+      search_cmp(c, &s, i, &cnt, pre, post);
+    }
+  }
+  for (i = 0; i < start; i++){
+    if (pre[i] == NR){
+      search_cmp(c, &s, i, &cnt, pre, post);
+    }
+  }
+  stack_free(&s);
+}
+
+/**
+   Runs dfs on a compact-id adjacency list with unsigned int pre and post
+   arrays. Exits with an error message if twice the number of vertices is
+   greater than UINT_MAX. The parameters are specified in dfs.
+*/
+void dfs_uint(const adj_uint_t *a,
+	      size_t start,
+	      unsigned int *pre,
+	      unsigned int *post){
+  unsigned int c = 0; /* counter */
+  size_t vt_size = sizeof(unsigned int);
+  size_t i;
+  stack_t s;
+  if (a->num_vts > UINT_MAX / 2){
+    fprintf(stderr, "dfs_uint: 2 * number of vertices > UINT_MAX\n");
+    exit(EXIT_FAILURE);
+  }
+  memset(pre, 0xff, a->num_vts * vt_size); /* initialize both to UINT_MAX */
+  memset(post, 0xff, a->num_vts * vt_size);
+  stack_init(&s, STACK_INIT_COUNT, sizeof(uvp_uint_t), NULL);
+  for (i = start; i < a->num_vts; i++){
+    if (pre[i] == UINT_MAX){
+      search_uint(a, &s, i, &c, pre, post);
+    }
+  }
+  for (i = 0; i < start; i++){
+    if (pre[i] == UINT_MAX){
+      search_uint(a, &s, i, &c, pre, post);
+    }
+  }
+  stack_free(&s);
+}
+
 /**
    Performs a DFS search of a graph component reachable from an unexplored
    vertex provided by the u parameter by emulating the recursion in DFS on
@@ -79,8 +161,8 @@ static void search(const adj_lst_t *a,
   pre[u] = *c;
   (*c)++;
   uvp.u = u;
-  uvp.vp = a->vt_wts[uvp.u]->elts;
-  uvp.vp_end = uvp.vp + a->vt_wts[uvp.u]->num_elts * a->pair_size;
+  uvp.vp = adj_lst_vt_pairs(a, uvp.u);
+  uvp.vp_end = uvp.vp + adj_lst_vt_num_pairs(a, uvp.u) * a->pair_size;
   stack_push(s, &uvp);
   while (s->num_elts > 0){
     stack_pop(s, &uvp);
@@ -93,8 +175,8 @@ static void search(const adj_lst_t *a,
       pre[*(const size_t *)uvp.vp] = *c;
       (*c)++;
       uvp.u = *(const size_t *)uvp.vp;
-      uvp.vp = a->vt_wts[uvp.u]->elts;
-      uvp.vp_end = uvp.vp + a->vt_wts[uvp.u]->num_elts * a->pair_size;
+      uvp.vp = adj_lst_vt_pairs(a, uvp.u);
+      uvp.vp_end = uvp.vp + adj_lst_vt_num_pairs(a, uvp.u) * a->pair_size;
       stack_push(s, &uvp); /* then push an unexplored vertex */
     }
   }
@@ -114,3 +196,77 @@ static void move_uvp(const adj_lst_t *a, uvp_t *uvp, const size_t *pre){
   }
   uvp->vp = uvp->vp_end;
 }
+
+/**
+   Performs a DFS search of a graph component reachable from an unexplored
+   vertex u in a compressed adjacency list. The iterator of a vertex on the
+   stack is resumed after the return from an explored neighbor.
+*/
+static void search_cmp(const adj_cmp_t *c,
+		       stack_t *s,
+		       size_t u,
+		       size_t *cnt,
+		       size_t *pre,
+		       size_t *post){
+  int found;
+  size_t v = 0;
+  uvi_t uvi;
+  pre[u] = *cnt;
+  (*cnt)++;
+  uvi.u = u;
+  adj_cmp_iter_init(&uvi.it, c, u);
+  stack_push(s, &uvi);
+  while (s->num_elts > 0){
+    stack_pop(s, &uvi);
+    while ((found = adj_cmp_iter_next(&uvi.it, &v)) && pre[v] != NR);
+    if (!found){
+      post[uvi.u] = *cnt;
+      (*cnt)++;
+    }else{
+      stack_push(s, &uvi); /* push the unfinished vertex */
+      pre[v] = *cnt;
+      (*cnt)++;
+      uvi.u = v;
+      adj_cmp_iter_init(&uvi.it, c, v);
+      stack_push(s, &uvi); /* then push an unexplored vertex */
+    }
+  }
+}
+
+/**
+   Performs a DFS search of a graph component reachable from an unexplored
+   vertex u in a compact-id adjacency list.
+*/
+static void search_uint(const adj_uint_t *a,
+			stack_t *s,
+			unsigned int u,
+			unsigned int *c,
+			unsigned int *pre,
+			unsigned int *post){
+  uvp_uint_t uvp;
+  pre[u] = *c;
+  (*c)++;
+  uvp.u = u;
+  uvp.vp = adj_uint_vt_pairs(a, uvp.u);
+  uvp.vp_end = uvp.vp + adj_uint_vt_num_pairs(a, uvp.u) * a->pair_size;
+  stack_push(s, &uvp);
+  while (s->num_elts > 0){
+    stack_pop(s, &uvp);
+    while (uvp.vp != uvp.vp_end &&
+	   pre[*(const unsigned int *)uvp.vp] != UINT_MAX){
+      uvp.vp += a->pair_size;
+    }
+    if (uvp.vp == uvp.vp_end){
+      post[uvp.u] = *c;
+      (*c)++;
+    }else{
+      stack_push(s, &uvp); /* push the unfinished vertex */
+      pre[*(const unsigned int *)uvp.vp] = *c;
+      (*c)++;
+      uvp.u = *(const unsigned int *)uvp.vp;
+      uvp.vp = adj_uint_vt_pairs(a, uvp.u);
+      uvp.vp_end = uvp.vp + adj_uint_vt_num_pairs(a, uvp.u) * a->pair_size;
+      stack_push(s, &uvp); /* then push an unexplored vertex */
+    }
+  }
+}
@@ -27,4 +27,20 @@
 */
 void dfs(const adj_lst_t *a, size_t start, size_t *pre, size_t *post);
 
+/**
+   Runs dfs on a compressed adjacency list, visiting the neighbors of each
+   vertex in the increasing order. The parameters are specified in dfs.
+*/
+void dfs_cmp(const adj_cmp_t *c, size_t start, size_t *pre, size_t *post);
+
+/**
+   Runs dfs on a compact-id adjacency list with unsigned int pre and post
+   arrays. Exits with an error message if twice the number of vertices is
+   greater than UINT_MAX. The parameters are specified in dfs.
+*/
+void dfs_uint(const adj_uint_t *a,
+	      size_t start,
+	      unsigned int *pre,
+	      unsigned int *post);
+
 #endif
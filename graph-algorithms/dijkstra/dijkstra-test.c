@@ -2,8 +2,8 @@
    dijkstra-test.c
 
    Tests of Dijkstra's algorithm with a hash table parameter across
-   i) default, division-based and multiplication-based hash tables, and ii)
-   edge weight types.
+   i) default, division-based and multiplication-based hash tables, ii)
+   edge weight types, and iii) a binary heap and a radix heap.
 
    The following command line arguments can be used to customize tests:
    dijkstra-test:
@@ -12,11 +12,13 @@
    -  [0, 1] : small graph test on/off
    -  [0, 1] : bfs comparison test on/off
    -  [0, 1] : test on random graphs with random size_t weights on/off
+   -  [0, 1] : test on random graphs with small random size_t weights on/off
 
    usage examples: 
    ./dijkstra-test
    ./dijkstra-test 10 14
    ./dijkstra-test 14 14 0 0 1
+   ./dijkstra-test 14 14 0 0 0 1
 
    dijkstra-test can be run with any subset of command line arguments in the
    above-defined order. If the (i + 1)th argument is specified then the ith
@@ -34,6 +36,7 @@
 #include <string.h>
 #include <limits.h>
 #include <time.h>
+#include <math.h>
 #include "dijkstra.h"
 #include "bfs.h"
 #include "heap.h"
@@ -63,9 +66,10 @@ const char *C_USAGE =
   "[0, # bits in size_t / 2] : n for 2^n vertices in largest graph\n"
   "[0, 1] : small graph test on/off\n"
   "[0, 1] : bfs comparison test on/off\n"
-  "[0, 1] : random graphs with random size_t weights test on/off\n";
-const int C_ARGC_MAX = 6;
-const size_t C_ARGS_DEF[5] = {0, 10, 1, 1, 1};
+  "[0, 1] : random graphs with random size_t weights test on/off\n"
+  "[0, 1] : random graphs with small random size_t weights test on/off\n";
+const int C_ARGC_MAX = 7;
+const size_t C_ARGS_DEF[6] = {0, 10, 1, 1, 1, 1};
 
 /* hash table load factor upper bounds */
 const size_t C_ALPHA_N_DIVCHN = 1;
@@ -91,6 +95,8 @@ const size_t C_FULL_BIT = CHAR_BIT * sizeof(size_t);
 const size_t C_SIZE_MAX = (size_t)-1;
 const size_t C_WEIGHT_HIGH = ((size_t)-1 >>
 			      ((CHAR_BIT * sizeof(size_t) + 1) / 2));
+const size_t C_SMALL_WEIGHT_LOW = 1;
+const size_t C_SMALL_WEIGHT_HIGH = 16;
 
 void print_uint(const void *a);
 void print_double(const void *a);
@@ -139,6 +145,10 @@ int cmp_uint(const void *a, const void *b){
   }
 }
 
+size_t read_uint(const void *wt){
+  return *(const size_t *)wt;
+}
+
 typedef struct{
   size_t alpha_n;
   size_t log_alpha_d;
@@ -161,6 +171,8 @@ void ht_divchn_init_helper(ht_divchn_t *ht,
 		 0,
 		 c->alpha_n,
 		 c->log_alpha_d,
+		 NULL,
+		 NULL,
 		 free_elt);
 }
 
@@ -177,6 +189,7 @@ void ht_muloa_init_helper(ht_muloa_t *ht,
 		c->alpha_n,
 		c->log_alpha_d,
 		NULL,
+		NULL,
 		free_elt);
 }
 
@@ -266,7 +279,7 @@ void run_uint_graph_test(){
   adj_lst_t a;
   graph_uint_wts_init(&g);
   printf("Running a test on a directed size_t graph with a \n"
-	 "i) default hash table (index array) \n"
+	 "i) dense index mode (position array) \n"
 	 "ii) ht_divchn_t hash table \n"
 	 "iii) ht_muloa_t hash table \n\n");
   adj_lst_init(&a, &g);
@@ -277,7 +290,7 @@ void run_uint_graph_test(){
   run_muloa_uint_dijkstra(&a);
   adj_lst_free(&a);
   printf("Running a test on an undirected size_t graph with a \n"
-	 "i) default hash table (index array) \n"
+	 "i) dense index mode (position array) \n"
 	 "ii) ht_divchn_t hash table \n"
 	 "iii) ht_muloa_t hash table \n\n");
   adj_lst_init(&a, &g);
@@ -287,11 +300,19 @@ void run_uint_graph_test(){
   run_divchn_uint_dijkstra(&a);
   run_muloa_uint_dijkstra(&a);
   adj_lst_free(&a);
+  printf("Running a test on directed and undirected size_t graphs in "
+	 "CSR format with a dense index mode (position array) \n\n");
+  adj_lst_csr_dir_build(&a, &g);
+  run_default_uint_dijkstra(&a);
+  adj_lst_free(&a);
+  adj_lst_csr_undir_build(&a, &g);
+  run_default_uint_dijkstra(&a);
+  adj_lst_free(&a);
   graph_free(&g);
   graph_uint_wts_no_edges_init(&g);
   printf("Running a test on a directed size_t graph with no edges, "
 	 "with a \n"
-	 "i) default hash table (index array) \n"
+	 "i) dense index mode (position array) \n"
 	 "ii) ht_divchn_t hash table \n"
 	 "iii) ht_muloa_t hash table \n\n");
   adj_lst_init(&a, &g);
@@ -303,7 +324,7 @@ void run_uint_graph_test(){
   adj_lst_free(&a);
   printf("Running a test on a undirected size_t graph with no edges, "
 	 "with a \n"
-	 "i) default hash table (index array) \n"
+	 "i) dense index mode (position array) \n"
 	 "ii) ht_divchn_t hash table \n"
 	 "iii) ht_muloa_t hash table \n\n");
   adj_lst_init(&a, &g);
@@ -442,7 +463,7 @@ void run_double_graph_test(){
   adj_lst_t a;
   graph_double_wts_init(&g);
   printf("Running a test on a directed double graph with a \n"
-	 "i) default hash table (index array) \n"
+	 "i) dense index mode (position array) \n"
 	 "ii) ht_divchn_t hash table \n"
 	 "iii) ht_muloa_t hash table \n\n");
   adj_lst_init(&a, &g);
@@ -453,7 +474,7 @@ void run_double_graph_test(){
   run_muloa_double_dijkstra(&a);
   adj_lst_free(&a);
   printf("Running a test on an undirected double graph with a \n"
-	 "i) default hash table (index array) \n"
+	 "i) dense index mode (position array) \n"
 	 "ii) ht_divchn_t hash table \n"
 	 "iii) ht_muloa_t hash table \n\n");
   adj_lst_init(&a, &g);
@@ -466,7 +487,7 @@ void run_double_graph_test(){
   graph_free(&g);
   graph_double_wts_no_edges_init(&g);
   printf("Running a test on a directed double graph with no edges, with a \n"
-	 "i) default hash table (index array) \n"
+	 "i) dense index mode (position array) \n"
 	 "ii) ht_divchn_t hash table \n"
 	 "iii) ht_muloa_t hash table \n\n");
   adj_lst_init(&a, &g);
@@ -478,7 +499,7 @@ void run_double_graph_test(){
   adj_lst_free(&a);
   printf("Running a test on a undirected double graph with no edges, "
 	 "with a \n"
-	 "i) default hash table (index array) \n"
+	 "i) dense index mode (position array) \n"
 	 "ii) ht_divchn_t hash table \n"
 	 "iii) ht_muloa_t hash table \n\n");
   adj_lst_init(&a, &g);
@@ -498,14 +519,32 @@ void run_double_graph_test(){
 
 typedef struct{
   double p;
-} bern_arg_t;
+  double log_q; /* log(1 - p) if 0 < p < 1 */
+} geom_arg_t;
 
-int bern(void *arg){
-  bern_arg_t *b = arg;
-  if (b->p >= 1.0) return 1;
-  if (b->p <= 0.0) return 0;
-  if (b->p > DRAND()) return 1;
-  return 0;
+void geom_arg_init(geom_arg_t *g, double p){
+  g->p = p;
+  g->log_q = (p > 0.0 && p < 1.0) ? log(1.0 - p) : 0.0;
+}
+
+/**
+   Returns a geometric random variate as the number of failures before
+   the first success of Bernoulli trials with parameter p, i.e. the number
+   of skipped possible edges before the next added edge.
+*/
+size_t geom(void *arg){
+  double x;
+  geom_arg_t *g = arg;
+  if (g->p >= 1.0) return 0;
+  if (g->p <= 0.0) return C_SIZE_MAX;
+  x = floor(log((RANDOM() + 1.0) / (RAND_MAX + 1.0)) / g->log_q);
+  if (x >= (double)C_SIZE_MAX) return C_SIZE_MAX;
+  return x;
+}
+
+int bern_one(void *arg){
+  (void)arg;
+  return 1;
 }
 
 void add_dir_uint_edge(adj_lst_t *a,
@@ -535,7 +574,7 @@ void adj_lst_rand_dir_wts(adj_lst_t *a,
 			  size_t wt_size,
 			  size_t wt_l,
 			  size_t wt_h,
-			  int (*bern)(void *),
+			  size_t (*skip)(void *),
 			  void *arg,
 			  void (*add_dir_edge)(adj_lst_t *,
 					       size_t,
@@ -544,17 +583,27 @@ void adj_lst_rand_dir_wts(adj_lst_t *a,
 					       size_t,
 					       int (*)(void *),
 					       void *)){
-  size_t i, j;
+  size_t u = 0, v, k = 0, s;
   graph_t g;
   graph_base_init(&g, n, wt_size);
   adj_lst_init(a, &g);
-  for (i = 0; i < n - 1; i++){
-    for (j = i + 1; j < n; j++){
-      add_dir_edge(a, i, j, wt_l, wt_h, bern, arg);
-      add_dir_edge(a, j, i, wt_l, wt_h, bern, arg);
+  graph_free(&g);
+  if (n < 2) return;
+  /* skips over the n(n - 1) possible edges as adj_lst_rand_dir_skip */
+  s = skip(arg);
+  while (1){
+    while (s >= n - 1 - k){
+      s -= n - 1 - k;
+      k = 0;
+      u++;
+      if (u == n) return;
     }
+    k += s;
+    v = (k < u) ? k : k + 1;
+    add_dir_edge(a, u, v, wt_l, wt_h, bern_one, NULL);
+    k++;
+    s = skip(arg);
   }
-  graph_free(&g);
 }
 
 /**
@@ -578,7 +627,7 @@ void run_bfs_dijkstra_test(int pow_start, int pow_end){
   size_t *dist_bfs = NULL, *prev_bfs = NULL;
   size_t *dist = NULL, *prev = NULL;
   adj_lst_t a;
-  bern_arg_t b;
+  geom_arg_t b;
   ht_divchn_t ht_divchn;
   ht_muloa_t ht_muloa;
   context_divchn_t context_divchn;
@@ -612,7 +661,7 @@ void run_bfs_dijkstra_test(int pow_start, int pow_end){
 	 "graphs with the same weight across edges\n");
   fflush(stdout);
   for (p = 0; p < C_PROBS_COUNT; p++){
-    b.p = C_PROBS[p];
+    geom_arg_init(&b, C_PROBS[p]);
     printf("\tP[an edge is in a graph] = %.4f\n", C_PROBS[p]);
     for (i = pow_start; i <= pow_end; i++){
       n = pow_two(i); /* 0 < n */
@@ -621,7 +670,7 @@ void run_bfs_dijkstra_test(int pow_start, int pow_end){
 			   sizeof(size_t),
 			   i + 1, /* > 0 for normalization */
 			   i + 1,
-			   bern,
+			   geom,
 			   &b,
 			   add_dir_uint_edge);
       for (j = 0; j < C_ITER; j++){
@@ -701,7 +750,8 @@ void run_bfs_dijkstra_test(int pow_start, int pow_end){
 
 /**
    Runs a test on random directed graphs with random size_t weights,
-   across default, division-based and multiplication-based hash tables.
+   across default, division-based and multiplication-based hash tables,
+   a heap without a hash table with lazy deletion, and a radix heap.
 */
 
 /**
@@ -732,23 +782,29 @@ void run_rand_uint_test(int pow_start, int pow_end){
   int p, i, j;
   int res = 1;
   size_t num_wraps_def, num_wraps_divchn, num_wraps_muloa;
-  size_t sum_def, sum_divchn, sum_muloa;
+  size_t num_wraps_lazy, num_wraps_radix;
+  size_t sum_def, sum_divchn, sum_muloa, sum_lazy, sum_radix;
   size_t num_paths_def, num_paths_divchn, num_paths_muloa;
-  size_t n;
+  size_t num_paths_lazy, num_paths_radix;
+  size_t n, k;
   size_t wt_l = 0, wt_h = C_WEIGHT_HIGH;
   size_t *rand_start = NULL;
-  size_t *dist = NULL, *prev = NULL;
+  size_t *dist = NULL, *prev = NULL, *dist_uint = NULL;
+  unsigned int *prev_uint = NULL;
   adj_lst_t a;
-  bern_arg_t b;
+  adj_uint_t a_uint;
+  geom_arg_t b;
   ht_divchn_t ht_divchn;
   ht_muloa_t ht_muloa;
   context_divchn_t context_divchn;
   context_muloa_t context_muloa;
   heap_ht_t hht_divchn, hht_muloa;
-  clock_t t_def, t_divchn, t_muloa;
+  clock_t t_def, t_divchn, t_muloa, t_lazy, t_lazy_uint, t_radix;
   rand_start = malloc_perror(C_ITER, sizeof(size_t));
   dist = malloc_perror(pow_two(pow_end), sizeof(size_t));
   prev = malloc_perror(pow_two(pow_end), sizeof(size_t));
+  dist_uint = malloc_perror(pow_two(pow_end), sizeof(size_t));
+  prev_uint = malloc_perror(pow_two(pow_end), sizeof(unsigned int));
   context_divchn.alpha_n = C_ALPHA_N_DIVCHN;
   context_divchn.log_alpha_d = C_LOG_ALPHA_D_DIVCHN;
   hht_divchn.ht = &ht_divchn;
@@ -771,7 +827,7 @@ void run_rand_uint_test(int pow_start, int pow_end){
 	 "size_t weights in [%lu, %lu]\n", TOLU(wt_l), TOLU(wt_h));
   fflush(stdout);
   for (p = 0; p < C_PROBS_COUNT; p++){
-    b.p = C_PROBS[p];
+    geom_arg_init(&b, C_PROBS[p]);
     printf("\tP[an edge is in a graph] = %.4f\n", C_PROBS[p]);
     for (i = pow_start; i <= pow_end; i++){
       n = pow_two(i); /* 0 < n */
@@ -780,7 +836,7 @@ void run_rand_uint_test(int pow_start, int pow_end){
 			   sizeof(size_t),
 			   wt_l,
 			   wt_h,
-			   bern,
+			   geom,
 			   &b,
 			   add_dir_uint_edge);
       for (j = 0; j < C_ITER; j++){
@@ -837,20 +893,78 @@ void run_rand_uint_test(int pow_start, int pow_end){
 	       a.num_vts,
 	       dist,
 	       prev);
+      t_lazy = clock();
+      for (j = 0; j < C_ITER; j++){
+	dijkstra_lazy(&a,
+		      rand_start[j],
+		      dist,
+		      prev,
+		      add_uint,
+		      cmp_uint);
+      }
+      t_lazy = clock() - t_lazy;
+      wrap_sum(&num_wraps_lazy,
+	       &sum_lazy,
+	       &num_paths_lazy,
+	       a.num_vts,
+	       dist,
+	       prev);
+      adj_uint_copy(&a_uint, &a);
+      t_lazy_uint = clock();
+      for (j = 0; j < C_ITER; j++){
+	dijkstra_lazy_uint(&a_uint,
+			   rand_start[j],
+			   dist_uint,
+			   prev_uint,
+			   add_uint,
+			   cmp_uint);
+      }
+      t_lazy_uint = clock() - t_lazy_uint;
+      /* the last start vertex */
+      for (k = 0; k < a.num_vts; k++){
+	res *= (dist[k] == dist_uint[k]);
+	res *= (prev[k] == ((prev_uint[k] == UINT_MAX) ?
+			    C_SIZE_MAX :
+			    prev_uint[k]));
+      }
+      adj_uint_free(&a_uint);
+      t_radix = clock();
+      for (j = 0; j < C_ITER; j++){
+	dijkstra_radix(&a, rand_start[j], dist, prev, read_uint);
+      }
+      t_radix = clock() - t_radix;
+      wrap_sum(&num_wraps_radix,
+	       &sum_radix,
+	       &num_paths_radix,
+	       a.num_vts,
+	       dist,
+	       prev);
       res *= (num_wraps_def == num_wraps_divchn &&
-	      num_wraps_divchn == num_wraps_muloa);
+	      num_wraps_divchn == num_wraps_muloa &&
+	      num_wraps_muloa == num_wraps_lazy &&
+	      num_wraps_lazy == num_wraps_radix);
       res *= (sum_def == sum_divchn &&
-	      sum_divchn == sum_muloa);
+	      sum_divchn == sum_muloa &&
+	      sum_muloa == sum_lazy &&
+	      sum_lazy == sum_radix);
       res *= (num_paths_def == num_paths_divchn &&
-	      num_paths_divchn == num_paths_muloa);
+	      num_paths_divchn == num_paths_muloa &&
+	      num_paths_muloa == num_paths_lazy &&
+	      num_paths_lazy == num_paths_radix);
       printf("\t\tvertices: %lu, # of directed edges: %lu\n",
 	     TOLU(a.num_vts), TOLU(a.num_es));
       printf("\t\t\tdijkstra default ht ave runtime:     %.8f seconds\n"
 	     "\t\t\tdijkstra ht_divchn ave runtime:      %.8f seconds\n"
-	     "\t\t\tdijkstra ht_muloa ave runtime:       %.8f seconds\n",
+	     "\t\t\tdijkstra ht_muloa ave runtime:       %.8f seconds\n"
+	     "\t\t\tdijkstra_lazy no ht ave runtime:     %.8f seconds\n"
+	     "\t\t\tdijkstra_lazy_uint ave runtime:      %.8f seconds\n"
+	     "\t\t\tdijkstra_radix ave runtime:          %.8f seconds\n",
 	     (float)t_def / C_ITER / CLOCKS_PER_SEC,
 	     (float)t_divchn / C_ITER / CLOCKS_PER_SEC,
-	     (float)t_muloa / C_ITER / CLOCKS_PER_SEC);
+	     (float)t_muloa / C_ITER / CLOCKS_PER_SEC,
+	     (float)t_lazy / C_ITER / CLOCKS_PER_SEC,
+	     (float)t_lazy_uint / C_ITER / CLOCKS_PER_SEC,
+	     (float)t_radix / C_ITER / CLOCKS_PER_SEC);
       printf("\t\t\tcorrectness:                         ");
       print_test_result(res);
       printf("\t\t\tlast run # paths:                    %lu\n",
@@ -870,6 +984,117 @@ void run_rand_uint_test(int pow_start, int pow_end){
   free(rand_start);
   free(dist);
   free(prev);
+  free(dist_uint);
+  free(prev_uint);
+  rand_start = NULL;
+  dist = NULL;
+  prev = NULL;
+  dist_uint = NULL;
+  prev_uint = NULL;
+}
+
+/**
+   Runs a test on random directed graphs with small random size_t weights,
+   across a binary heap in the dense index mode, a radix heap, and a
+   bucket queue.
+*/
+void run_rand_small_uint_test(int pow_start, int pow_end){
+  int p, i, j;
+  int res = 1;
+  size_t num_wraps_def, num_wraps_radix, num_wraps_dial;
+  size_t sum_def, sum_radix, sum_dial;
+  size_t num_paths_def, num_paths_radix, num_paths_dial;
+  size_t n;
+  size_t wt_l = C_SMALL_WEIGHT_LOW, wt_h = C_SMALL_WEIGHT_HIGH;
+  size_t *rand_start = NULL;
+  size_t *dist = NULL, *prev = NULL;
+  adj_lst_t a;
+  geom_arg_t b;
+  clock_t t_def, t_radix, t_dial;
+  rand_start = malloc_perror(C_ITER, sizeof(size_t));
+  dist = malloc_perror(pow_two(pow_end), sizeof(size_t));
+  prev = malloc_perror(pow_two(pow_end), sizeof(size_t));
+  printf("Run a dijkstra test on random directed graphs with random "
+	 "size_t weights in [%lu, %lu]\n", TOLU(wt_l), TOLU(wt_h));
+  fflush(stdout);
+  for (p = 0; p < C_PROBS_COUNT; p++){
+    geom_arg_init(&b, C_PROBS[p]);
+    printf("\tP[an edge is in a graph] = %.4f\n", C_PROBS[p]);
+    for (i = pow_start; i <= pow_end; i++){
+      n = pow_two(i); /* 0 < n */
+      adj_lst_rand_dir_wts(&a,
+			   n,
+			   sizeof(size_t),
+			   wt_l,
+			   wt_h,
+			   geom,
+			   &b,
+			   add_dir_uint_edge);
+      for (j = 0; j < C_ITER; j++){
+	rand_start[j] = RANDOM() % n;
+      }
+      t_def = clock();
+      for (j = 0; j < C_ITER; j++){
+	dijkstra(&a,
+		 rand_start[j],
+		 dist,
+		 prev,
+		 NULL,
+		 add_uint,
+		 cmp_uint);
+      }
+      t_def = clock() - t_def;
+      wrap_sum(&num_wraps_def,
+	       &sum_def,
+	       &num_paths_def,
+	       a.num_vts,
+	       dist,
+	       prev);
+      t_radix = clock();
+      for (j = 0; j < C_ITER; j++){
+	dijkstra_radix(&a, rand_start[j], dist, prev, read_uint);
+      }
+      t_radix = clock() - t_radix;
+      wrap_sum(&num_wraps_radix,
+	       &sum_radix,
+	       &num_paths_radix,
+	       a.num_vts,
+	       dist,
+	       prev);
+      t_dial = clock();
+      for (j = 0; j < C_ITER; j++){
+	dijkstra_dial(&a, rand_start[j], dist, prev, wt_h, read_uint);
+      }
+      t_dial = clock() - t_dial;
+      wrap_sum(&num_wraps_dial,
+	       &sum_dial,
+	       &num_paths_dial,
+	       a.num_vts,
+	       dist,
+	       prev);
+      res *= (num_wraps_def == num_wraps_radix &&
+	      num_wraps_radix == num_wraps_dial);
+      res *= (sum_def == sum_radix &&
+	      sum_radix == sum_dial);
+      res *= (num_paths_def == num_paths_radix &&
+	      num_paths_radix == num_paths_dial);
+      printf("\t\tvertices: %lu, # of directed edges: %lu\n",
+	     TOLU(a.num_vts), TOLU(a.num_es));
+      printf("\t\t\tdijkstra default ht ave runtime:     %.8f seconds\n"
+	     "\t\t\tdijkstra_radix ave runtime:          %.8f seconds\n"
+	     "\t\t\tdijkstra_dial ave runtime:           %.8f seconds\n",
+	     (float)t_def / C_ITER / CLOCKS_PER_SEC,
+	     (float)t_radix / C_ITER / CLOCKS_PER_SEC,
+	     (float)t_dial / C_ITER / CLOCKS_PER_SEC);
+      printf("\t\t\tcorrectness:                         ");
+      print_test_result(res);
+      res = 1;
+      adj_lst_free(&a);
+    }
+  }
+  free(rand_start);
+  free(dist);
+  free(prev);
   rand_start = NULL;
   dist = NULL;
   prev = NULL;
@@ -893,8 +1118,8 @@ void print_adj_lst(const adj_lst_t *a, void (*print_wt)(const void *)){
   printf("\tvertices: \n");
   for (i = 0; i < a->num_vts; i++){
     printf("\t%lu : ", TOLU(i));
-    p_start = a->vt_wts[i]->elts;
-    p_end = p_start + a->vt_wts[i]->num_elts * a->pair_size;
+    p_start = adj_lst_vt_pairs(a, i);
+    p_end = p_start + adj_lst_vt_num_pairs(a, i) * a->pair_size;
     for (p = p_start; p != p_end; p += a->pair_size){
       printf("%lu ", TOLU(*(const size_t *)p));
     }
@@ -904,8 +1129,8 @@ void print_adj_lst(const adj_lst_t *a, void (*print_wt)(const void *)){
     printf("\tweights: \n");
     for (i = 0; i < a->num_vts; i++){
       printf("\t%lu : ", TOLU(i));
-      p_start = a->vt_wts[i]->elts;
-      p_end = p_start + a->vt_wts[i]->num_elts * a->pair_size;
+      p_start = adj_lst_vt_pairs(a, i);
+      p_end = p_start + adj_lst_vt_num_pairs(a, i) * a->pair_size;
       for (p = p_start; p != p_end; p += a->pair_size){
 	print_wt(p + a->offset);
       }
@@ -960,7 +1185,8 @@ int main(int argc, char *argv[]){
       args[1] < args[0] ||
       args[2] > 1 ||
       args[3] > 1 ||
-      args[4] > 1){
+      args[4] > 1 ||
+      args[5] > 1){
     printf("USAGE:\n%s", C_USAGE);
     exit(EXIT_FAILURE);
   }
@@ -970,6 +1196,7 @@ int main(int argc, char *argv[]){
   }
   if (args[3]) run_bfs_dijkstra_test(args[0], args[1]);
   if (args[4]) run_rand_uint_test(args[0], args[1]);
+  if (args[5]) run_rand_small_uint_test(args[0], args[1]);
   free(args);
   args = NULL;
   return 0;
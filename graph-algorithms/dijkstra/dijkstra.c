@@ -13,13 +13,23 @@
    operations, and enables the optimization of space and time resources
    associated with heap operations in Dijkstra's algorithm by choice of a
    hash table and its load factor upper bound. If NULL is passed as a hash
-   table parameter value, a default hash table is used, which contains an
-   index array with a count that is equal to the number of vertices in the
-   graph.   
+   table parameter value, the heap is used in its dense index mode, where
+   the position of each vertex in the heap is maintained in an array with
+   a count that is equal to the number of vertices in the graph and is
+   updated without hash table calls.
 
-   If E >> V, a default hash table may provide speed advantages by avoiding
+   If E >> V, the dense index mode may provide speed advantages by avoiding
    the computation of hash values. If V is large and the graph is sparse,
-   a non-default hash table may provide space advantages.
+   a hash table may provide space advantages.
+
+   dijkstra_lazy uses a heap without a hash table and discards stale heap
+   entries after popping, which may provide speed advantages on sparse
+   graphs by avoiding the hash table maintenance in heap operations.
+
+   If edge weights are non-negative integers, dijkstra_radix uses a monotone
+   radix heap that does not require a hash table parameter.
+   If edge weights are integers bounded by a small max_wt (e.g. 1 to 16),
+   dijkstra_dial uses a bucket queue with O(E + V * max_wt) running time.
 
    The implementation does not use stdint.h and is portable under C89/C90
    and C99.
@@ -28,43 +38,24 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 #include "dijkstra.h"
 #include "graph.h"
 #include "heap.h"
+#include "heap-radix.h"
+#include "heap-dial.h"
 #include "stack.h"
 #include "utilities-mem.h"
 
-typedef enum{FALSE, TRUE} boolean_t;
-
-typedef struct{
-  size_t count;
-} context_t;
-
-typedef struct{
-  size_t key_size;
-  size_t elt_size;
-  size_t count;
-  boolean_t *key_present;
-  void *elts;
-  void (*free_elt)(void *);
-} ht_def_t;
-
 static const size_t C_NREACHED = (size_t)-1; /* not reached as index */
+static const size_t C_FULL_BIT = CHAR_BIT * sizeof(size_t);
 
-/* default hash table operations */
-static void ht_def_init(ht_def_t *ht,
-			size_t key_size,
-			size_t elt_size,
-			void (*free_elt)(void *),
-			void *context);
-static void ht_def_insert(ht_def_t *ht, const size_t *key,const void *elt);
-static void *ht_def_search(const ht_def_t *ht, const size_t *key);
-static void ht_def_remove(ht_def_t *ht, const size_t *key, void *elt);
-static void ht_def_free(ht_def_t *ht);
+/* bitmap of settled vertices */
+static int is_settled(const size_t *settled, size_t i);
+static void set_settled(size_t *settled, size_t i);
 
 /* functions for computing pointers */
 static void *wt_ptr(const void *wts, size_t i, size_t wt_size);
-static void *elt_ptr(const void *elts, size_t i, size_t elt_size);
 
 /**
    Computes and copies the shortest distances from start to the array
@@ -78,8 +69,8 @@ static void *elt_ptr(const void *elts, size_t i, size_t elt_size);
                  is equal to the size of a weight in the adjacency list
    prev        : pointer to a preallocated array with a count that is equal
                  to the number of vertices in the adjacency list
-   hht         : - NULL pointer, if a default hash table is used for
-                 in-heap operations; a default hash table contains an index
+   hht         : - NULL pointer, if the heap is used in its dense index
+                 mode for in-heap operations; the heap contains a position
                  array with a count that is equal to the number of vertices
                  - a pointer to a set of parameters specifying a hash table
                  used for in-heap operations; a vertex is a hash key in 
@@ -108,24 +99,14 @@ void dijkstra(const adj_lst_t *a,
   size_t init_count = 1;
   size_t u, v;
   void *u_wt = NULL, *v_wt = NULL, *sum_wt = NULL;
-  ht_def_t ht_def;
-  context_t context;
-  heap_ht_t hht_def;
   heap_t h;
   u_wt = malloc_perror(1, wt_size);
   sum_wt = malloc_perror(1, wt_size);
   memset(dist, 0, a->num_vts * wt_size);
   memset(prev, 0xff, a->num_vts * vt_size); /* initialize to C_NREACHED */
   if (hht == NULL){
-    context.count = a->num_vts;
-    hht_def.ht = &ht_def;
-    hht_def.context = &context;
-    hht_def.init = (heap_ht_init)ht_def_init;
-    hht_def.insert = (heap_ht_insert)ht_def_insert;
-    hht_def.search = (heap_ht_search)ht_def_search;
-    hht_def.remove = (heap_ht_remove)ht_def_remove;
-    hht_def.free = (heap_ht_free)ht_def_free;
-    heap_init(&h, init_count, wt_size, vt_size, &hht_def, cmp_wt, NULL);
+    heap_init(&h, init_count, wt_size, vt_size, NULL, cmp_wt, NULL);
+    heap_dense_ix(&h, a->num_vts);
   }else{
     heap_init(&h, init_count, wt_size, vt_size, hht, cmp_wt, NULL);
   }
@@ -133,8 +114,8 @@ void dijkstra(const adj_lst_t *a,
   prev[start] = start;
   while (h.num_elts > 0){
     heap_pop(&h, u_wt, &u);
-    p_start = a->vt_wts[u]->elts;
-    p_end = p_start + a->vt_wts[u]->num_elts * a->pair_size;
+    p_start = adj_lst_vt_pairs(a, u);
+    p_end = p_start + adj_lst_vt_num_pairs(a, u) * a->pair_size;
     for (p = p_start; p != p_end; p += a->pair_size){
       v = *(const size_t *)p;
       v_wt = wt_ptr(dist, v, wt_size);
@@ -159,61 +140,250 @@ void dijkstra(const adj_lst_t *a,
 }
 
 /**
-   Default hash table operations. In the main algorithm routine, the
-   elt_size block pointed to by elt in heap_push is a vertex (index).
-   Therefore, a vertex is a hash key in the hash table of the heap, as per
-   the specification of the hash table parameter of the heap.
+   Computes and copies the shortest distances from start to the array
+   pointed to by dist, and the previous vertices to the array pointed to by
+   prev, with the maximal value of size_t in the prev array for unreached
+   vertices. The heap is used without a hash table and without
+   heap_update: a vertex is pushed again with a smaller distance instead
+   of an update, and the stale entries of settled vertices are discarded
+   after popping according to a bitmap of settled vertices. The heap may
+   contain upto E entries. Please see the parameter specification in
+   dijkstra.
 */
-
-static void ht_def_init(ht_def_t *ht,
-			size_t key_size,
-			size_t elt_size,
-			void (*free_elt)(void *),
-			void *context){
-  context_t *c = context;
-  ht->key_size = key_size;
-  ht->elt_size = elt_size;
-  ht->count = c->count;
-  ht->key_present = calloc_perror(c->count, sizeof(boolean_t));
-  ht->elts = malloc_perror(c->count, elt_size);
-  ht->free_elt = free_elt;
-}
-
-static void ht_def_insert(ht_def_t *ht, const size_t *key, const void *elt){
-  ht->key_present[*key] = TRUE;
-  memcpy(elt_ptr(ht->elts, *key, ht->elt_size),
-	 elt,
-	 ht->elt_size);
+void dijkstra_lazy(const adj_lst_t *a,
+		   size_t start,
+		   void *dist,
+		   size_t *prev,
+		   void (*add_wt)(void *, const void *, const void *),
+		   int (*cmp_wt)(const void *, const void *)){
+  const char *p = NULL, *p_start = NULL, *p_end = NULL;
+  size_t wt_size = a->wt_size;
+  size_t vt_size = sizeof(size_t);
+  size_t init_count = 1;
+  size_t u, v;
+  size_t *settled = NULL;
+  void *u_wt = NULL, *v_wt = NULL, *sum_wt = NULL;
+  heap_t h;
+  u_wt = malloc_perror(1, wt_size);
+  sum_wt = malloc_perror(1, wt_size);
+  settled = calloc_perror(a->num_vts / C_FULL_BIT + 1, sizeof(size_t));
+  memset(dist, 0, a->num_vts * wt_size);
+  memset(prev, 0xff, a->num_vts * vt_size); /* initialize to C_NREACHED */
+  heap_init(&h, init_count, wt_size, vt_size, NULL, cmp_wt, NULL);
+  heap_push(&h, wt_ptr(dist, start, wt_size), &start);
+  prev[start] = start;
+  while (h.num_elts > 0){
+    heap_pop(&h, u_wt, &u);
+    if (is_settled(settled, u)) continue; /* stale entry */
+    set_settled(settled, u);
+    p_start = adj_lst_vt_pairs(a, u);
+    p_end = p_start + adj_lst_vt_num_pairs(a, u) * a->pair_size;
+    for (p = p_start; p != p_end; p += a->pair_size){
+      v = *(const size_t *)p;
+      if (is_settled(settled, v)) continue;
+      v_wt = wt_ptr(dist, v, wt_size);
+      add_wt(sum_wt, u_wt, p + a->offset);
+      if (prev[v] == C_NREACHED || cmp_wt(v_wt, sum_wt) > 0){
+	memcpy(v_wt, sum_wt, wt_size);
+	heap_push(&h, v_wt, &v);
+	prev[v] = u;
+      }
+    }
+  }
+  heap_free(&h);
+  free(u_wt);
+  free(sum_wt);
+  free(settled);
+  u_wt = NULL;
+  sum_wt = NULL;
+  settled = NULL;
 }
 
-static void *ht_def_search(const ht_def_t *ht, const size_t *key){
-  if (ht->key_present[*key]){
-    return elt_ptr(ht->elts, *key, ht->elt_size);
-  }else{
-    return NULL;
+/**
+   Runs dijkstra_lazy on a compact-id adjacency list with an unsigned int
+   prev array, UINT_MAX in the prev array for unreached vertices, and
+   unsigned int heap elements, which are padded to the size of a weight if
+   the weight is larger to keep the weights in the heap aligned. Please see
+   the parameter specification in dijkstra.
+*/
+void dijkstra_lazy_uint(const adj_uint_t *a,
+			size_t start,
+			void *dist,
+			unsigned int *prev,
+			void (*add_wt)(void *, const void *, const void *),
+			int (*cmp_wt)(const void *, const void *)){
+  const char *p = NULL, *p_start = NULL, *p_end = NULL;
+  size_t wt_size = a->wt_size;
+  size_t vt_size = sizeof(unsigned int);
+  size_t elt_size = (wt_size > vt_size) ? wt_size : vt_size;
+  size_t init_count = 1;
+  unsigned int u, v;
+  size_t *settled = NULL;
+  void *u_wt = NULL, *v_wt = NULL, *sum_wt = NULL;
+  void *elt = NULL;
+  heap_t h;
+  u_wt = malloc_perror(1, wt_size);
+  sum_wt = malloc_perror(1, wt_size);
+  elt = calloc_perror(1, elt_size);
+  settled = calloc_perror(a->num_vts / C_FULL_BIT + 1, sizeof(size_t));
+  memset(dist, 0, a->num_vts * wt_size);
+  memset(prev, 0xff, a->num_vts * vt_size); /* initialize to UINT_MAX */
+  heap_init(&h, init_count, wt_size, elt_size, NULL, cmp_wt, NULL);
+  u = start;
+  memcpy(elt, &u, vt_size);
+  heap_push(&h, wt_ptr(dist, u, wt_size), elt);
+  prev[u] = u;
+  while (h.num_elts > 0){
+    heap_pop(&h, u_wt, elt);
+    memcpy(&u, elt, vt_size);
+    if (is_settled(settled, u)) continue; /* stale entry */
+    set_settled(settled, u);
+    p_start = adj_uint_vt_pairs(a, u);
+    p_end = p_start + adj_uint_vt_num_pairs(a, u) * a->pair_size;
+    for (p = p_start; p != p_end; p += a->pair_size){
+      v = *(const unsigned int *)p;
+      if (is_settled(settled, v)) continue;
+      v_wt = wt_ptr(dist, v, wt_size);
+      add_wt(sum_wt, u_wt, p + a->offset);
+      if (prev[v] == UINT_MAX || cmp_wt(v_wt, sum_wt) > 0){
+	memcpy(v_wt, sum_wt, wt_size);
+	memcpy(elt, &v, vt_size);
+	heap_push(&h, v_wt, elt);
+	prev[v] = u;
+      }
+    }
   }
+  heap_free(&h);
+  free(u_wt);
+  free(sum_wt);
+  free(settled);
+  free(elt);
+  u_wt = NULL;
+  sum_wt = NULL;
+  settled = NULL;
+  elt = NULL;
 }
 
-static void ht_def_remove(ht_def_t *ht, const size_t *key, void *elt){
-  ht->key_present[*key] = FALSE;
-  memcpy(elt,
-	 elt_ptr(ht->elts, *key, ht->elt_size),
-	 ht->elt_size);
+/**
+   Computes and copies the shortest distances from start to the array
+   pointed to by dist, and the previous vertices to the array pointed to by
+   prev, with the maximal value of size_t in the prev array for unreached
+   vertices, on a graph with non-negative integer weights. The in-heap
+   operations are performed by a monotone radix heap without a hash table,
+   with an amortized O(log C) running time of a pop operation, where C is
+   the maximal weight of an edge. The sum of weights along a shortest path
+   is representable as size_t (e.g. 32-bit weights and less than 2**32
+   vertices on a 64-bit system).
+   a           : pointer to an adjacency list with at least one vertex
+   start       : start vertex for running the algorithm
+   dist        : pointer to a preallocated array with a count that is equal
+                 to the number of vertices in the adjacency list
+   prev        : pointer to a preallocated array with a count that is equal
+                 to the number of vertices in the adjacency list
+   read_wt     : returns the non-negative integer value of the weight
+                 pointed to by the argument as size_t
+*/
+void dijkstra_radix(const adj_lst_t *a,
+		    size_t start,
+		    size_t *dist,
+		    size_t *prev,
+		    size_t (*read_wt)(const void *)){
+  const char *p = NULL, *p_start = NULL, *p_end = NULL;
+  size_t u, v, u_wt, sum_wt;
+  heap_radix_t h;
+  memset(dist, 0, a->num_vts * sizeof(size_t));
+  memset(prev, 0xff, a->num_vts * sizeof(size_t)); /* C_NREACHED */
+  heap_radix_init(&h, a->num_vts);
+  heap_radix_push(&h, 0, start);
+  prev[start] = start;
+  while (h.num_elts > 0){
+    heap_radix_pop(&h, &u_wt, &u);
+    p_start = adj_lst_vt_pairs(a, u);
+    p_end = p_start + adj_lst_vt_num_pairs(a, u) * a->pair_size;
+    for (p = p_start; p != p_end; p += a->pair_size){
+      v = *(const size_t *)p;
+      sum_wt = u_wt + read_wt(p + a->offset);
+      if (prev[v] == C_NREACHED){
+	dist[v] = sum_wt;
+	heap_radix_push(&h, sum_wt, v);
+	prev[v] = u;
+      }else if (dist[v] > sum_wt){
+	/* must be in the heap */
+	dist[v] = sum_wt;
+	heap_radix_update(&h, sum_wt, v);
+	prev[v] = u;
+      }
+    }
+  }
+  heap_radix_free(&h);
 }
 
-static void ht_def_free(ht_def_t *ht){
-  size_t i;
-  if (ht->free_elt != NULL){
-    for (i = 0; i < ht->count; i++){
-      if (ht->key_present[i]){
-	ht->free_elt(elt_ptr(ht->elts, i, ht->elt_size));
+/**
+   Computes and copies the shortest distances from start to the array
+   pointed to by dist, and the previous vertices to the array pointed to by
+   prev, with the maximal value of size_t in the prev array for unreached
+   vertices, on a graph with integer weights in [0, max_wt]. The in-heap
+   operations are performed by a circular array of max_wt + 1 buckets
+   without comparisons of weights and without a hash table, resulting in
+   a O(E + V * max_wt) running time. The sum of weights along a shortest
+   path is representable as size_t.
+   a           : pointer to an adjacency list with at least one vertex
+   start       : start vertex for running the algorithm
+   dist        : pointer to a preallocated array with a count that is equal
+                 to the number of vertices in the adjacency list
+   prev        : pointer to a preallocated array with a count that is equal
+                 to the number of vertices in the adjacency list
+   max_wt      : < the maximal value of size_t; upper bound of the weights
+                 in the adjacency list
+   read_wt     : returns the integer value in [0, max_wt] of the weight
+                 pointed to by the argument as size_t
+*/
+void dijkstra_dial(const adj_lst_t *a,
+		   size_t start,
+		   size_t *dist,
+		   size_t *prev,
+		   size_t max_wt,
+		   size_t (*read_wt)(const void *)){
+  const char *p = NULL, *p_start = NULL, *p_end = NULL;
+  size_t u, v, u_wt, sum_wt;
+  heap_dial_t h;
+  memset(dist, 0, a->num_vts * sizeof(size_t));
+  memset(prev, 0xff, a->num_vts * sizeof(size_t)); /* C_NREACHED */
+  heap_dial_init(&h, a->num_vts, max_wt);
+  heap_dial_push(&h, 0, start);
+  prev[start] = start;
+  while (h.num_elts > 0){
+    heap_dial_pop(&h, &u_wt, &u);
+    p_start = adj_lst_vt_pairs(a, u);
+    p_end = p_start + adj_lst_vt_num_pairs(a, u) * a->pair_size;
+    for (p = p_start; p != p_end; p += a->pair_size){
+      v = *(const size_t *)p;
+      sum_wt = u_wt + read_wt(p + a->offset);
+      if (prev[v] == C_NREACHED){
+	dist[v] = sum_wt;
+	heap_dial_push(&h, sum_wt, v);
+	prev[v] = u;
+      }else if (dist[v] > sum_wt){
+	/* must be in the heap */
+	dist[v] = sum_wt;
+	heap_dial_update(&h, sum_wt, v);
+	prev[v] = u;
       }
     }
   }
-  free(ht->key_present);
-  free(ht->elts);
-  ht->key_present = NULL;
-  ht->elts = NULL;
+  heap_dial_free(&h);
+}
+
+/**
+   Functions for a bitmap of settled vertices.
+*/
+
+static int is_settled(const size_t *settled, size_t i){
+  return (settled[i / C_FULL_BIT] >> (i % C_FULL_BIT)) & 1;
+}
+
+static void set_settled(size_t *settled, size_t i){
+  settled[i / C_FULL_BIT] |= (size_t)1 << (i % C_FULL_BIT);
 }
 
 /** Functions for computing pointers */
@@ -224,11 +394,3 @@ static void ht_def_free(ht_def_t *ht){
 static void *wt_ptr(const void *wts, size_t i, size_t wt_size){
   return (void *)((char *)wts + i * wt_size);
 }
- 
-/**
-   Computes a pointer to an entry in the array of elements in a default hash
-   table.
-*/
-static void *elt_ptr(const void *elts, size_t i, size_t elt_size){
-  return (void *)((char *)elts + i * elt_size);
-}
@@ -13,13 +13,26 @@
    operations, and enables the optimization of space and time resources
    associated with heap operations in Dijkstra's algorithm by choice of a
    hash table and its load factor upper bound. If NULL is passed as a hash
-   table parameter value, a default hash table is used, which contains an
-   index array with a count that is equal to the number of vertices in the
-   graph.   
+   table parameter value, the heap is used in its dense index mode, where
+   the position of each vertex in the heap is maintained in an array with
+   a count that is equal to the number of vertices in the graph and is
+   updated without hash table calls.
 
-   If E >> V, a default hash table may provide speed advantages by avoiding
+   If E >> V, the dense index mode may provide speed advantages by avoiding
    the computation of hash values. If V is large and the graph is sparse,
-   a non-default hash table may provide space advantages.
+   a hash table may provide space advantages.
+
+   dijkstra_lazy uses a heap without a hash table and discards stale heap
+   entries after popping, which may provide speed advantages on sparse
+   graphs by avoiding the hash table maintenance in heap operations.
+   dijkstra_lazy_uint runs on a compact-id adjacency list (adj_uint_t),
+   which halves the size of the vertex weight pairs and heap elements with
+   weights of size at most sizeof(unsigned int), and of the prev array.
+
+   If edge weights are non-negative integers, dijkstra_radix uses a monotone
+   radix heap that does not require a hash table parameter.
+   If edge weights are integers bounded by a small max_wt (e.g. 1 to 16),
+   dijkstra_dial uses a bucket queue with O(E + V * max_wt) running time.
 
    The implementation does not use stdint.h and is portable under C89/C90
    and C99.
@@ -44,8 +57,8 @@
                  is equal to the size of a weight in the adjacency list
    prev        : pointer to a preallocated array with a count that is equal
                  to the number of vertices in the adjacency list
-   hht         : - NULL pointer, if a default hash table is used for
-                 in-heap operations; a default hash table contains an index
+   hht         : - NULL pointer, if the heap is used in its dense index
+                 mode for in-heap operations; the heap contains a position
                  array with a count that is equal to the number of vertices
                  - a pointer to a set of parameters specifying a hash table
                  used for in-heap operations; a vertex is a hash key in 
@@ -68,4 +81,89 @@ void dijkstra(const adj_lst_t *a,
 	      const heap_ht_t *hht,
 	      void (*add_wt)(void *, const void *, const void *),
 	      int (*cmp_wt)(const void *, const void *));
+
+/**
+   Computes and copies the shortest distances from start to the array
+   pointed to by dist, and the previous vertices to the array pointed to by
+   prev, with the maximal value of size_t in the prev array for unreached
+   vertices. The heap is used without a hash table and without
+   heap_update: a vertex is pushed again with a smaller distance instead
+   of an update, and the stale entries of settled vertices are discarded
+   after popping according to a bitmap of settled vertices. The heap may
+   contain upto E entries. Please see the parameter specification in
+   dijkstra.
+*/
+void dijkstra_lazy(const adj_lst_t *a,
+		   size_t start,
+		   void *dist,
+		   size_t *prev,
+		   void (*add_wt)(void *, const void *, const void *),
+		   int (*cmp_wt)(const void *, const void *));
+
+/**
+   Runs dijkstra_lazy on a compact-id adjacency list with an unsigned int
+   prev array, UINT_MAX in the prev array for unreached vertices, and
+   unsigned int heap elements, which are padded to the size of a weight if
+   the weight is larger to keep the weights in the heap aligned. Please see
+   the parameter specification in dijkstra.
+*/
+void dijkstra_lazy_uint(const adj_uint_t *a,
+			size_t start,
+			void *dist,
+			unsigned int *prev,
+			void (*add_wt)(void *, const void *, const void *),
+			int (*cmp_wt)(const void *, const void *));
+
+/**
+   Computes and copies the shortest distances from start to the array
+   pointed to by dist, and the previous vertices to the array pointed to by
+   prev, with the maximal value of size_t in the prev array for unreached
+   vertices, on a graph with non-negative integer weights. The in-heap
+   operations are performed by a monotone radix heap without a hash table,
+   with an amortized O(log C) running time of a pop operation, where C is
+   the maximal weight of an edge. The sum of weights along a shortest path
+   is representable as size_t (e.g. 32-bit weights and less than 2**32
+   vertices on a 64-bit system).
+   a           : pointer to an adjacency list with at least one vertex
+   start       : start vertex for running the algorithm
+   dist        : pointer to a preallocated array with a count that is equal
+                 to the number of vertices in the adjacency list
+   prev        : pointer to a preallocated array with a count that is equal
+                 to the number of vertices in the adjacency list
+   read_wt     : returns the non-negative integer value of the weight
+                 pointed to by the argument as size_t
+*/
+void dijkstra_radix(const adj_lst_t *a,
+		    size_t start,
+		    size_t *dist,
+		    size_t *prev,
+		    size_t (*read_wt)(const void *));
+
+/**
+   Computes and copies the shortest distances from start to the array
+   pointed to by dist, and the previous vertices to the array pointed to by
+   prev, with the maximal value of size_t in the prev array for unreached
+   vertices, on a graph with integer weights in [0, max_wt]. The in-heap
+   operations are performed by a circular array of max_wt + 1 buckets
+   without comparisons of weights and without a hash table, resulting in
+   a O(E + V * max_wt) running time. The sum of weights along a shortest
+   path is representable as size_t.
+   a           : pointer to an adjacency list with at least one vertex
+   start       : start vertex for running the algorithm
+   dist        : pointer to a preallocated array with a count that is equal
+                 to the number of vertices in the adjacency list
+   prev        : pointer to a preallocated array with a count that is equal
+                 to the number of vertices in the adjacency list
+   max_wt      : < the maximal value of size_t; upper bound of the weights
+                 in the adjacency list
+   read_wt     : returns the integer value in [0, max_wt] of the weight
+                 pointed to by the argument as size_t
+*/
+void dijkstra_dial(const adj_lst_t *a,
+		   size_t start,
+		   size_t *dist,
+		   size_t *prev,
+		   size_t max_wt,
+		   size_t (*read_wt)(const void *));
+
 #endif
@@ -154,6 +154,8 @@ void ht_divchn_init_helper(ht_divchn_t *ht,
 		 0,
 		 c->alpha_n,
 		 c->log_alpha_d,
+		 NULL,
+		 NULL,
 		 free_elt);
 }
 
@@ -170,6 +172,7 @@ void ht_muloa_init_helper(ht_muloa_t *ht,
 		c->alpha_n,
 		c->log_alpha_d,
 		NULL,
+		NULL,
 		free_elt);
 }
 
@@ -259,7 +262,7 @@ void run_uint_graph_test(){
   adj_lst_t a;
   graph_uint_wts_init(&g);
   printf("Running a test on an undirected size_t graph with a \n"
-	 "i) default hash table (index array) \n"
+	 "i) dense index mode (position array) \n"
 	 "ii) ht_divchn_t hash table \n"
 	 "iii) ht_muloa_t hash table \n\n");
   adj_lst_init(&a, &g);
@@ -269,11 +272,16 @@ void run_uint_graph_test(){
   run_divchn_uint_prim(&a);
   run_muloa_uint_prim(&a);
   adj_lst_free(&a);
+  printf("Running a test on an undirected size_t graph in CSR format "
+	 "with a dense index mode (position array) \n\n");
+  adj_lst_csr_undir_build(&a, &g);
+  run_def_uint_prim(&a);
+  adj_lst_free(&a);
   graph_free(&g);
   graph_uint_wts_no_edges_init(&g);
   printf("Running a test on a undirected size_t graph with no edges, "
 	 "with a \n"
-	 "i) default hash table (index array) \n"
+	 "i) dense index mode (position array) \n"
 	 "ii) ht_divchn_t hash table \n"
 	 "iii) ht_muloa_t hash table \n\n");
   adj_lst_init(&a, &g);
@@ -408,7 +416,7 @@ void run_double_graph_test(){
   adj_lst_t a;
   graph_double_wts_init(&g);
   printf("Running a test on an undirected double graph with a \n"
-	 "i) default hash table (index array) \n"
+	 "i) dense index mode (position array) \n"
 	 "ii) ht_divchn_t hash table \n"
 	 "iii) ht_muloa_t hash table \n\n");
   adj_lst_init(&a, &g);
@@ -422,7 +430,7 @@ void run_double_graph_test(){
   graph_double_wts_no_edges_init(&g);
   printf("Running a test on a undirected double graph with no edges, "
 	 "with a \n"
-	 "i) default hash table (index array) \n"
+	 "i) dense index mode (position array) \n"
 	 "ii) ht_divchn_t hash table \n"
 	 "iii) ht_muloa_t hash table \n\n");
   adj_lst_init(&a, &g);
@@ -502,7 +510,8 @@ void adj_lst_rand_undir_wts(adj_lst_t *a,
 
 /**
    Run a test on random undirected graphs with random size_t weights,
-   across default, division-based and multiplication-based hash tables.
+   across default, division-based and multiplication-based hash tables,
+   and a heap without a hash table with lazy deletion.
 */
 
 void sum_mst_edges(size_t *wt_mst,
@@ -524,8 +533,8 @@ void sum_mst_edges(size_t *wt_mst,
 void run_rand_uint_test(int pow_start, int pow_end){
   int p, i, j;
   int res = 1;
-  size_t wt_def, wt_divchn, wt_muloa;
-  size_t num_vts_def, num_vts_divchn, num_vts_muloa;
+  size_t wt_def, wt_divchn, wt_muloa, wt_lazy;
+  size_t num_vts_def, num_vts_divchn, num_vts_muloa, num_vts_lazy;
   size_t n;
   size_t wt_l = 0, wt_h = C_WEIGHT_HIGH;
   size_t *rand_start = NULL;
@@ -537,7 +546,7 @@ void run_rand_uint_test(int pow_start, int pow_end){
   context_divchn_t context_divchn;
   context_muloa_t context_muloa;
   heap_ht_t hht_divchn, hht_muloa;
-  clock_t t_def, t_divchn, t_muloa;
+  clock_t t_def, t_divchn, t_muloa, t_lazy;
   rand_start = malloc_perror(C_ITER, sizeof(size_t));
   dist = malloc_perror(pow_two(pow_end), sizeof(size_t));
   prev = malloc_perror(pow_two(pow_end), sizeof(size_t));
@@ -596,18 +605,28 @@ void run_rand_uint_test(int pow_start, int pow_end){
       }
       t_muloa = clock() - t_muloa;
       sum_mst_edges(&wt_muloa, &num_vts_muloa, a.num_vts, dist, prev);
+      t_lazy = clock();
+      for (j = 0; j < C_ITER; j++){
+	prim_lazy(&a, rand_start[j], dist, prev, cmp_uint);
+      }
+      t_lazy = clock() - t_lazy;
+      sum_mst_edges(&wt_lazy, &num_vts_lazy, a.num_vts, dist, prev);
       res *= (wt_def == wt_divchn &&
-	      wt_divchn == wt_muloa);
+	      wt_divchn == wt_muloa &&
+	      wt_muloa == wt_lazy);
       res *= (num_vts_def == num_vts_divchn &&
-	      num_vts_divchn == num_vts_muloa);
+	      num_vts_divchn == num_vts_muloa &&
+	      num_vts_muloa == num_vts_lazy);
       printf("\t\tvertices: %lu, # of directed edges: %lu\n",
 	     TOLU(a.num_vts), TOLU(a.num_es));
       printf("\t\t\tprim default ht ave runtime:         %.8f seconds\n"
 	     "\t\t\tprim ht_divchn ave runtime:          %.8f seconds\n"
-	     "\t\t\tprim ht_muloa ave runtime:           %.8f seconds\n",
+	     "\t\t\tprim ht_muloa ave runtime:           %.8f seconds\n"
+	     "\t\t\tprim_lazy no ht ave runtime:         %.8f seconds\n",
 	     (float)t_def / C_ITER / CLOCKS_PER_SEC,
 	     (float)t_divchn / C_ITER / CLOCKS_PER_SEC,
-	     (float)t_muloa / C_ITER / CLOCKS_PER_SEC);
+	     (float)t_muloa / C_ITER / CLOCKS_PER_SEC,
+	     (float)t_lazy / C_ITER / CLOCKS_PER_SEC);
       printf("\t\t\tcorrectness:                         ");
       print_test_result(res);
       printf("\t\t\tlast mst # edges:                    %lu\n",
@@ -648,8 +667,8 @@ void print_adj_lst(const adj_lst_t *a, void (*print_wt)(const void *)){
   printf("\tvertices: \n");
   for (i = 0; i < a->num_vts; i++){
     printf("\t%lu : ", TOLU(i));
-    p_start = a->vt_wts[i]->elts;
-    p_end = p_start + a->vt_wts[i]->num_elts * a->pair_size;
+    p_start = adj_lst_vt_pairs(a, i);
+    p_end = p_start + adj_lst_vt_num_pairs(a, i) * a->pair_size;
     for (p = p_start; p != p_end; p += a->pair_size){
       printf("%lu ", TOLU(*(const size_t *)p));
     }
@@ -659,8 +678,8 @@ void print_adj_lst(const adj_lst_t *a, void (*print_wt)(const void *)){
     printf("\tweights: \n");
     for (i = 0; i < a->num_vts; i++){
       printf("\t%lu : ", TOLU(i));
-      p_start = a->vt_wts[i]->elts;
-      p_end = p_start + a->vt_wts[i]->num_elts * a->pair_size;
+      p_start = adj_lst_vt_pairs(a, i);
+      p_end = p_start + adj_lst_vt_num_pairs(a, i) * a->pair_size;
       for (p = p_start; p != p_end; p += a->pair_size){
 	print_wt(p + a->offset);
       }
@@ -15,13 +15,18 @@
    operations, and enables the optimization of space and time resources
    associated with heap operations in Prim's algorithm by choice of a
    hash table and its load factor upper bound. If NULL is passed as a hash
-   table parameter value, a default hash table is used, which contains an
-   index array with a count that is equal to the number of vertices in the
-   graph.   
+   table parameter value, the heap is used in its dense index mode, where
+   the position of each vertex in the heap is maintained in an array with
+   a count that is equal to the number of vertices in the graph and is
+   updated without hash table calls.
 
-   If E >> V, a default hash table may provide speed advantages by avoiding
+   If E >> V, the dense index mode may provide speed advantages by avoiding
    the computation of hash values. If V is large and the graph is sparse,
-   a non-default hash table may provide space advantages.
+   a hash table may provide space advantages.
+
+   prim_lazy uses a heap without a hash table and discards stale heap
+   entries after popping, which may provide speed advantages on sparse
+   graphs by avoiding the hash table maintenance in heap operations.
 
    The implementation does not use stdint.h and is portable under C89/C90
    and C99.
@@ -30,43 +35,22 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 #include "prim.h"
 #include "graph.h"
 #include "heap.h"
 #include "stack.h"
 #include "utilities-mem.h"
 
-typedef enum{FALSE, TRUE} boolean_t;
-
-typedef struct{
-  size_t count;
-} context_t;
-
-typedef struct{
-  size_t key_size;
-  size_t elt_size;
-  size_t count;
-  boolean_t *key_present;
-  void *elts;
-  void (*free_elt)(void *);
-} ht_def_t;
-
 static const size_t C_NREACHED = (size_t)-1; /* not reached as index */
+static const size_t C_FULL_BIT = CHAR_BIT * sizeof(size_t);
 
-/* default hash table operations */
-static void ht_def_init(ht_def_t *ht,
-			size_t key_size,
-			size_t elt_size,
-			void (*free_elt)(void *),
-			void *context);
-static void ht_def_insert(ht_def_t *ht, const size_t *key,const void *elt);
-static void *ht_def_search(const ht_def_t *ht, const size_t *key);
-static void ht_def_remove(ht_def_t *ht, const size_t *key, void *elt);
-static void ht_def_free(ht_def_t *ht);
+/* bitmap of vertices in an mst */
+static int is_settled(const size_t *settled, size_t i);
+static void set_settled(size_t *settled, size_t i);
 
 /* functions for computing pointers */
 static void *wt_ptr(const void *wts, size_t i, size_t wt_size);
-static void *elt_ptr(const void *elts, size_t i, size_t elt_size);
 
 /**
    Computes and copies the edge weights of an mst of the connected component
@@ -80,8 +64,8 @@ static void *elt_ptr(const void *elts, size_t i, size_t elt_size);
                  is equal to the size of a weight in the adjacency list
    prev        : pointer to a preallocated array with a count that is equal
                  to the number of vertices in the adjacency list
-   hht         : - NULL pointer, if a default hash table is used for
-                 in-heap operations; a default hash table contains an index
+   hht         : - NULL pointer, if the heap is used in its dense index
+                 mode for in-heap operations; the heap contains a position
                  array with a count that is equal to the number of vertices
                  - a pointer to a set of parameters specifying a hash table
                  used for in-heap operations; a vertex is a hash key in 
@@ -107,23 +91,13 @@ void prim(const adj_lst_t *a,
   size_t init_count = 1;
   size_t u, v;
   void *u_wt = NULL, *v_wt = NULL;
-  ht_def_t ht_def;
-  context_t context;
-  heap_ht_t hht_def;
   heap_t h;
   u_wt = malloc_perror(1, wt_size);
   memset(dist, 0, a->num_vts * wt_size);
   memset(prev, 0xff, a->num_vts * vt_size); /* initialize to C_NREACHED */
   if (hht == NULL){
-    context.count = a->num_vts;
-    hht_def.ht = &ht_def;
-    hht_def.context = &context;
-    hht_def.init = (heap_ht_init)ht_def_init;
-    hht_def.insert = (heap_ht_insert)ht_def_insert;
-    hht_def.search = (heap_ht_search)ht_def_search;
-    hht_def.remove = (heap_ht_remove)ht_def_remove;
-    hht_def.free = (heap_ht_free)ht_def_free;
-    heap_init(&h, init_count, wt_size, vt_size, &hht_def, cmp_wt, NULL);
+    heap_init(&h, init_count, wt_size, vt_size, NULL, cmp_wt, NULL);
+    heap_dense_ix(&h, a->num_vts);
   }else{
     heap_init(&h, init_count, wt_size, vt_size, hht, cmp_wt, NULL);
   }
@@ -131,8 +105,8 @@ void prim(const adj_lst_t *a,
   prev[start] = start;
   while (h.num_elts > 0){
     heap_pop(&h, u_wt, &u);
-    p_start = a->vt_wts[u]->elts;
-    p_end = p_start + a->vt_wts[u]->num_elts * a->pair_size;
+    p_start = adj_lst_vt_pairs(a, u);
+    p_end = p_start + adj_lst_vt_num_pairs(a, u) * a->pair_size;
     for (p = p_start; p != p_end; p += a->pair_size){
       v = *(const size_t *)p;
       v_wt = wt_ptr(dist, v, wt_size);
@@ -155,61 +129,72 @@ void prim(const adj_lst_t *a,
 }
 
 /**
-   Default hash table operations. In the main algorithm routine, the
-   elt_size block pointed to by elt in heap_push is a vertex (index).
-   Therefore, a vertex is a hash key in the hash table of the heap, as per
-   the specification of the hash table parameter of the heap.
+   Computes and copies the edge weights of an mst of the connected component
+   of a start vertex to the array pointed to by dist, and the previous
+   vertices to the array pointed to by prev, with the maximal value of size_t
+   in the prev array for unreached vertices. The heap is used without a
+   hash table and without heap_update: a vertex is pushed again with a
+   smaller weight instead of an update, and the stale entries of vertices
+   in the mst are discarded after popping according to a bitmap of
+   vertices in the mst. The heap may contain upto E entries. Please see
+   the parameter specification in prim.
 */
-
-static void ht_def_init(ht_def_t *ht,
-			size_t key_size,
-			size_t elt_size,
-			void (*free_elt)(void *),
-			void *context){
-  context_t *c = context;
-  ht->key_size = key_size;
-  ht->elt_size = elt_size;
-  ht->count = c->count;
-  ht->key_present = calloc_perror(c->count, sizeof(boolean_t));
-  ht->elts = malloc_perror(c->count, elt_size);
-  ht->free_elt = free_elt;
-}
-
-static void ht_def_insert(ht_def_t *ht, const size_t *key, const void *elt){
-  ht->key_present[*key] = TRUE;
-  memcpy(elt_ptr(ht->elts, *key, ht->elt_size),
-	 elt,
-	 ht->elt_size);
-}
-
-static void *ht_def_search(const ht_def_t *ht, const size_t *key){
-  if (ht->key_present[*key]){
-    return elt_ptr(ht->elts, *key, ht->elt_size);
-  }else{
-    return NULL;
+void prim_lazy(const adj_lst_t *a,
+	       size_t start,
+	       void *dist,
+	       size_t *prev,
+	       int (*cmp_wt)(const void *, const void *)){
+  const char *p = NULL, *p_start = NULL, *p_end = NULL;
+  const char *uv_wt = NULL;
+  size_t wt_size = a->wt_size;
+  size_t vt_size = sizeof(size_t);
+  size_t init_count = 1;
+  size_t u, v;
+  size_t *settled = NULL;
+  void *u_wt = NULL, *v_wt = NULL;
+  heap_t h;
+  u_wt = malloc_perror(1, wt_size);
+  settled = calloc_perror(a->num_vts / C_FULL_BIT + 1, sizeof(size_t));
+  memset(dist, 0, a->num_vts * wt_size);
+  memset(prev, 0xff, a->num_vts * vt_size); /* initialize to C_NREACHED */
+  heap_init(&h, init_count, wt_size, vt_size, NULL, cmp_wt, NULL);
+  heap_push(&h, wt_ptr(dist, start, wt_size), &start);
+  prev[start] = start;
+  while (h.num_elts > 0){
+    heap_pop(&h, u_wt, &u);
+    if (is_settled(settled, u)) continue; /* stale entry */
+    set_settled(settled, u);
+    p_start = adj_lst_vt_pairs(a, u);
+    p_end = p_start + adj_lst_vt_num_pairs(a, u) * a->pair_size;
+    for (p = p_start; p != p_end; p += a->pair_size){
+      v = *(const size_t *)p;
+      if (is_settled(settled, v)) continue;
+      v_wt = wt_ptr(dist, v, wt_size);
+      uv_wt = p + a->offset;
+      if (prev[v] == C_NREACHED || cmp_wt(v_wt, uv_wt) > 0){
+	memcpy(v_wt, uv_wt, wt_size);
+	heap_push(&h, v_wt, &v);
+	prev[v] = u;
+      }
+    }
   }
+  heap_free(&h);
+  free(u_wt);
+  free(settled);
+  u_wt = NULL;
+  settled = NULL;
 }
 
-static void ht_def_remove(ht_def_t *ht, const size_t *key, void *elt){
-  ht->key_present[*key] = FALSE;
-  memcpy(elt,
-	 elt_ptr(ht->elts, *key, ht->elt_size),
-	 ht->elt_size);
+/**
+   Functions for a bitmap of vertices in an mst.
+*/
+
+static int is_settled(const size_t *settled, size_t i){
+  return (settled[i / C_FULL_BIT] >> (i % C_FULL_BIT)) & 1;
 }
 
-static void ht_def_free(ht_def_t *ht){
-  size_t i;
-  if (ht->free_elt != NULL){
-    for (i = 0; i < ht->count; i++){
-      if (ht->key_present[i]){
-	ht->free_elt(elt_ptr(ht->elts, i, ht->elt_size));
-      }
-    }
-  }
-  free(ht->key_present);
-  free(ht->elts);
-  ht->key_present = NULL;
-  ht->elts = NULL;
+static void set_settled(size_t *settled, size_t i){
+  settled[i / C_FULL_BIT] |= (size_t)1 << (i % C_FULL_BIT);
 }
 
 /** Functions for computing pointers */
@@ -220,11 +205,3 @@ static void ht_def_free(ht_def_t *ht){
 static void *wt_ptr(const void *wts, size_t i, size_t wt_size){
   return (void *)((char *)wts + i * wt_size);
 }
- 
-/**
-   Computes a pointer to an entry in the array of elements in a default hash
-   table.
-*/
-static void *elt_ptr(const void *elts, size_t i, size_t elt_size){
-  return (void *)((char *)elts + i * elt_size);
-}
@@ -15,13 +15,18 @@
    operations, and enables the optimization of space and time resources
    associated with heap operations in Prim's algorithm by choice of a
    hash table and its load factor upper bound. If NULL is passed as a hash
-   table parameter value, a default hash table is used, which contains an
-   index array with a count that is equal to the number of vertices in the
-   graph.   
+   table parameter value, the heap is used in its dense index mode, where
+   the position of each vertex in the heap is maintained in an array with
+   a count that is equal to the number of vertices in the graph and is
+   updated without hash table calls.
 
-   If E >> V, a default hash table may provide speed advantages by avoiding
+   If E >> V, the dense index mode may provide speed advantages by avoiding
    the computation of hash values. If V is large and the graph is sparse,
-   a non-default hash table may provide space advantages.
+   a hash table may provide space advantages.
+
+   prim_lazy uses a heap without a hash table and discards stale heap
+   entries after popping, which may provide speed advantages on sparse
+   graphs by avoiding the hash table maintenance in heap operations.
 
    The implementation does not use stdint.h and is portable under C89/C90
    and C99.
@@ -46,8 +51,8 @@
                  is equal to the size of a weight in the adjacency list
    prev        : pointer to a preallocated array with a count that is equal
                  to the number of vertices in the adjacency list
-   hht         : - NULL pointer, if a default hash table is used for
-                 in-heap operations; a default hash table contains an index
+   hht         : - NULL pointer, if the heap is used in its dense index
+                 mode for in-heap operations; the heap contains a position
                  array with a count that is equal to the number of vertices
                  - a pointer to a set of parameters specifying a hash table
                  used for in-heap operations; a vertex is a hash key in 
@@ -66,4 +71,22 @@ void prim(const adj_lst_t *a,
 	  size_t *prev,
 	  const heap_ht_t *hht,
 	  int (*cmp_wt)(const void *, const void *));
+
+/**
+   Computes and copies the edge weights of an mst of the connected component
+   of a start vertex to the array pointed to by dist, and the previous
+   vertices to the array pointed to by prev, with the maximal value of size_t
+   in the prev array for unreached vertices. The heap is used without a
+   hash table and without heap_update: a vertex is pushed again with a
+   smaller weight instead of an update, and the stale entries of vertices
+   in the mst are discarded after popping according to a bitmap of
+   vertices in the mst. The heap may contain upto E entries. Please see
+   the parameter specification in prim.
+*/
+void prim_lazy(const adj_lst_t *a,
+	       size_t start,
+	       void *dist,
+	       size_t *prev,
+	       int (*cmp_wt)(const void *, const void *));
+
 #endif
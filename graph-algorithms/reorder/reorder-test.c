@@ -0,0 +1,320 @@
+/**
+   reorder-test.c
+
+   Tests of locality-improving vertex orderings and relabeling.
+
+   The following command line arguments can be used to customize tests:
+   reorder-test
+     [0, # bits in size_t / 2] : a s.t. V = 2^a for shuffled grid test
+     [0, 1] : on/off for small graph tests
+     [0, 1] : on/off for shuffled grid test
+
+   usage examples: 
+   ./reorder-test
+   ./reorder-test 20
+   ./reorder-test 20 0 1
+
+   reorder-test can be run with any subset of command line arguments in the
+   above-defined order. If the (i + 1)th argument is specified then the ith
+   argument must be specified for i >= 0. Default values are used for the
+   unspecified arguments according to the C_ARGS_DEF array.
+
+   The implementation does not use stdint.h and is portable under C89/C90.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include "reorder.h"
+#include "bfs.h"
+#include "graph.h"
+#include "utilities-mem.h"
+
+/**
+   Generate random numbers in a portable way for test purposes only; rand()
+   in the Linux C Library uses the same generator as random(), which may not
+   be the case on older rand() implementations, and on current
+   implementations on different systems.
+*/
+#define RGENS_SEED() do{srand(time(NULL));}while (0)
+#define RANDOM() (rand()) /* [0, RAND_MAX] */
+
+#define TOLU(i) ((unsigned long int)(i)) /* printing size_t under C89/C90 */
+
+/* input handling */
+const char *C_USAGE =
+  "reorder-test \n"
+  "[0, # bits in size_t / 2] : a s.t. V = 2^a for shuffled grid test \n"
+  "[0, 1] : on/off for small graph tests \n"
+  "[0, 1] : on/off for shuffled grid test \n";
+const int C_ARGC_MAX = 4;
+const size_t C_ARGS_DEF[3] = {18, 1, 1};
+const size_t C_FULL_BIT = CHAR_BIT * sizeof(size_t);
+
+/* small graph test: a star with center 3 and a path 5 - 1 - 6 */
+const size_t C_NUM_VTS = 7;
+const size_t C_NUM_ES = 5;
+const size_t C_U[5] = {3, 3, 3, 5, 1};
+const size_t C_V[5] = {0, 4, 2, 1, 6};
+const size_t C_BFS_INV[7] = {0, 3, 4, 2, 1, 5, 6};
+const size_t C_RCM_INV[7] = {6, 1, 5, 4, 2, 3, 0};
+const size_t C_DEGREE_INV[7] = {3, 1, 0, 2, 4, 5, 6};
+
+/* shuffled grid test */
+const int C_ITER = 10;
+
+const char *C_ORDER_NAMES[3] = {"bfs", "rcm", "degree"};
+void (*const C_ORDERS[3])(const adj_lst_t *, size_t *, size_t *) =
+  {reorder_bfs, reorder_rcm, reorder_degree};
+
+int is_perm_inv(const size_t *perm, const size_t *inv, size_t n);
+size_t bandwidth(const graph_t *g);
+size_t random_ix(size_t n);
+void print_test_result(int res);
+
+/**
+   Runs tests of the orderings of a small undirected graph.
+*/
+void run_small_graph_test(){
+  int res = 1;
+  size_t i;
+  size_t perm[7], inv[7];
+  graph_t g;
+  adj_lst_t a;
+  graph_base_init(&g, C_NUM_VTS, 0);
+  g.num_es = C_NUM_ES;
+  g.u = malloc_perror(g.num_es, sizeof(size_t));
+  g.v = malloc_perror(g.num_es, sizeof(size_t));
+  memcpy(g.u, C_U, g.num_es * sizeof(size_t));
+  memcpy(g.v, C_V, g.num_es * sizeof(size_t));
+  adj_lst_csr_undir_build(&a, &g);
+  reorder_bfs(&a, perm, inv);
+  res *= is_perm_inv(perm, inv, C_NUM_VTS);
+  res *= (memcmp(inv, C_BFS_INV, C_NUM_VTS * sizeof(size_t)) == 0);
+  reorder_rcm(&a, perm, inv);
+  res *= is_perm_inv(perm, inv, C_NUM_VTS);
+  res *= (memcmp(inv, C_RCM_INV, C_NUM_VTS * sizeof(size_t)) == 0);
+  reorder_degree(&a, perm, inv);
+  res *= is_perm_inv(perm, inv, C_NUM_VTS);
+  res *= (memcmp(inv, C_DEGREE_INV, C_NUM_VTS * sizeof(size_t)) == 0);
+  adj_lst_free(&a);
+  graph_free(&g);
+  graph_base_init(&g, 0, 0);
+  adj_lst_csr_undir_build(&a, &g);
+  for (i = 0; i < 3; i++){
+    C_ORDERS[i](&a, perm, inv);
+  }
+  adj_lst_free(&a);
+  graph_free(&g);
+  printf("Run reorder_{bfs, rcm, degree} tests on small graphs --> ");
+  print_test_result(res);
+}
+
+/**
+   Initializes an undirected grid graph with 2^log_n vertices, i.e.
+   2^(log_n / 2) rows, with randomly shuffled vertex labels and edges.
+*/
+void shuffled_grid_init(graph_t *g, size_t log_n){
+  size_t i, j, k, r, c, t;
+  size_t n = (size_t)1 << log_n;
+  size_t num_rows = (size_t)1 << (log_n / 2);
+  size_t num_cols = n / num_rows;
+  size_t *labels = NULL;
+  labels = malloc_perror(n, sizeof(size_t));
+  for (i = 0; i < n; i++){
+    labels[i] = i;
+  }
+  for (i = n - 1; i > 0; i--){
+    j = random_ix(i + 1);
+    t = labels[i];
+    labels[i] = labels[j];
+    labels[j] = t;
+  }
+  graph_base_init(g, n, 0);
+  g->num_es = (num_rows - 1) * num_cols + num_rows * (num_cols - 1);
+  if (g->num_es > 0){
+    g->u = malloc_perror(g->num_es, sizeof(size_t));
+    g->v = malloc_perror(g->num_es, sizeof(size_t));
+  }
+  k = 0;
+  for (r = 0; r < num_rows; r++){
+    for (c = 0; c < num_cols; c++){
+      if (c + 1 < num_cols){
+	g->u[k] = labels[r * num_cols + c];
+	g->v[k++] = labels[r * num_cols + c + 1];
+      }
+      if (r + 1 < num_rows){
+	g->u[k] = labels[r * num_cols + c];
+	g->v[k++] = labels[(r + 1) * num_cols + c];
+      }
+    }
+  }
+  for (i = g->num_es; i > 1; i--){
+    j = random_ix(i);
+    t = g->u[i - 1];
+    g->u[i - 1] = g->u[j];
+    g->u[j] = t;
+    t = g->v[i - 1];
+    g->v[i - 1] = g->v[j];
+    g->v[j] = t;
+  }
+  free(labels);
+}
+
+/**
+   Runs a test of the orderings of an undirected grid graph with shuffled
+   vertex labels. For each ordering, the BFS results on the relabeled graph
+   are mapped back and compared with the BFS results on the graph, and the
+   bandwidths and BFS runtimes are printed.
+*/
+void run_shuffled_grid_test(size_t log_n){
+  int res = 1;
+  int k;
+  size_t i, j, n;
+  size_t *start = NULL;
+  size_t *perm = NULL, *inv = NULL;
+  size_t *dist = NULL, *prev = NULL, *dist_r = NULL, *prev_r = NULL;
+  graph_t g, r;
+  adj_lst_t a, a_r;
+  clock_t t;
+  shuffled_grid_init(&g, log_n);
+  n = g.num_vts;
+  adj_lst_csr_undir_build(&a, &g);
+  start = malloc_perror(C_ITER, sizeof(size_t));
+  perm = malloc_perror(n, sizeof(size_t));
+  inv = malloc_perror(n, sizeof(size_t));
+  dist = malloc_perror(n, sizeof(size_t));
+  prev = malloc_perror(n, sizeof(size_t));
+  dist_r = malloc_perror(n, sizeof(size_t));
+  prev_r = malloc_perror(n, sizeof(size_t));
+  for (k = 0; k < C_ITER; k++){
+    start[k] = random_ix(n);
+  }
+  printf("Run reorder_{bfs, rcm, degree} tests on a grid graph with "
+	 "shuffled labels, %d bfs runs in each graph \n", C_ITER);
+  printf("\tvertices: %lu, edges: %lu\n", TOLU(n), TOLU(g.num_es));
+  t = clock();
+  for (k = 0; k < C_ITER; k++){
+    bfs(&a, start[k], dist, prev);
+  }
+  t = clock() - t;
+  printf("\t\tshuffled bandwidth: %10lu, bfs ave runtime: %.6f seconds\n",
+	 TOLU(bandwidth(&g)), (float)t / C_ITER / CLOCKS_PER_SEC);
+  for (i = 0; i < 3; i++){
+    t = clock();
+    C_ORDERS[i](&a, perm, inv);
+    t = clock() - t;
+    res *= is_perm_inv(perm, inv, n);
+    reorder_graph(&r, &g, perm);
+    adj_lst_csr_undir_build(&a_r, &r);
+    printf("\t\t%-6s ordering runtime: %.6f seconds\n",
+	   C_ORDER_NAMES[i], (float)t / CLOCKS_PER_SEC);
+    t = clock();
+    for (k = 0; k < C_ITER; k++){
+      bfs(&a_r, perm[start[k]], dist_r, prev_r);
+    }
+    t = clock() - t;
+    printf("\t\t%-6s bandwidth: %10lu, bfs ave runtime: %.6f seconds\n",
+	   C_ORDER_NAMES[i], TOLU(bandwidth(&r)),
+	   (float)t / C_ITER / CLOCKS_PER_SEC);
+    /* the last start vertex */
+    for (j = 0; j < n; j++){
+      res *= (dist_r[perm[j]] == dist[j]);
+      if (j == start[C_ITER - 1]){
+	res *= (inv[prev_r[perm[j]]] == j);
+      }else{
+	res *= (dist[inv[prev_r[perm[j]]]] + 1 == dist[j]);
+      }
+    }
+    adj_lst_free(&a_r);
+    graph_free(&r);
+  }
+  printf("\tcorrectness of mapped back bfs results --> ");
+  print_test_result(res);
+  adj_lst_free(&a);
+  graph_free(&g);
+  free(start);
+  free(perm);
+  free(inv);
+  free(dist);
+  free(prev);
+  free(dist_r);
+  free(prev_r);
+}
+
+/**
+   Auxiliary functions.
+*/
+
+/**
+   Tests if perm is a permutation of [0, n) and inv is its inverse.
+*/
+int is_perm_inv(const size_t *perm, const size_t *inv, size_t n){
+  int res = 1;
+  size_t i;
+  for (i = 0; i < n; i++){
+    res *= (perm[i] < n && inv[perm[i]] == i);
+  }
+  return res;
+}
+
+/**
+   Returns the maximal difference of labels across the edges of a graph.
+*/
+size_t bandwidth(const graph_t *g){
+  size_t i, d, ret = 0;
+  for (i = 0; i < g->num_es; i++){
+    d = (g->u[i] > g->v[i]) ? g->u[i] - g->v[i] : g->v[i] - g->u[i];
+    if (d > ret) ret = d;
+  }
+  return ret;
+}
+
+/**
+   Returns a random index in [0, n), where n > 0.
+*/
+size_t random_ix(size_t n){
+  size_t ret = 0;
+  size_t rem = n - 1;
+  while (rem > 0){
+    ret = (ret << (CHAR_BIT - 1)) ^ (size_t)RANDOM();
+    rem >>= CHAR_BIT - 1;
+  }
+  return ret % n;
+}
+
+void print_test_result(int res){
+  if (res){
+    printf("SUCCESS\n");
+  }else{
+    printf("FAILURE\n");
+  }
+}
+
+int main(int argc, char *argv[]){
+  int i;
+  size_t *args = NULL;
+  RGENS_SEED();
+  if (argc > C_ARGC_MAX){
+    fprintf(stderr, "USAGE:\n%s", C_USAGE);
+    exit(EXIT_FAILURE);
+  }
+  args = malloc_perror(C_ARGC_MAX - 1, sizeof(size_t));
+  memcpy(args, C_ARGS_DEF, (C_ARGC_MAX - 1) * sizeof(size_t));
+  for (i = 1; i < argc; i++){
+    args[i - 1] = atoi(argv[i]);
+  }
+  if (args[0] > C_FULL_BIT / 2 ||
+      args[1] > 1 ||
+      args[2] > 1){
+    fprintf(stderr, "USAGE:\n%s", C_USAGE);
+    exit(EXIT_FAILURE);
+  }
+  if (args[1]) run_small_graph_test();
+  if (args[2]) run_shuffled_grid_test(args[0]);
+  free(args);
+  args = NULL;
+  return 0;
+}
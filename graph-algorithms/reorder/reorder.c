@@ -0,0 +1,218 @@
+/**
+   reorder.c
+
+   Functions for computing locality-improving vertex orderings of graphs
+   with vertices indexed from 0, and for relabeling the vertices of a graph
+   according to an ordering.
+
+   The inv array is used as the queue of a BFS run, because the vertices
+   are labeled in the order of pushing, and the perm array with the
+   maximal value of size_t for unlabeled vertices is used for testing if a
+   vertex was visited. Vertices are sorted by degree with a counting sort,
+   which is stable and runs in O(# vertices + maximal degree) time. In an
+   RCM ordering, the unvisited neighbors of a vertex are sorted by degree
+   with qsort on (degree, vertex) pairs.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "reorder.h"
+#include "graph.h"
+#include "utilities-mem.h"
+
+typedef struct{
+  size_t deg;
+  size_t vt;
+} deg_vt_t;
+
+static const size_t NR = (size_t)-1; /* not reached as index */
+
+static size_t bfs_order(const adj_lst_t *a,
+			size_t start,
+			size_t num,
+			size_t *perm,
+			size_t *inv,
+			deg_vt_t *buf);
+static void deg_sort(const adj_lst_t *a, size_t *order, int descend);
+static int cmp_deg_vt(const void *a, const void *b);
+
+/**
+   Computes a BFS ordering. The vertices are labeled in the order of
+   visiting by BFS runs, where each run starts at the smallest unvisited
+   vertex and visits the neighbors of a vertex in the order of its list.
+   a           : pointer to an adjacency list
+   perm        : pointer to a preallocated array with the count equal to the
+                 number of vertices in the adjacency list
+   inv         : pointer to a preallocated array with the count equal to the
+                 number of vertices in the adjacency list
+*/
+void reorder_bfs(const adj_lst_t *a, size_t *perm, size_t *inv){
+  size_t i, num = 0;
+  memset(perm, 0xff, a->num_vts * sizeof(size_t)); /* initialize to NR */
+  for (i = 0; i < a->num_vts; i++){
+    if (perm[i] == NR) num = bfs_order(a, i, num, perm, inv, NULL);
+  }
+}
+
+/**
+   Computes a reverse Cuthill-McKee (RCM) ordering. Each BFS run starts at
+   an unvisited vertex with a minimal degree, and the unvisited neighbors
+   of a vertex are visited in the non-decreasing order of degrees. The
+   labels of the resulting ordering are reversed. The parameters are
+   specified in reorder_bfs.
+*/
+void reorder_rcm(const adj_lst_t *a, size_t *perm, size_t *inv){
+  size_t i, u, max_deg = 0, num = 0;
+  size_t *order = NULL;
+  deg_vt_t *buf = NULL;
+  if (a->num_vts == 0) return;
+  order = malloc_perror(a->num_vts, sizeof(size_t));
+  deg_sort(a, order, 0);
+  max_deg = adj_lst_vt_num_pairs(a, order[a->num_vts - 1]);
+  buf = malloc_perror(max_deg + 1, sizeof(deg_vt_t));
+  memset(perm, 0xff, a->num_vts * sizeof(size_t)); /* initialize to NR */
+  for (i = 0; i < a->num_vts; i++){
+    if (perm[order[i]] == NR){
+      num = bfs_order(a, order[i], num, perm, inv, buf);
+    }
+  }
+  for (i = 0; i < a->num_vts / 2; i++){
+    u = inv[i];
+    inv[i] = inv[a->num_vts - 1 - i];
+    inv[a->num_vts - 1 - i] = u;
+  }
+  for (i = 0; i < a->num_vts; i++){
+    perm[inv[i]] = i;
+  }
+  free(order);
+  free(buf);
+}
+
+/**
+   Computes a degree ordering, where vertices are labeled in the
+   non-increasing order of degrees (hubs first), and vertices with the
+   same degree are labeled in the increasing order of vertices. The
+   parameters are specified in reorder_bfs.
+*/
+void reorder_degree(const adj_lst_t *a, size_t *perm, size_t *inv){
+  size_t i;
+  if (a->num_vts == 0) return;
+  deg_sort(a, inv, 1);
+  for (i = 0; i < a->num_vts; i++){
+    perm[inv[i]] = i;
+  }
+}
+
+/**
+   Initializes a graph r with the vertices of a graph g relabeled according
+   to a permutation perm. The order and the weights of edges are preserved.
+   r           : pointer to a preallocated block of size sizeof(graph_t)
+   g           : pointer to a graph
+   perm        : pointer to an array with the count equal to the number of
+                 vertices in g, where perm[u] is the new label of a vertex u
+*/
+void reorder_graph(graph_t *r, const graph_t *g, const size_t *perm){
+  size_t i;
+  graph_base_init(r, g->num_vts, g->wt_size);
+  if (g->num_es == 0) return;
+  r->num_es = g->num_es;
+  r->u = malloc_perror(g->num_es, sizeof(size_t));
+  r->v = malloc_perror(g->num_es, sizeof(size_t));
+  for (i = 0; i < g->num_es; i++){
+    r->u[i] = perm[g->u[i]];
+    r->v[i] = perm[g->v[i]];
+  }
+  if (g->wt_size > 0){
+    r->wts = malloc_perror(g->num_es, g->wt_size);
+    memcpy(r->wts, g->wts, g->num_es * g->wt_size);
+  }
+}
+
+/** Helper functions */
+
+/**
+   Runs BFS from an unvisited vertex start, labeling each visited vertex
+   with the next label from num, and returns the next unused label. If buf
+   is not NULL, then the unvisited neighbors of each vertex are labeled in
+   the non-decreasing order of degrees, and buf has a count greater than
+   the maximal degree.
+*/
+static size_t bfs_order(const adj_lst_t *a,
+			size_t start,
+			size_t num,
+			size_t *perm,
+			size_t *inv,
+			deg_vt_t *buf){
+  const char *p = NULL, *p_start = NULL, *p_end = NULL;
+  size_t i, u, v, num_buf, head = num;
+  perm[start] = num;
+  inv[num++] = start;
+  while (head < num){
+    u = inv[head++];
+    p_start = adj_lst_vt_pairs(a, u);
+    p_end = p_start + adj_lst_vt_num_pairs(a, u) * a->pair_size;
+    num_buf = 0;
+    for (p = p_start; p != p_end; p += a->pair_size){
+      v = *(const size_t *)p;
+      if (perm[v] != NR) continue;
+      if (buf == NULL){
+	perm[v] = num;
+	inv[num++] = v;
+      }else{
+	perm[v] = 0; /* visited, labeled after sorting */
+	buf[num_buf].deg = adj_lst_vt_num_pairs(a, v);
+	buf[num_buf].vt = v;
+	num_buf++;
+      }
+    }
+    if (num_buf > 0){
+      qsort(buf, num_buf, sizeof(deg_vt_t), cmp_deg_vt);
+      for (i = 0; i < num_buf; i++){
+	perm[buf[i].vt] = num;
+	inv[num++] = buf[i].vt;
+      }
+    }
+  }
+  return num;
+}
+
+/**
+   Sorts the vertices of an adjacency list by degree into an array order
+   with a stable counting sort, in the non-decreasing order of degrees or
+   in the non-increasing order if descend is nonzero. The adjacency list
+   has at least one vertex.
+*/
+static void deg_sort(const adj_lst_t *a, size_t *order, int descend){
+  size_t i, d, max_deg = 0, sum = 0;
+  size_t *cnts = NULL;
+  for (i = 0; i < a->num_vts; i++){
+    d = adj_lst_vt_num_pairs(a, i);
+    if (d > max_deg) max_deg = d;
+  }
+  cnts = calloc_perror(max_deg + 1, sizeof(size_t));
+  for (i = 0; i < a->num_vts; i++){
+    d = adj_lst_vt_num_pairs(a, i);
+    cnts[(descend) ? max_deg - d : d]++;
+  }
+  for (i = 0; i <= max_deg; i++){
+    d = cnts[i];
+    cnts[i] = sum;
+    sum += d;
+  }
+  for (i = 0; i < a->num_vts; i++){
+    d = adj_lst_vt_num_pairs(a, i);
+    order[cnts[(descend) ? max_deg - d : d]++] = i;
+  }
+  free(cnts);
+}
+
+/**
+   Compares (degree, vertex) pairs lexicographically.
+*/
+static int cmp_deg_vt(const void *a, const void *b){
+  const deg_vt_t *x = a;
+  const deg_vt_t *y = b;
+  if (x->deg != y->deg) return (x->deg > y->deg) - (x->deg < y->deg);
+  return (x->vt > y->vt) - (x->vt < y->vt);
+}
@@ -0,0 +1,69 @@
+/**
+   reorder.h
+
+   Declarations of accessible functions for computing locality-improving
+   vertex orderings of graphs with vertices indexed from 0, and for
+   relabeling the vertices of a graph according to an ordering.
+
+   An ordering is provided as a permutation perm and its inverse inv, each
+   an array with the count equal to the number of vertices, where perm[u]
+   is the new label of a vertex u and inv[w] is the vertex with the new
+   label w. A graph relabeled with perm is built into an adjacency list,
+   and an algorithm is run on the adjacency list. The result of a vertex u
+   is then at the index perm[u] of a result array, and a vertex value w in
+   a result array (e.g. a prev value) is mapped back with inv[w].
+
+   The orderings are computed on the out-neighbors of an adjacency list and
+   are the standard orderings if the adjacency list is undirected. A
+   relabeling places the neighbors of a vertex close to the vertex and to
+   each other in the arrays indexed by vertices, which decreases cache
+   misses in algorithms that access such arrays (e.g. dist and prev) by
+   neighbor vertices.
+*/
+
+#ifndef REORDER_H
+#define REORDER_H
+
+#include <stddef.h>
+#include "graph.h"
+
+/**
+   Computes a BFS ordering. The vertices are labeled in the order of
+   visiting by BFS runs, where each run starts at the smallest unvisited
+   vertex and visits the neighbors of a vertex in the order of its list.
+   a           : pointer to an adjacency list
+   perm        : pointer to a preallocated array with the count equal to the
+                 number of vertices in the adjacency list
+   inv         : pointer to a preallocated array with the count equal to the
+                 number of vertices in the adjacency list
+*/
+void reorder_bfs(const adj_lst_t *a, size_t *perm, size_t *inv);
+
+/**
+   Computes a reverse Cuthill-McKee (RCM) ordering. Each BFS run starts at
+   an unvisited vertex with a minimal degree, and the unvisited neighbors
+   of a vertex are visited in the non-decreasing order of degrees. The
+   labels of the resulting ordering are reversed. The parameters are
+   specified in reorder_bfs.
+*/
+void reorder_rcm(const adj_lst_t *a, size_t *perm, size_t *inv);
+
+/**
+   Computes a degree ordering, where vertices are labeled in the
+   non-increasing order of degrees (hubs first), and vertices with the
+   same degree are labeled in the increasing order of vertices. The
+   parameters are specified in reorder_bfs.
+*/
+void reorder_degree(const adj_lst_t *a, size_t *perm, size_t *inv);
+
+/**
+   Initializes a graph r with the vertices of a graph g relabeled according
+   to a permutation perm. The order and the weights of edges are preserved.
+   r           : pointer to a preallocated block of size sizeof(graph_t)
+   g           : pointer to a graph
+   perm        : pointer to an array with the count equal to the number of
+                 vertices in g, where perm[u] is the new label of a vertex u
+*/
+void reorder_graph(graph_t *r, const graph_t *g, const size_t *perm);
+
+#endif
@@ -174,6 +174,8 @@ void ht_divchn_init_helper(ht_divchn_t *ht,
 		 0,
 		 c->alpha_n,
 		 c->log_alpha_d,
+		 NULL,
+		 NULL,
 		 free_elt);
 }
 
@@ -189,6 +191,7 @@ void ht_muloa_init_helper(ht_muloa_t *ht,
 		0,
 		c->alpha_n,
 		c->log_alpha_d,
+		NULL,
 		c->rdc_key,
 		free_elt);
 }
@@ -270,6 +273,11 @@ void run_uint_graph_test(){
   run_divchn_uint_tsp(&a);
   run_muloa_uint_tsp(&a);
   adj_lst_free(&a);
+  printf("Running a test on a size_t graph in CSR format with a default "
+	 "hash table \n\n");
+  adj_lst_csr_dir_build(&a, &g);
+  run_def_uint_tsp(&a);
+  adj_lst_free(&a);
   graph_free(&g);
   graph_uint_single_vt_init(&g);
   printf("Running a test on a size_t graph with a single vertex, with a \n"
@@ -798,8 +806,8 @@ void print_adj_lst(const adj_lst_t *a, void (*print_wt)(const void *)){
   printf("\tvertices: \n");
   for (i = 0; i < a->num_vts; i++){
     printf("\t%lu : ", TOLU(i));
-    p_start = a->vt_wts[i]->elts;
-    p_end = p_start + a->vt_wts[i]->num_elts * a->pair_size;
+    p_start = adj_lst_vt_pairs(a, i);
+    p_end = p_start + adj_lst_vt_num_pairs(a, i) * a->pair_size;
     for (p = p_start; p != p_end; p += a->pair_size){
       printf("%lu ", TOLU(*(const size_t *)p));
     }
@@ -809,8 +817,8 @@ void print_adj_lst(const adj_lst_t *a, void (*print_wt)(const void *)){
     printf("\tweights: \n");
     for (i = 0; i < a->num_vts; i++){
       printf("\t%lu : ", TOLU(i));
-      p_start = a->vt_wts[i]->elts;
-      p_end = p_start + a->vt_wts[i]->num_elts * a->pair_size;
+      p_start = adj_lst_vt_pairs(a, i);
+      p_end = p_start + adj_lst_vt_num_pairs(a, i) * a->pair_size;
       for (p = p_start; p != p_end; p += a->pair_size){
 	print_wt(p + a->offset);
       }
@@ -184,8 +184,8 @@ int tsp(const adj_lst_t *a,
   while (prev_s.num_elts > 0){
     stack_pop(&prev_s, prev_set);
     u = prev_set[0];
-    p_start = a->vt_wts[u]->elts;
-    p_end = p_start + a->vt_wts[u]->num_elts * a->pair_size;
+    p_start = adj_lst_vt_pairs(a, u);
+    p_end = p_start + adj_lst_vt_num_pairs(a, u) * a->pair_size;
     for (p = p_start; p != p_end; p += a->pair_size){
       v = *(const size_t *)p;
       if (v == start){
@@ -237,8 +237,8 @@ static void build_next(const adj_lst_t *a,
     stack_pop(prev_s, prev_set);
     tht->remove(tht->ht, prev_set, prev_wt);
     u = prev_set[0];
-    p_start = a->vt_wts[u]->elts;
-    p_end = p_start + a->vt_wts[u]->num_elts * a->pair_size;
+    p_start = adj_lst_vt_pairs(a, u);
+    p_end = p_start + adj_lst_vt_num_pairs(a, u) * a->pair_size;
     for (p = p_start; p != p_end; p += a->pair_size){
       v = *(const size_t *)p;
       set_init(&ibit, v);
@@ -58,7 +58,7 @@ typedef struct{
   int (*cmp)(const void *, const void *);
 } merge_arg_t;
 
-const size_t C_SIZE_MAX = (size_t)-1; /* cannot be reached as array index */
+static const size_t C_SIZE_MAX = (size_t)-1; /* cannot be reached as array index */
 
 static void *mergesort_thread(void *arg);
 static void *merge_thread(void *arg);
@@ -11,6 +11,7 @@
 #include <unistd.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <errno.h>
 #include <pthread.h>
 #include "utilities-pthread.h"
 
@@ -38,8 +39,10 @@ void thread_join_perror(pthread_t thread, void **retval){
 }
 
 /**
-   Initialize with default attributes, lock, and unlock a mutex with
-   error checking.
+   Initialize with default attributes, lock, try to lock, unlock, and
+   destroy a mutex with error checking. mutex_trylock_perror returns 0 if
+   the mutex was locked by the call, and a non-zero value if the mutex was
+   already locked.
 */
 
 void mutex_init_perror(pthread_mutex_t *mutex){
@@ -58,6 +61,15 @@ void mutex_lock_perror(pthread_mutex_t *mutex){
   }
 }
 
+int mutex_trylock_perror(pthread_mutex_t *mutex){
+  int err = pthread_mutex_trylock(mutex);
+  if (err != 0 && err != EBUSY){
+    perror("pthread_mutex_trylock failed");
+    exit(EXIT_FAILURE);
+  }
+  return err;
+}
+
 void mutex_unlock_perror(pthread_mutex_t *mutex){
   int err = pthread_mutex_unlock(mutex);
   if (err != 0){
@@ -66,9 +78,18 @@ void mutex_unlock_perror(pthread_mutex_t *mutex){
   }
 }
 
+void mutex_destroy_perror(pthread_mutex_t *mutex){
+  int err = pthread_mutex_destroy(mutex);
+  if (err != 0){
+    perror("pthread_mutex_destroy failed");
+    exit(EXIT_FAILURE);
+  }
+}
+
 /**
    Initialize a condition variable with default attributes and
-   error checking. Wait on and signal a condition with error checking.
+   error checking. Wait on, signal, and destroy a condition with error
+   checking.
 */
 
 void cond_init_perror(pthread_cond_t *cond){
@@ -103,6 +124,14 @@ void cond_broadcast_perror(pthread_cond_t *cond){
   }
 }
 
+void cond_destroy_perror(pthread_cond_t *cond){
+  int err = pthread_cond_destroy(cond);
+  if (err != 0){
+    perror("pthread_cond_destroy failed");
+    exit(EXIT_FAILURE);
+  }
+}
+
 /**
    Initialize, wait on, and signal a semaphore with error checking
    provided by mutex and condition variable operations.
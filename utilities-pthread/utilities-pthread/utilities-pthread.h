@@ -32,19 +32,26 @@ void thread_create_perror(pthread_t *thread,
 void thread_join_perror(pthread_t thread, void **retval);
 
 /**
-   Initialize with default attributes, lock, and unlock a mutex with
-   error checking.
+   Initialize with default attributes, lock, try to lock, unlock, and
+   destroy a mutex with error checking. mutex_trylock_perror returns 0 if
+   the mutex was locked by the call, and a non-zero value if the mutex was
+   already locked.
 */
 
 void mutex_init_perror(pthread_mutex_t *mutex);
 
 void mutex_lock_perror(pthread_mutex_t *mutex);
 
+int mutex_trylock_perror(pthread_mutex_t *mutex);
+
 void mutex_unlock_perror(pthread_mutex_t *mutex);
 
+void mutex_destroy_perror(pthread_mutex_t *mutex);
+
 /**
    Initialize a condition variable with default attributes and
-   error checking. Wait on and signal a condition with error checking.
+   error checking. Wait on, signal, and destroy a condition with error
+   checking.
 */
 
 void cond_init_perror(pthread_cond_t *cond);
@@ -55,6 +62,8 @@ void cond_signal_perror(pthread_cond_t *cond);
 
 void cond_broadcast_perror(pthread_cond_t *cond);
 
+void cond_destroy_perror(pthread_cond_t *cond);
+
 /**
    Initialize, wait on, and signal a semaphore with error checking
    provided by mutex and condition variable operations.
@@ -0,0 +1,169 @@
+/**
+   utilities-mem-huge-test.c
+
+   Tests of utility functions for memory management of blocks that are
+   backed by huge pages.
+
+   The following command line arguments can be used to customize tests:
+   utilities-mem-huge-test
+      [21, # bits in size_t - 1) : n for 2^n bytes in a large block
+      [0, 21) : m for 2^m bytes in a small block
+      [0, 1] : malloc_huge_perror, realloc_huge_perror, and free_huge test
+               on/off
+
+   usage examples: 
+   ./utilities-mem-huge-test
+   ./utilities-mem-huge-test 25
+   ./utilities-mem-huge-test 22 12 1
+
+   utilities-mem-huge-test can be run with any subset of command line
+   arguments in the above-defined order. If the (i + 1)th argument is
+   specified then the ith argument must be specified for i >= 0. Default
+   values are used for the unspecified arguments according to the
+   C_ARGS_DEF array.
+
+   The implementation of tests does not use stdint.h and is portable under
+   C89/C90 and C99 with the requirement that POSIX mmap is available.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "utilities-mem-huge.h"
+#include "utilities-mem.h"
+
+#define TOLU(i) ((unsigned long int)(i)) /* printing size_t under C89/C90 */
+
+/* input handling */
+const char *C_USAGE =
+  "utilities-mem-huge-test \n"
+  "[21, # bits in size_t - 1) : n for 2^n bytes in a large block \n"
+  "[0, 21) : m for 2^m bytes in a small block \n"
+  "[0, 1] : malloc_huge_perror, realloc_huge_perror, and free_huge test "
+  "on/off \n";
+const int C_ARGC_MAX = 4;
+const size_t C_ARGS_DEF[3] = {23, 10, 1};
+
+/* tests */
+const size_t C_HUGE_PAGE_LOG = 21; /* 2 MiB */
+const size_t C_FULL_BIT = CHAR_BIT * sizeof(size_t);
+
+void fill(size_t *a, size_t start, size_t count);
+int is_filled(const size_t *a, size_t count);
+void print_test_result(int res);
+
+/**
+   Tests malloc_huge_perror, realloc_huge_perror, and free_huge on a large
+   block of at least a huge page, which is mapped, and on a small block
+   below a huge page, which is allocated with malloc. The contents of a
+   block are checked after each call, including after each transition
+   between the two allocation paths in realloc_huge_perror.
+*/
+void run_malloc_realloc_free_test(size_t log_large, size_t log_small){
+  int res = 1;
+  size_t num_large = ((size_t)1 << log_large) / sizeof(size_t);
+  size_t num_small = ((size_t)1 << log_small) / sizeof(size_t);
+  size_t *a = NULL;
+  printf("Run malloc_huge_perror, realloc_huge_perror, and free_huge "
+	 "test on %lu-byte and %lu-byte blocks\n",
+	 TOLU(num_large * sizeof(size_t)), TOLU(num_small * sizeof(size_t)));
+  printf("\tmalloc large:               ");
+  a = malloc_huge_perror(num_large, sizeof(size_t));
+  fill(a, 0, num_large);
+  res *= is_filled(a, num_large);
+  print_test_result(res);
+  printf("\trealloc large to 2 * large: ");
+  a = realloc_huge_perror(a, 2 * num_large, sizeof(size_t));
+  res *= is_filled(a, num_large);
+  fill(a, num_large, num_large);
+  res *= is_filled(a, 2 * num_large);
+  print_test_result(res);
+  printf("\trealloc 2 * large to large: ");
+  a = realloc_huge_perror(a, num_large, sizeof(size_t));
+  res *= is_filled(a, num_large);
+  print_test_result(res);
+  printf("\trealloc large to small:     ");
+  a = realloc_huge_perror(a, num_small, sizeof(size_t));
+  res *= is_filled(a, num_small);
+  print_test_result(res);
+  printf("\trealloc small to 2 * small: ");
+  a = realloc_huge_perror(a, 2 * num_small, sizeof(size_t));
+  res *= is_filled(a, num_small);
+  fill(a, num_small, num_small);
+  res *= is_filled(a, 2 * num_small);
+  print_test_result(res);
+  printf("\trealloc 2 * small to large: ");
+  a = realloc_huge_perror(a, num_large, sizeof(size_t));
+  res *= is_filled(a, 2 * num_small);
+  fill(a, 2 * num_small, num_large - 2 * num_small);
+  res *= is_filled(a, num_large);
+  print_test_result(res);
+  free_huge(a);
+  a = NULL;
+  printf("\tmalloc and free small:      ");
+  a = malloc_huge_perror(num_small, sizeof(size_t));
+  fill(a, 0, num_small);
+  res *= is_filled(a, num_small);
+  free_huge(a);
+  a = NULL;
+  free_huge(a);
+  print_test_result(res);
+}
+
+/**
+   Sets the count elements, starting at the index start, to their indices,
+   and tests if the first count elements are equal to their indices.
+*/
+
+void fill(size_t *a, size_t start, size_t count){
+  size_t i;
+  for (i = start; i < start + count; i++){
+    a[i] = i;
+  }
+}
+
+int is_filled(const size_t *a, size_t count){
+  int res = 1;
+  size_t i;
+  for (i = 0; i < count; i++){
+    res *= (a[i] == i);
+  }
+  return res;
+}
+
+/**
+   Prints a test result.
+*/
+void print_test_result(int res){
+  if (res){
+    printf("SUCCESS\n");
+  }else{
+    printf("FAILURE\n");
+  }
+}
+
+int main(int argc, char *argv[]){
+  int i;
+  size_t *args = NULL;
+  if (argc > C_ARGC_MAX){
+    printf("USAGE:\n%s", C_USAGE);
+    exit(EXIT_FAILURE);
+  }
+  args = malloc_perror(C_ARGC_MAX - 1, sizeof(size_t));
+  memcpy(args, C_ARGS_DEF, (C_ARGC_MAX - 1) * sizeof(size_t));
+  for (i = 1; i < argc; i++){
+    args[i - 1] = atoi(argv[i]);
+  }
+  if (args[0] < C_HUGE_PAGE_LOG ||
+      args[0] > C_FULL_BIT - 2 ||
+      args[1] > C_HUGE_PAGE_LOG - 1 ||
+      args[2] > 1){
+    printf("USAGE:\n%s", C_USAGE);
+    exit(EXIT_FAILURE);
+  }
+  if (args[2]) run_malloc_realloc_free_test(args[0], args[1]);
+  free(args);
+  args = NULL;
+  return 0;
+}
@@ -0,0 +1,150 @@
+/**
+   utilities-mem-huge.c
+
+   Utility functions for memory management of blocks that are backed by
+   huge pages if huge pages are available.
+
+   A block that is at least as large as a huge page is first mapped with
+   MAP_HUGETLB from the reserved huge pages of a system. If the mapping is
+   not completed, the block is privately mapped from /dev/zero with POSIX
+   mmap, the mapping is trimmed to start and end at huge page boundaries,
+   and transparent huge pages are requested for the mapping with
+   madvise(MADV_HUGEPAGE), which is effective if the transparent huge page
+   mode of a system is "madvise" or "always". If MAP_HUGETLB or
+   MADV_HUGEPAGE is not defined on a system, the corresponding step is
+   skipped. If neither mapping is completed, or a block is smaller than a
+   huge page, malloc is used.
+
+   The implementation does not use stdint.h and is portable under C89/C90
+   and C99 with the requirement that POSIX mmap is available.
+*/
+
+#define _XOPEN_SOURCE 600
+#define _DEFAULT_SOURCE /* MAP_HUGETLB, MAP_ANONYMOUS, and MADV_HUGEPAGE */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "utilities-mem-huge.h"
+#include "utilities-mem.h"
+
+static const size_t C_SIZE_MAX = (size_t)-1;
+static const size_t C_HUGE_PAGE_SIZE = 2097152u; /* 2 MiB */
+static const size_t C_HUGE_HDR_SIZE = 64; /* >= 2 * sizeof(size_t) */
+
+static void *mmap_huge(size_t *len);
+
+/**
+   Malloc, realloc, and free of blocks that are backed by huge pages if
+   a block is at least as large as a huge page and huge pages are
+   available on a given system, with wrapped error checking, including
+   integer overflow checking. A block is preceded by a header of size
+   C_HUGE_HDR_SIZE with the mapped length, or 0 if the block was
+   allocated with malloc, and the size of the block.
+*/
+
+void *malloc_huge_perror(size_t num, size_t size){
+  size_t len, hdr[2];
+  unsigned char *p = NULL;
+  if (num > C_SIZE_MAX / size){
+    perror("malloc_huge integer overflow");
+    exit(EXIT_FAILURE);
+  }
+  hdr[1] = num * size;
+  len = add_sz_perror(hdr[1], C_HUGE_HDR_SIZE);
+  if (len >= C_HUGE_PAGE_SIZE) p = mmap_huge(&len);
+  if (p == NULL){
+    p = malloc_perror(1, len);
+    len = 0;
+  }
+  hdr[0] = len;
+  memcpy(p, hdr, sizeof(hdr));
+  return p + C_HUGE_HDR_SIZE;
+}
+
+void *realloc_huge_perror(void *ptr, size_t num, size_t size){
+  size_t hdr[2];
+  unsigned char *p = NULL;
+  unsigned char *new_p = NULL;
+  if (ptr == NULL) return malloc_huge_perror(num, size);
+  if (num > C_SIZE_MAX / size){
+    perror("realloc_huge integer overflow");
+    exit(EXIT_FAILURE);
+  }
+  p = (unsigned char *)ptr - C_HUGE_HDR_SIZE;
+  memcpy(hdr, p, sizeof(hdr));
+  if (hdr[0] == 0 &&
+      add_sz_perror(num * size, C_HUGE_HDR_SIZE) < C_HUGE_PAGE_SIZE){
+    /* remains below huge page size */
+    p = realloc_perror(p, 1, num * size + C_HUGE_HDR_SIZE);
+    hdr[1] = num * size;
+    memcpy(p, hdr, sizeof(hdr));
+    return p + C_HUGE_HDR_SIZE;
+  }
+  new_p = malloc_huge_perror(num, size);
+  memcpy(new_p, ptr, (hdr[1] < num * size) ? hdr[1] : num * size);
+  free_huge(ptr);
+  return new_p;
+}
+
+void free_huge(void *ptr){
+  size_t hdr[2];
+  unsigned char *p = NULL;
+  if (ptr == NULL) return;
+  p = (unsigned char *)ptr - C_HUGE_HDR_SIZE;
+  memcpy(hdr, p, sizeof(hdr));
+  if (hdr[0] == 0){
+    free(p);
+  }else{
+    munmap(p, hdr[0]);
+  }
+}
+
+/**
+   Maps a block of at least *len bytes that starts and ends at huge page
+   boundaries, and sets *len to the mapped length. The block is mapped
+   with MAP_HUGETLB if possible. Otherwise the block is mapped with an
+   additional huge page, the unaligned head and tail are unmapped, and
+   transparent huge pages are requested for the aligned range. Returns
+   NULL if a mapping was not completed.
+*/
+static void *mmap_huge(size_t *len){
+  int fd;
+  size_t n = *len, head, tail;
+  unsigned char *p = NULL;
+  void *m = MAP_FAILED;
+  if (n > C_SIZE_MAX - (C_HUGE_PAGE_SIZE - 1) ||
+      n + (C_HUGE_PAGE_SIZE - 1) > C_SIZE_MAX - C_HUGE_PAGE_SIZE){
+    return NULL;
+  }
+  n = (n + C_HUGE_PAGE_SIZE - 1) & ~(C_HUGE_PAGE_SIZE - 1);
+#ifdef MAP_HUGETLB
+  m = mmap(NULL, n, PROT_READ | PROT_WRITE,
+	   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  if (m != MAP_FAILED){
+    *len = n;
+    return m;
+  }
+#endif
+  fd = open("/dev/zero", O_RDWR);
+  if (fd == -1) return NULL;
+  m = mmap(NULL, n + C_HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE,
+	   MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (m == MAP_FAILED) return NULL;
+  p = m;
+  head = (C_HUGE_PAGE_SIZE -
+	  (size_t)((unsigned long)p & (C_HUGE_PAGE_SIZE - 1))) &
+    (C_HUGE_PAGE_SIZE - 1);
+  tail = C_HUGE_PAGE_SIZE - head;
+  if (head > 0) munmap(p, head);
+  if (tail > 0) munmap(p + head + n, tail);
+#ifdef MADV_HUGEPAGE
+  madvise(p + head, n, MADV_HUGEPAGE); /* advisory, failure is ignored */
+#endif
+  *len = n;
+  return p + head;
+}
@@ -0,0 +1,33 @@
+/**
+   utilities-mem-huge.h
+
+   Declarations of accessible utility functions for memory management of
+   blocks that are backed by huge pages if huge pages are available.
+*/
+
+#ifndef UTILITIES_MEM_HUGE_H
+#define UTILITIES_MEM_HUGE_H
+
+#include <stddef.h>
+
+/**
+   Malloc, realloc, and free of blocks with wrapped error checking,
+   including integer overflow checking. If a block is at least as large
+   as a huge page, the block is mapped from reserved huge pages if
+   available, and otherwise transparent huge pages are requested for the
+   block, which are provided if the transparent huge page mode of a given
+   system is "madvise" or "always". Huge pages reduce TLB misses in
+   random accesses into large arrays. If huge pages are unavailable, the
+   block is backed by regular pages. A block returned by
+   malloc_huge_perror or realloc_huge_perror is freed with free_huge and
+   reallocated with realloc_huge_perror, and is suitably aligned for any
+   basic type.
+*/
+
+void *malloc_huge_perror(size_t num, size_t size);
+
+void *realloc_huge_perror(void *ptr, size_t num, size_t size);
+
+void free_huge(void *ptr);
+
+#endif